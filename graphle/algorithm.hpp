@@ -4,4 +4,8 @@
 
 #pragma once
 
+#include <algorithm/bit_matrix_algorithms.hpp>
+#include <algorithm/graph_partition.hpp>
+#include <algorithm/parallel_reachability.hpp>
+#include <algorithm/static_graph_algorithms.hpp>
 #include <algorithm/strongly_connected_components.hpp>
@@ -0,0 +1,289 @@
+#pragma once
+
+#include <common.hpp>
+#include <graph/bit_matrix_graph.hpp>
+#include <utility/dynamic_bitset.hpp>
+#include <utility/jagged_array.hpp>
+#include <utility/work_budget.hpp>
+
+#include <bit>
+#include <limits>
+#include <utility>
+#include <vector>
+
+
+// Algorithms on bit_matrix_graph. All of these operate on entire rows of the adjacency matrix at a time,
+// so every step of a search is a sequence of word-wise OR / AND-NOT operations over the frontier, instead of one set lookup per edge.
+namespace graphle::alg {
+    /**
+     * @ingroup Alg
+     * Performs a level-synchronous breadth first search on the given graph, invoking the callback once for every level of the search.
+     * The next frontier is computed as the union of the rows of all vertices in the current frontier, minus the vertices that have already been seen.
+     *
+     * @param graph The graph to search.
+     * @param root The index of the vertex to start the search from.
+     * @param visit_level An object invocable as visit_level(const util::dynamic_bitset& frontier, std::size_t depth) -> bool,
+     *  called for every level of the search, starting with a frontier containing only the root at depth 0.
+     *  The search stops early if the callback returns false.
+     * @param budget A @ref util::work_budget limiting the search. If an lvalue is passed, the work performed is consumed from it.
+     *  Every level consumes one unit of work for every vertex in its frontier, and the budget is only checked between levels.
+     * @return FINISHED if the search finished normally, STOPPED if the callback caused the algorithm to return early,
+     *  or CANCELLED if the budget was exhausted first.
+     */
+    template <typename Vertex, typename Index, typename F, util::budget Budget>
+    constexpr inline util::run_status breadth_first_frontiers(const bit_matrix_graph<Vertex, Index>& graph, std::size_t root, F&& visit_level, Budget&& budget) {
+        util::dynamic_bitset frontier { graph.num_vertices() };
+        util::dynamic_bitset next     { graph.num_vertices() };
+        util::dynamic_bitset seen     { graph.num_vertices() };
+
+        frontier.set(root);
+        seen.set(root);
+
+
+        for (std::size_t depth = 0; frontier.any(); ++depth) {
+            if (!visit_level(std::as_const(frontier), depth)) return util::run_status::STOPPED;
+
+            std::size_t work = 0;
+
+            next.clear();
+            for (auto v : frontier.set_bits()) {
+                next |= graph.row(v);
+                ++work;
+            }
+
+            next.and_not(seen);
+            seen |= next;
+
+            std::swap(frontier, next);
+
+            // Only cancel if there is another level left, so a budget exhausted by the last level still finishes the search.
+            if (!budget.consume(work) && frontier.any()) return util::run_status::CANCELLED;
+        }
+
+
+        return util::run_status::FINISHED;
+    }
+
+
+    /**
+     * @ingroup Alg
+     * Equivalent to the budget overload of @ref breadth_first_frontiers, but without a budget.
+     *
+     * @param graph The graph to search.
+     * @param root The index of the vertex to start the search from.
+     * @param visit_level An object invocable as visit_level(const util::dynamic_bitset& frontier, std::size_t depth) -> bool,
+     *  called for every level of the search. The search stops early if the callback returns false.
+     * @return True if the algorithm finished normally or false if the callback caused the algorithm to return early.
+     */
+    template <typename Vertex, typename Index, typename F>
+    constexpr inline bool breadth_first_frontiers(const bit_matrix_graph<Vertex, Index>& graph, std::size_t root, F&& visit_level) {
+        return breadth_first_frontiers(graph, root, GRAPHLE_FWD(visit_level), util::unlimited_budget {}) == util::run_status::FINISHED;
+    }
+
+
+    /**
+     * @ingroup Alg
+     * Returns the distance from the given root vertex to every vertex in the graph, indexed by vertex index.
+     * The distance of vertices that are not reachable from the root is std::numeric_limits<std::size_t>::max().
+     *
+     * @param graph The graph to search.
+     * @param root The index of the vertex to start the search from.
+     * @param budget A @ref util::work_budget limiting the search. See @ref breadth_first_frontiers.
+     * @return A pair of FINISHED or CANCELLED, depending on whether the search finished before the budget was exhausted,
+     *  and a vector of distances from the root, indexed by vertex index. If the search was cancelled, vertices beyond the last level are left unreached.
+     */
+    template <typename Vertex, typename Index, util::budget Budget>
+    constexpr inline auto breadth_first_distances(const bit_matrix_graph<Vertex, Index>& graph, std::size_t root, Budget&& budget) {
+        std::vector<std::size_t> result(graph.num_vertices(), std::numeric_limits<std::size_t>::max());
+
+        const auto status = breadth_first_frontiers(graph, root, [&] (const util::dynamic_bitset& frontier, std::size_t depth) {
+            for (auto v : frontier.set_bits()) result[v] = depth;
+            return true;
+        }, budget);
+
+        return std::pair { status, std::move(result) };
+    }
+
+
+    /**
+     * @ingroup Alg
+     * Equivalent to the budget overload of @ref breadth_first_distances, but without a budget.
+     *
+     * @param graph The graph to search.
+     * @param root The index of the vertex to start the search from.
+     * @return A vector of distances from the root, indexed by vertex index.
+     */
+    template <typename Vertex, typename Index>
+    constexpr inline std::vector<std::size_t> breadth_first_distances(const bit_matrix_graph<Vertex, Index>& graph, std::size_t root) {
+        return breadth_first_distances(graph, root, util::unlimited_budget {}).second;
+    }
+
+
+    /**
+     * @ingroup Alg
+     * Returns the set of vertices reachable from the given root vertex (including the root itself), as a bitset indexed by vertex index.
+     *
+     * @param graph The graph to search.
+     * @param root The index of the vertex to start the search from.
+     * @param budget A @ref util::work_budget limiting the search. If an lvalue is passed, the work performed is consumed from it.
+     *  Every expanded vertex consumes one unit of work.
+     * @return A pair of FINISHED or CANCELLED, depending on whether the search finished before the budget was exhausted,
+     *  and a bitset where bit i is set if the vertex with index i is reachable from the root. If the search was cancelled, the bitset may be incomplete.
+     */
+    template <typename Vertex, typename Index, util::budget Budget>
+    constexpr inline auto reachable_vertices(const bit_matrix_graph<Vertex, Index>& graph, std::size_t root, Budget&& budget) {
+        util::dynamic_bitset seen { graph.num_vertices() };
+        std::vector<std::size_t> pending { root };
+        seen.set(root);
+
+        // Unlike in the BFS, the order in which vertices are expanded does not matter here,
+        // so every vertex can be expanded as soon as it is found, without constructing the next frontier first.
+        while (!pending.empty()) {
+            const auto v = pending.back();
+            pending.pop_back();
+
+            const auto row = graph.row(v);
+            auto words     = seen.words();
+
+            for (std::size_t w = 0; w < words.size(); ++w) {
+                util::bit_word found = row[w] & ~words[w];
+                words[w] |= found;
+
+                for (/* no init */; found; found &= found - 1) {
+                    pending.push_back(w * util::bits_per_word + std::size_t(std::countr_zero(found)));
+                }
+            }
+
+            // Only cancel if there are vertices left, so a budget exhausted by the last vertex still finishes the search.
+            if (!budget.consume() && !pending.empty()) return std::pair { util::run_status::CANCELLED, std::move(seen) };
+        }
+
+        return std::pair { util::run_status::FINISHED, std::move(seen) };
+    }
+
+
+    /**
+     * @ingroup Alg
+     * Equivalent to the budget overload of @ref reachable_vertices, but without a budget.
+     *
+     * @param graph The graph to search.
+     * @param root The index of the vertex to start the search from.
+     * @return A bitset where bit i is set if the vertex with index i is reachable from the root.
+     */
+    template <typename Vertex, typename Index>
+    constexpr inline util::dynamic_bitset reachable_vertices(const bit_matrix_graph<Vertex, Index>& graph, std::size_t root) {
+        return reachable_vertices(graph, root, util::unlimited_budget {}).second;
+    }
+
+
+    /**
+     * @ingroup Alg
+     * Computes the transitive closure of the given graph using Warshall's algorithm
+     * (Warshall, S. (1962). A Theorem on Boolean Matrices. Journal of the ACM, 9(1), 11–12. doi:10.1145/321105.321107),
+     * with the inner loop performed a row at a time.
+     *
+     * @param graph The graph to compute the transitive closure of.
+     * @param budget A @ref util::work_budget limiting the algorithm. If an lvalue is passed, the work performed is consumed from it.
+     *  Every intermediate vertex consumes one unit of work for every vertex of the graph, and the budget is only checked between intermediate vertices.
+     * @return A pair of FINISHED or CANCELLED, depending on whether the algorithm finished before the budget was exhausted,
+     *  and a graph with an edge from A to B for every pair of vertices where B is reachable from A through a path of at least one edge.
+     *  If the algorithm was cancelled, the graph only contains the paths through the intermediate vertices processed so far.
+     */
+    template <typename Vertex, typename Index, util::budget Budget>
+    constexpr inline auto transitive_closure(const bit_matrix_graph<Vertex, Index>& graph, Budget&& budget) {
+        auto result = graph;
+
+        for (std::size_t k = 0; k < result.num_vertices(); ++k) {
+            const auto row_k = result.row(k);
+
+            for (std::size_t i = 0; i < result.num_vertices(); ++i) {
+                if (result.has_edge(i, k)) util::words_or(result.row(i), row_k);
+            }
+
+            // Only cancel if there are intermediate vertices left, so a budget exhausted by the last one still finishes the algorithm.
+            if (!budget.consume(result.num_vertices()) && k + 1 < result.num_vertices()) return std::pair { util::run_status::CANCELLED, std::move(result) };
+        }
+
+        return std::pair { util::run_status::FINISHED, std::move(result) };
+    }
+
+
+    /**
+     * @ingroup Alg
+     * Equivalent to the budget overload of @ref transitive_closure, but without a budget.
+     *
+     * @param graph The graph to compute the transitive closure of.
+     * @return A graph with an edge from A to B for every pair of vertices where B is reachable from A through a path of at least one edge.
+     */
+    template <typename Vertex, typename Index>
+    constexpr inline bit_matrix_graph<Vertex, Index> transitive_closure(const bit_matrix_graph<Vertex, Index>& graph) {
+        return transitive_closure(graph, util::unlimited_budget {}).second;
+    }
+
+
+    /**
+     * @ingroup Alg
+     * Finds all strongly connected components (cycles) in the given graph.
+     * Two vertices are in the same component if each is reachable from the other, so every component is found as the intersection of
+     * a row of the transitive closure with the corresponding row of its transpose.
+     *
+     * @param graph The graph to find the strongly connected components of.
+     * @param budget A @ref util::work_budget limiting the algorithm. If an lvalue is passed, the work performed is consumed from it.
+     *  Computing the transitive closure consumes work as described for @ref transitive_closure, and every vertex consumes one more unit of work afterwards.
+     * @param min_size Strongly connected components with a cycle length smaller than this value will be discarded.
+     * @return A pair of FINISHED or CANCELLED, depending on whether the algorithm finished before the budget was exhausted,
+     *  and a @ref util::jagged_array of components, each a group of vertices in order of vertex index.
+     *  Components are ordered by the index of their first vertex. If the algorithm was cancelled, only the components found so far are returned.
+     */
+    template <typename Vertex, typename Index, util::budget Budget>
+    constexpr inline auto strongly_connected_components(const bit_matrix_graph<Vertex, Index>& graph, Budget&& budget, std::size_t min_size = 0) {
+        util::jagged_array<Vertex*> result;
+
+        const auto [closure_status, closure] = transitive_closure(graph, budget);
+        if (closure_status == util::run_status::CANCELLED) return std::pair { util::run_status::CANCELLED, std::move(result) };
+
+        const auto transposed = closure.transposed();
+
+        util::dynamic_bitset assigned  { graph.num_vertices() };
+        util::dynamic_bitset component { graph.num_vertices() };
+
+
+        for (std::size_t v = 0; v < graph.num_vertices(); ++v) {
+            if (assigned.test(v)) continue;
+
+            component.clear();
+            component |= closure.row(v);
+            component &= transposed.row(v);
+            component.set(v);
+
+            assigned |= component;
+
+
+            if (component.count() >= min_size) {
+                result.add_group();
+                for (auto w : component.set_bits()) result.push_to_last(graph.vertex_at(w));
+            }
+
+            // Only cancel if there are vertices left, so a budget exhausted by the last vertex still finishes the algorithm.
+            if (!budget.consume() && v + 1 < graph.num_vertices()) return std::pair { util::run_status::CANCELLED, std::move(result) };
+        }
+
+
+        return std::pair { util::run_status::FINISHED, std::move(result) };
+    }
+
+
+    /**
+     * @ingroup Alg
+     * Equivalent to the budget overload of @ref strongly_connected_components for a @ref bit_matrix_graph, but without a budget.
+     *
+     * @param graph The graph to find the strongly connected components of.
+     * @param min_size Strongly connected components with a cycle length smaller than this value will be discarded.
+     * @return A @ref util::jagged_array of components, each a group of vertices in order of vertex index.
+     *  Components are ordered by the index of their first vertex.
+     */
+    template <typename Vertex, typename Index>
+    constexpr inline util::jagged_array<Vertex*> strongly_connected_components(const bit_matrix_graph<Vertex, Index>& graph, std::size_t min_size = 0) {
+        return strongly_connected_components(graph, util::unlimited_budget {}, min_size).second;
+    }
+}
@@ -0,0 +1,405 @@
+#pragma once
+
+#include <common.hpp>
+#include <graph/graph.hpp>
+#include <storage/storage_provider.hpp>
+#include <storage/default_storage_provider.hpp>
+#include <utility/edge_utils.hpp>
+#include <utility/vertex_index.hpp>
+#include <utility/work_budget.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+
+namespace graphle::alg {
+    /**
+     * @ingroup Alg
+     * Scoring function used to assign vertices to parts while streaming over the graph.
+     */
+    enum class partition_heuristic {
+        /**
+         * Linear Deterministic Greedy: maximizes |N(v) ∩ P| * (1 - |P| / C), where C is the maximum part size.
+         * (Stanton, I., Kliot, G. (2012). Streaming Graph Partitioning for Large Distributed Graphs. KDD '12, 1222–1230. doi:10.1145/2339530.2339722).
+         */
+        LINEAR_DETERMINISTIC_GREEDY,
+        /**
+         * Fennel: maximizes |N(v) ∩ P| - α * γ * |P|^(γ - 1).
+         * (Tsourakakis, C. et al. (2014). FENNEL: Streaming Graph Partitioning for Massive Scale Graphs. WSDM '14, 333–342. doi:10.1145/2556195.2556213).
+         */
+        FENNEL
+    };
+
+
+    /**
+     * @ingroup Alg
+     * Parameters for @ref partition_graph.
+     */
+    struct partition_options {
+        /** The scoring function used to assign vertices to parts. */
+        partition_heuristic heuristic = partition_heuristic::FENNEL;
+        /** Number of passes over the graph. Every pass after the first reassigns each vertex knowing the parts of all its neighbours. */
+        std::size_t num_passes = 1;
+        /** No part will contain more than ceil(max_imbalance * N / K) vertices. Must be at least 1. */
+        double max_imbalance = 1.1;
+        /** The exponent γ of the Fennel balance penalty. Ignored for other heuristics. */
+        double fennel_gamma = 1.5;
+    };
+
+
+    /**
+     * @ingroup Alg
+     * A single part of a @ref graph_partition, stored as a CSR (Compressed Sparse Row) subgraph with local vertex ids.
+     *
+     * Local ids [0, num_owned) are the vertices assigned to this part. Local ids [num_owned, vertices.size()) are ghost vertices:
+     * vertices assigned to a different part that are the target of an out edge of one of the owned vertices.
+     * The out edges of every owned vertex are stored in the CSR, with the targets given as local ids (ghosts included).
+     */
+    template <typename Vertex> struct graph_part {
+        /** The vertices of this part, indexed by local id. Owned vertices come first, followed by the ghost vertices. */
+        std::vector<Vertex> vertices;
+        /** The number of vertices owned by this part. */
+        std::size_t num_owned = 0;
+
+        /** The out edges of owned vertex i are the targets in [offsets[i], offsets[i + 1]). Contains num_owned + 1 elements. */
+        std::vector<std::size_t> offsets;
+        /** The local id of the target of every out edge of the owned vertices. */
+        std::vector<std::size_t> targets;
+
+        /** For every ghost vertex (in order of local id), the part that owns it. */
+        std::vector<std::size_t> ghost_owners;
+        /** For every ghost vertex (in order of local id), its local id within the part that owns it. */
+        std::vector<std::size_t> ghost_remote_ids;
+        /** Local ids of all owned vertices with at least one out edge to a ghost vertex, in ascending order. */
+        std::vector<std::size_t> boundary;
+
+
+        /** Returns the local ids of the targets of the out edges of the given owned vertex. */
+        [[nodiscard]] constexpr std::span<const std::size_t> out_neighbors(std::size_t local_id) const {
+            return std::span { targets }.subspan(offsets[local_id], offsets[local_id + 1] - offsets[local_id]);
+        }
+
+        [[nodiscard]] constexpr bool is_ghost(std::size_t local_id) const {
+            return local_id >= num_owned;
+        }
+
+        [[nodiscard]] constexpr std::size_t num_ghosts(void) const {
+            return vertices.size() - num_owned;
+        }
+    };
+
+
+    /**
+     * @ingroup Alg
+     * Result of @ref partition_graph.
+     *
+     * @tparam Vertex The vertex type of the partitioned graph.
+     * @tparam Index The @ref util::vertex_index used to assign a dense id to each vertex.
+     */
+    template <typename Vertex, typename Index> struct graph_partition {
+        /** Maps every vertex to a dense id in [0, N). */
+        Index index;
+        /** The part of every vertex, indexed by dense id. */
+        std::vector<std::size_t> labels;
+        /** The local id of every vertex within the part that owns it, indexed by dense id. */
+        std::vector<std::size_t> local_ids;
+        /** The parts of the graph. */
+        std::vector<graph_part<Vertex>> parts;
+        /** The number of edges whose endpoints are in different parts. */
+        std::size_t edge_cut = 0;
+
+
+        /** Returns the part the given vertex was assigned to. */
+        [[nodiscard]] constexpr std::size_t part_of(Vertex vertex) const {
+            return labels[index.index_of(vertex)];
+        }
+
+        /** Returns the local id of the given vertex within the part it was assigned to. */
+        [[nodiscard]] constexpr std::size_t local_id_of(Vertex vertex) const {
+            return local_ids[index.index_of(vertex)];
+        }
+    };
+
+
+    namespace detail {
+        /** Simple CSR adjacency over dense vertex ids, used internally by the partitioner. */
+        struct dense_adjacency {
+            std::vector<std::size_t> offsets;
+            std::vector<std::size_t> targets;
+
+            constexpr std::span<const std::size_t> operator[](std::size_t i) const {
+                return std::span { targets }.subspan(offsets[i], offsets[i + 1] - offsets[i]);
+            }
+        };
+
+
+        /** Constructs the transpose of the given adjacency. */
+        constexpr inline dense_adjacency transpose_adjacency(const dense_adjacency& adj) {
+            const std::size_t n = adj.offsets.size() - 1;
+            dense_adjacency result { .offsets = std::vector<std::size_t>(n + 1, 0), .targets = std::vector<std::size_t>(adj.targets.size()) };
+
+            for (auto target : adj.targets) ++result.offsets[target + 1];
+            for (std::size_t i = 0; i < n; ++i) result.offsets[i + 1] += result.offsets[i];
+
+            auto cursor = result.offsets;
+            for (std::size_t i = 0; i < n; ++i) {
+                for (auto target : adj[i]) result.targets[cursor[target]++] = i;
+            }
+
+            return result;
+        }
+    }
+
+
+    /**
+     * @ingroup Alg
+     *
+     * Partitions the vertices of the given graph into num_parts balanced parts while attempting to minimize the number of edges between parts,
+     * using a streaming heuristic (See @ref partition_heuristic). Vertices are streamed in the order returned by graph.get_vertices(),
+     * and each is assigned to the part with the highest score that is not yet full.
+     * For directed graphs both the out- and in-neighbours of a vertex are taken into account when scoring.
+     *
+     * Besides the label of every vertex, the result contains a CSR subgraph for each part, with ghost tables for the vertices owned by other parts
+     * and a list of the boundary vertices that have edges leaving the part. This allows processing each part independently (e.g. on its own thread),
+     * only exchanging data for the ghost and boundary vertices.
+     *
+     * Every pass consumes one unit of work from the given budget for every vertex, plus one for every neighbour it is scored against.
+     * The budget is only checked between passes, and the first pass is always completed, since every vertex must be assigned to a part.
+     * If the budget is exhausted before the last pass, the remaining passes are skipped and the partition found so far is returned.
+     *
+     * @param graph A graphle::graph to partition.
+     * @param num_parts The number of parts to split the graph into. Must be at least 1.
+     * @param budget A @ref util::work_budget limiting the number of passes. If an lvalue is passed, the work performed is consumed from it.
+     * @param options Additional parameters for the partitioner. See @ref partition_options.
+     * @param map_provider An optional storage-provider which can provide a unordered-map-like type for the algorithm to use. Used for the returned vertex index.
+     * @return A pair of FINISHED or CANCELLED, depending on whether every pass was performed before the budget was exhausted,
+     *  and a @ref graph_partition for the given graph.
+     *
+     * @graph_requires{
+     *  vertex_list_graph<G> &&
+     *  (
+     *      edge_list_graph<G> ||
+     *      out_edges_graph<G> ||
+     *      (non_directed_graph<G> && in_edges_graph<G>)
+     *  )
+     * }
+     */
+    template <
+        graph_ref G,
+        util::budget Budget,
+        store::storage_provider_ref<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>> PM
+            = store::default_provided_t<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>
+    > requires (
+        vertex_list_graph<G> &&
+        (edge_list_graph<G> || out_edges_graph<G> || (non_directed_graph<G> && in_edges_graph<G>))
+    ) inline auto partition_graph(
+        G&& graph,
+        std::size_t num_parts,
+        Budget&& budget,
+        const partition_options& options = {},
+        PM&& map_provider = store::get_default_storage_provider<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>()
+    ) {
+        using vertex = vertex_of<G>;
+        using index  = decltype(util::make_vertex_index(graph, GRAPHLE_FWD(map_provider)));
+
+        constexpr std::size_t unassigned = std::numeric_limits<std::size_t>::max();
+
+
+        graph_partition<vertex, index> result { .index = util::make_vertex_index(graph, GRAPHLE_FWD(map_provider)) };
+
+        const std::size_t n = result.index.size();
+        const std::size_t k = std::max<std::size_t>(num_parts, 1);
+
+
+        // Convert the graph to a dense CSR once, since every pass needs the neighbours of every vertex.
+        detail::dense_adjacency out { .offsets = { 0 } };
+        out.offsets.reserve(n + 1);
+
+        for (std::size_t i = 0; i < n; ++i) {
+            for (auto edge : util::out_edges(graph, result.index.vertex_at(i))) out.targets.push_back(result.index.index_of(edge.second));
+            out.offsets.push_back(out.targets.size());
+        }
+
+        // Out edges of non-directed graphs already contain both directions.
+        const detail::dense_adjacency in = graph_is_directed<G> ? detail::transpose_adjacency(out) : detail::dense_adjacency { .offsets = std::vector<std::size_t>(n + 1, 0) };
+
+
+        // Assign vertices to parts.
+        const std::size_t capacity = std::max<std::size_t>(std::size_t(std::ceil(options.max_imbalance * double(n) / double(k))), (n + k - 1) / k);
+        const double num_edges     = double(out.targets.size()) / (graph_is_directed<G> ? 1.0 : 2.0);
+        const double gamma         = options.fennel_gamma;
+        const double alpha         = n == 0 ? 0.0 : num_edges * std::pow(double(k), gamma - 1.0) / std::pow(double(n), gamma);
+
+        std::vector<std::size_t> part_sizes(k, 0);
+        std::vector<std::size_t> neighbor_counts(k, 0);
+        std::vector<std::size_t> touched_parts;
+        result.labels.assign(n, unassigned);
+
+
+        const std::size_t num_passes = std::max<std::size_t>(options.num_passes, 1);
+        util::run_status status      = util::run_status::FINISHED;
+
+        for (std::size_t pass = 0; pass < num_passes; ++pass) {
+            std::size_t work = n;
+
+            for (std::size_t v = 0; v < n; ++v) {
+                if (result.labels[v] != unassigned) --part_sizes[result.labels[v]];
+                work += out[v].size() + in[v].size();
+
+
+                for (auto neighbors : { out[v], in[v] }) {
+                    for (auto w : neighbors) {
+                        const auto part = result.labels[w];
+                        if (part == unassigned || w == v) continue;
+
+                        if (neighbor_counts[part]++ == 0) touched_parts.push_back(part);
+                    }
+                }
+
+
+                auto score = [&] (std::size_t part) {
+                    const double count = double(neighbor_counts[part]);
+                    const double size  = double(part_sizes[part]);
+
+                    if (options.heuristic == partition_heuristic::LINEAR_DETERMINISTIC_GREEDY) {
+                        return count * (1.0 - size / double(capacity));
+                    } else {
+                        return count - alpha * gamma * std::pow(size, gamma - 1.0);
+                    }
+                };
+
+
+                // Ties are broken in favour of the smaller part.
+                std::size_t best_part  = unassigned;
+                double      best_score = -std::numeric_limits<double>::infinity();
+
+                for (std::size_t part = 0; part < k; ++part) {
+                    if (part_sizes[part] >= capacity) continue;
+
+                    const double s = score(part);
+                    if (best_part == unassigned || s > best_score || (s == best_score && part_sizes[part] < part_sizes[best_part])) {
+                        best_part  = part;
+                        best_score = s;
+                    }
+                }
+
+
+                result.labels[v] = best_part;
+                ++part_sizes[best_part];
+
+                for (auto part : touched_parts) neighbor_counts[part] = 0;
+                touched_parts.clear();
+            }
+
+            // Every vertex has been assigned a part after the first pass, so later passes can be skipped while still returning a valid partition.
+            if (!budget.consume(work) && pass + 1 < num_passes) {
+                status = util::run_status::CANCELLED;
+                break;
+            }
+        }
+
+
+        // Assign local ids to owned vertices.
+        result.parts.resize(k);
+        result.local_ids.resize(n);
+
+        for (std::size_t v = 0; v < n; ++v) {
+            auto& part = result.parts[result.labels[v]];
+
+            result.local_ids[v] = part.vertices.size();
+            part.vertices.push_back(result.index.vertex_at(v));
+        }
+
+        for (auto& part : result.parts) part.num_owned = part.vertices.size();
+
+
+        // Construct the CSR of every part. Ghost ids are tracked in a table indexed by dense id, which is reset after each part.
+        std::vector<std::size_t> ghost_ids(n, unassigned);
+        std::vector<std::size_t> ghosts;
+
+        for (std::size_t p = 0; p < k; ++p) {
+            auto& part = result.parts[p];
+
+            part.offsets.reserve(part.num_owned + 1);
+            part.offsets.push_back(0);
+
+            for (std::size_t local = 0; local < part.num_owned; ++local) {
+                const std::size_t v = result.index.index_of(part.vertices[local]);
+                bool is_boundary    = false;
+
+                for (auto w : out[v]) {
+                    if (result.labels[w] == p) {
+                        part.targets.push_back(result.local_ids[w]);
+                        continue;
+                    }
+
+
+                    if (ghost_ids[w] == unassigned) {
+                        ghost_ids[w] = part.vertices.size();
+                        ghosts.push_back(w);
+
+                        part.vertices.push_back(result.index.vertex_at(w));
+                        part.ghost_owners.push_back(result.labels[w]);
+                        part.ghost_remote_ids.push_back(result.local_ids[w]);
+                    }
+
+                    part.targets.push_back(ghost_ids[w]);
+                    is_boundary = true;
+                    ++result.edge_cut;
+                }
+
+                part.offsets.push_back(part.targets.size());
+                if (is_boundary) part.boundary.push_back(local);
+            }
+
+            for (auto w : ghosts) ghost_ids[w] = unassigned;
+            ghosts.clear();
+        }
+
+        // Every cut edge of a non-directed graph is seen from both of its endpoints.
+        if constexpr (!graph_is_directed<G>) result.edge_cut /= 2;
+
+
+        return std::pair { status, std::move(result) };
+    }
+
+
+    /**
+     * @ingroup Alg
+     * Equivalent to the budget overload of @ref partition_graph, but without a budget.
+     *
+     * @param graph A graphle::graph to partition.
+     * @param num_parts The number of parts to split the graph into. Must be at least 1.
+     * @param options Additional parameters for the partitioner. See @ref partition_options.
+     * @param map_provider An optional storage-provider which can provide a unordered-map-like type for the algorithm to use. Used for the returned vertex index.
+     * @return A @ref graph_partition for the given graph.
+     *
+     * @graph_requires{
+     *  vertex_list_graph<G> &&
+     *  (
+     *      edge_list_graph<G> ||
+     *      out_edges_graph<G> ||
+     *      (non_directed_graph<G> && in_edges_graph<G>)
+     *  )
+     * }
+     */
+    template <
+        graph_ref G,
+        store::storage_provider_ref<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>> PM
+            = store::default_provided_t<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>
+    > requires (
+        vertex_list_graph<G> &&
+        (edge_list_graph<G> || out_edges_graph<G> || (non_directed_graph<G> && in_edges_graph<G>))
+    ) inline auto partition_graph(
+        G&& graph,
+        std::size_t num_parts,
+        const partition_options& options = {},
+        PM&& map_provider = store::get_default_storage_provider<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>()
+    ) {
+        return partition_graph(graph, num_parts, util::unlimited_budget {}, options, GRAPHLE_FWD(map_provider)).second;
+    }
+}
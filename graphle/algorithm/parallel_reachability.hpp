@@ -0,0 +1,303 @@
+#pragma once
+
+#include <common.hpp>
+#include <graph/graph.hpp>
+#include <storage/storage_provider.hpp>
+#include <storage/default_storage_provider.hpp>
+#include <utility/atomic_bitset.hpp>
+#include <utility/dynamic_bitset.hpp>
+#include <utility/edge_utils.hpp>
+#include <utility/thread_pool.hpp>
+#include <utility/vertex_index.hpp>
+#include <utility/work_budget.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace graphle::alg {
+    /**
+     * @ingroup Alg
+     * The set of vertices found by @ref parallel_reachable_vertices, stored as a bitmap over the dense indices of the vertices of the graph.
+     *
+     * @tparam Index The type of the dense vertex index of the graph (See @ref util::make_dense_vertex_index).
+     */
+    template <typename Index> class reachable_set {
+    public:
+        using vertex_type = decltype(std::declval<const Index&>().vertex_at(0));
+
+
+        constexpr reachable_set(Index index, util::dynamic_bitset visited) : index(std::move(index)), visited(std::move(visited)) {}
+
+
+        [[nodiscard]] constexpr bool contains(vertex_type vertex) const {
+            const std::size_t i = index.find(vertex);
+            return i != Index::npos && visited.test(i);
+        }
+
+        /** Returns the reachable vertices, ordered by their index. */
+        [[nodiscard]] constexpr std::vector<vertex_type> vertices(void) const {
+            std::vector<vertex_type> result;
+            result.reserve(size());
+
+            for (std::size_t i : visited.set_bits()) result.push_back(index.vertex_at(i));
+            return result;
+        }
+
+        /** Returns the number of reachable vertices. */
+        [[nodiscard]] constexpr std::size_t size(void) const { return visited.count(); }
+
+        /** Returns the bitmap of reachable vertices. Bit i is set if the vertex with index i in @ref get_index is reachable. */
+        [[nodiscard]] constexpr const util::dynamic_bitset& get_visited(void) const { return visited; }
+        [[nodiscard]] constexpr const Index& get_index(void) const { return index; }
+    private:
+        Index index;
+        util::dynamic_bitset visited;
+    };
+
+
+    namespace detail {
+        /** Deque of chunks of pending vertex indices of one worker. The owner takes chunks from the back, other workers steal from the front. */
+        struct alignas(64) reachability_queue {
+            std::mutex mutex;
+            std::deque<std::vector<std::size_t>> chunks;
+        };
+    }
+
+
+    /**
+     * @ingroup Alg
+     * Finds all vertices reachable from the given roots, using the threads of the given pool. The order in which vertices are visited is unspecified.
+     * The search is cancelled once the given budget is exhausted, e.g. when its deadline has passed or a stop is requested through its stop token.
+     * See @ref util::work_budget. Every visited vertex consumes one unit of work, plus one for every edge visited from it.
+     *
+     * Every worker keeps a stack of pending vertices. Once it grows past twice the chunk size, its oldest chunk_size vertices are moved
+     * into a chunk in the worker's deque, from which idle workers steal chunks. Vertices are claimed with an atomic bitmap over their dense indices
+     * (their ids if the graph has vertex ids, see @ref util::make_dense_vertex_index), so every vertex is visited exactly once.
+     *
+     * @param graph A graphle::graph to search. The graph must support concurrent calls to its getters.
+     * @param roots A range of vertices to start the search from.
+     * @param pool The thread pool to run the search on.
+     * @param budget A @ref util::work_budget limiting the search. If an lvalue is passed, the work performed is consumed from it.
+     *  Workers consume their work in batches of roughly chunk_size units, so the search may exceed the budget by a batch for every worker.
+     * @param chunk_size The number of pending vertices moved to a worker's deque at once. Smaller chunks balance the load better, but cause more contention.
+     * @param map_provider An optional storage-provider which can provide a unordered-map-like type for the algorithm to use. Unused if the graph has vertex ids.
+     * @return A std::pair of the @ref util::run_status (FINISHED if all reachable vertices were found, or CANCELLED if the budget was exhausted first)
+     *  and a @ref reachable_set containing the roots and every vertex reachable from them. If the search was cancelled, the set contains only the vertices found before it.
+     *
+     * @graph_requires{
+     *  vertex_list_graph<G> &&
+     *  (
+     *      out_edges_graph<G> ||
+     *      (non_directed_graph<G> && in_edges_graph<G>)
+     *  )
+     * }
+     */
+    template <
+        graph_ref G,
+        rng::input_range R,
+        util::budget Budget,
+        store::storage_provider_ref<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>> PM
+            = store::default_provided_t<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>
+    > requires (
+        vertex_list_graph<G> &&
+        (out_edges_graph<G> || (non_directed_graph<G> && in_edges_graph<G>)) &&
+        std::convertible_to<rng::range_reference_t<R>, vertex_of<G>>
+    ) inline auto parallel_reachable_vertices(
+        G&& graph,
+        R&& roots,
+        util::thread_pool& pool,
+        Budget&& budget,
+        std::size_t chunk_size = 256,
+        PM&& map_provider = store::get_default_storage_provider<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>()
+    ) {
+        auto index = util::make_dense_vertex_index(graph, GRAPHLE_FWD(map_provider));
+        util::atomic_bitset visited { index.size() };
+
+        const std::size_t num_workers = pool.size();
+        auto queues = std::make_unique<detail::reachability_queue[]>(num_workers);
+
+        // Termination: a worker is busy while it holds vertices. Chunks are only published by busy workers,
+        // so once no worker is busy and no chunks are published, no more work can appear.
+        // Both counts are packed into a single atomic (busy workers in the high half, published chunks in the low half),
+        // so an idle worker observes them at the same moment, and taking a chunk moves it from published to busy in a single update.
+        // Every published chunk holds at least one vertex, so the low half cannot overflow for graphs of fewer than 2^32 vertices.
+        constexpr std::uint64_t one_busy_worker = std::uint64_t { 1 } << 32, one_published_chunk = 1;
+        std::atomic<std::uint64_t> outstanding_work = 0;
+
+        // The budget is not thread-safe, so workers consume their work from it in batches while holding a lock.
+        std::mutex budget_mutex;
+        std::atomic<bool> exhausted = false;
+
+
+        // Distribute the roots over the deques of all workers.
+        {
+            std::size_t next_queue = 0;
+            std::vector<std::size_t> chunk;
+
+            auto publish = [&] {
+                queues[next_queue++ % num_workers].chunks.push_back(std::move(chunk));
+                outstanding_work.fetch_add(one_published_chunk);
+                chunk.clear();
+            };
+
+            for (vertex_of<G> root : roots) {
+                const std::size_t i = index.index_of(root);
+
+                if (visited.test_and_set(i)) chunk.push_back(i);
+                if (chunk.size() == chunk_size) publish();
+            }
+
+            if (!chunk.empty()) publish();
+        }
+
+
+        auto take_chunk = [&] (std::size_t queue, bool from_back, std::vector<std::size_t>& out) {
+            std::lock_guard lock { queues[queue].mutex };
+            auto& chunks = queues[queue].chunks;
+
+            if (chunks.empty()) return false;
+
+            if (from_back) {
+                out = std::move(chunks.back());
+                chunks.pop_back();
+            } else {
+                out = std::move(chunks.front());
+                chunks.pop_front();
+            }
+
+            // Become busy in the same update that unpublishes the chunk, so there is no moment where the work is in neither.
+            outstanding_work.fetch_add(one_busy_worker - one_published_chunk);
+            return true;
+        };
+
+
+        pool.run(num_workers, [&] (std::size_t, std::size_t worker) {
+            std::vector<std::size_t> pending;
+            std::size_t work = 0;
+
+
+            auto consume_work = [&] {
+                if constexpr (!std::is_same_v<std::remove_cvref_t<Budget>, util::unlimited_budget>) {
+                    std::lock_guard lock { budget_mutex };
+                    if (!budget.consume(work)) exhausted.store(true, std::memory_order_relaxed);
+                }
+
+                work = 0;
+            };
+
+
+            auto visit = [&] (std::size_t i) {
+                auto push = [&] (vertex_of<G> target) {
+                    const std::size_t j = index.index_of(target);
+                    if (visited.test_and_set(j)) pending.push_back(j);
+                };
+
+                const auto vertex = index.vertex_at(i);
+
+                util::for_each_out_edge(graph, vertex, [&] (const edge_of<G>& edge) { push(edge.second); ++work; });
+
+                if (++work >= chunk_size) consume_work();
+
+
+                // Share the oldest pending vertices, since these are the least likely to be in this worker's cache.
+                if (pending.size() >= 2 * chunk_size) {
+                    std::vector<std::size_t> chunk { pending.begin(), pending.begin() + std::ptrdiff_t(chunk_size) };
+                    pending.erase(pending.begin(), pending.begin() + std::ptrdiff_t(chunk_size));
+
+                    std::lock_guard lock { queues[worker].mutex };
+                    queues[worker].chunks.push_back(std::move(chunk));
+                    outstanding_work.fetch_add(one_published_chunk);
+                }
+            };
+
+
+            while (true) {
+                if (exhausted.load(std::memory_order_relaxed)) return;
+
+                bool found = take_chunk(worker, true, pending);
+
+                for (std::size_t victim = 1; !found && victim < num_workers; ++victim) {
+                    found = take_chunk((worker + victim) % num_workers, false, pending);
+                }
+
+
+                if (!found) {
+                    if (outstanding_work.load() == 0) return;
+
+                    std::this_thread::yield();
+                    continue;
+                }
+
+
+                while (!pending.empty()) {
+                    // A worker that gives up on its pending vertices stays busy, which marks the result as incomplete.
+                    if (exhausted.load(std::memory_order_relaxed)) return;
+
+                    const std::size_t i = pending.back();
+                    pending.pop_back();
+
+                    visit(i);
+                }
+
+                consume_work();
+                outstanding_work.fetch_sub(one_busy_worker);
+            }
+        });
+
+
+        // Even if the budget was exhausted, the result is complete if no work was left at that point.
+        const bool complete = (outstanding_work.load() == 0);
+
+        return std::pair {
+            complete ? util::run_status::FINISHED : util::run_status::CANCELLED,
+            reachable_set { std::move(index), visited.to_dynamic_bitset() }
+        };
+    }
+
+
+    /**
+     * @ingroup Alg
+     * Equivalent to the budget overload of @ref parallel_reachable_vertices, but without a budget.
+     *
+     * @param graph A graphle::graph to search. The graph must support concurrent calls to its getters.
+     * @param roots A range of vertices to start the search from.
+     * @param pool The thread pool to run the search on.
+     * @param chunk_size The number of pending vertices moved to a worker's deque at once. Smaller chunks balance the load better, but cause more contention.
+     * @param map_provider An optional storage-provider which can provide a unordered-map-like type for the algorithm to use. Unused if the graph has vertex ids.
+     * @return A @ref reachable_set containing the roots and every vertex reachable from them.
+     *
+     * @graph_requires{
+     *  vertex_list_graph<G> &&
+     *  (
+     *      out_edges_graph<G> ||
+     *      (non_directed_graph<G> && in_edges_graph<G>)
+     *  )
+     * }
+     */
+    template <
+        graph_ref G,
+        rng::input_range R,
+        store::storage_provider_ref<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>> PM
+            = store::default_provided_t<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>
+    > requires (
+        vertex_list_graph<G> &&
+        (out_edges_graph<G> || (non_directed_graph<G> && in_edges_graph<G>)) &&
+        std::convertible_to<rng::range_reference_t<R>, vertex_of<G>>
+    ) inline auto parallel_reachable_vertices(
+        G&& graph,
+        R&& roots,
+        util::thread_pool& pool,
+        std::size_t chunk_size = 256,
+        PM&& map_provider = store::get_default_storage_provider<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>()
+    ) {
+        return parallel_reachable_vertices(graph, GRAPHLE_FWD(roots), pool, util::unlimited_budget {}, chunk_size, GRAPHLE_FWD(map_provider)).second;
+    }
+}
@@ -0,0 +1,212 @@
+#pragma once
+
+#include <common.hpp>
+#include <graph/static_graph.hpp>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <optional>
+
+
+// Algorithms on static_graph. These only use fixed-size std::arrays indexed by vertex for their storage,
+// so unlike the algorithms for graphle::graph, they can be evaluated in constant expressions.
+namespace graphle::alg {
+    /**
+     * @ingroup Alg
+     * Result of @ref strongly_connected_components for a @ref static_graph.
+     * @tparam N The number of vertices in the graph.
+     */
+    template <std::size_t N> struct static_components {
+        /** The component of every vertex, indexed by vertex. Components are numbered in reverse topological order. */
+        std::array<std::size_t, N> component_of {};
+        /** The number of vertices in every component, indexed by component. Only the first num_components elements are used. */
+        std::array<std::size_t, N> component_sizes {};
+        /** The number of strongly connected components in the graph. */
+        std::size_t num_components = 0;
+
+
+        /** Returns true if the given vertices are part of the same strongly connected component. */
+        [[nodiscard]] constexpr bool same_component(std::size_t a, std::size_t b) const {
+            return component_of[a] == component_of[b];
+        }
+
+        /** Returns the number of components consisting of at least min_size vertices. */
+        [[nodiscard]] constexpr std::size_t count_components(std::size_t min_size = 0) const {
+            return std::size_t(std::count_if(component_sizes.begin(), component_sizes.begin() + std::ptrdiff_t(num_components), [&] (auto size) { return size >= min_size; }));
+        }
+    };
+
+
+    /**
+     * @ingroup Alg
+     *
+     * Finds all strongly connected components (cycles) in the given static graph using Tarjan's algorithm
+     * (Tarjan, R. (1972). Depth-First Search and Linear Graph Algorithms. SIAM Journal on Computing, 1(2), 146–160. doi:10.1137/0201010).
+     * This overload uses only fixed-size storage and can be used in constant expressions, e.g.:
+     * ~~~
+     * static_assert(alg::strongly_connected_components(system_dependencies).count_components(2) == 0, "Cyclic system dependency!");
+     * ~~~
+     *
+     * @param graph A static_graph to find the strongly connected components of.
+     * @return A @ref static_components object containing the component of every vertex.
+     */
+    template <std::size_t N, std::size_t E>
+    constexpr inline static_components<N> strongly_connected_components(const static_graph<N, E>& graph) {
+        constexpr std::size_t unvisited = std::numeric_limits<std::size_t>::max();
+
+        static_components<N> result;
+
+        std::array<std::size_t, N> index {}, low_link {};
+        std::array<bool, N> stacked {};
+        std::array<std::size_t, N> stack {};
+        std::size_t stack_size = 0, next_index = 0;
+
+        // Vertex and position in its out edges for every frame of the simulated call stack.
+        std::array<std::size_t, N> call_vertex {}, call_edge {};
+        std::size_t call_size = 0;
+
+        index.fill(unvisited);
+
+
+        auto enter = [&] (std::size_t v) {
+            index[v] = low_link[v] = next_index++;
+            stack[stack_size++] = v;
+            stacked[v] = true;
+
+            call_vertex[call_size] = v;
+            call_edge[call_size]   = 0;
+            ++call_size;
+        };
+
+
+        for (std::size_t root = 0; root < N; ++root) {
+            if (index[root] != unvisited) continue;
+            enter(root);
+
+
+            while (call_size > 0) {
+                const std::size_t v = call_vertex[call_size - 1];
+
+                if (call_edge[call_size - 1] < graph.out_degree(v)) {
+                    const std::size_t w = graph.out_neighbors(v)[call_edge[call_size - 1]++];
+
+                    if (index[w] == unvisited) enter(w);
+                    else if (stacked[w]) low_link[v] = std::min(low_link[v], index[w]);
+
+                    continue;
+                }
+
+
+                if (--call_size > 0) {
+                    const std::size_t parent = call_vertex[call_size - 1];
+                    low_link[parent] = std::min(low_link[parent], low_link[v]);
+                }
+
+
+                if (low_link[v] == index[v]) {
+                    std::size_t w;
+
+                    do {
+                        w = stack[--stack_size];
+                        stacked[w] = false;
+
+                        result.component_of[w] = result.num_components;
+                        ++result.component_sizes[result.num_components];
+                    } while (w != v);
+
+                    ++result.num_components;
+                }
+            }
+        }
+
+
+        return result;
+    }
+
+
+    /**
+     * @ingroup Alg
+     * Sorts the vertices of the given static graph topologically using Kahn's algorithm
+     * (Kahn, A. B. (1962). Topological sorting of large networks. Communications of the ACM, 5(11), 558–562. doi:10.1145/368996.369025),
+     * such that for every edge [A, B], A comes before B. Can be used in constant expressions.
+     *
+     * @param graph A static_graph to sort.
+     * @return An array of all vertices in topological order, or std::nullopt if the graph contains a cycle.
+     */
+    template <std::size_t N, std::size_t E>
+    constexpr inline std::optional<std::array<std::size_t, N>> topological_sort(const static_graph<N, E>& graph) {
+        std::array<std::size_t, N> in_degree {};
+        for (auto target : graph.targets) ++in_degree[target];
+
+
+        // The result array doubles as the queue of vertices without remaining in edges.
+        std::array<std::size_t, N> order {};
+        std::size_t head = 0, tail = 0;
+
+        for (std::size_t v = 0; v < N; ++v) {
+            if (in_degree[v] == 0) order[tail++] = v;
+        }
+
+        while (head < tail) {
+            for (auto w : graph.out_neighbors(order[head++])) {
+                if (--in_degree[w] == 0) order[tail++] = w;
+            }
+        }
+
+
+        if (tail != N) return std::nullopt;
+        return order;
+    }
+
+
+    /**
+     * @ingroup Alg
+     * Returns true if the given static graph contains no cycles (including self-loops). Can be used in constant expressions.
+     */
+    template <std::size_t N, std::size_t E>
+    constexpr inline bool is_acyclic(const static_graph<N, E>& graph) {
+        return topological_sort(graph).has_value();
+    }
+
+
+    /**
+     * @ingroup Alg
+     * Returns the set of vertices reachable from the given root vertex (including the root itself). Can be used in constant expressions.
+     *
+     * @param graph A static_graph to search.
+     * @param root The vertex to start the search from.
+     * @return An array where element i is true if vertex i is reachable from the root.
+     */
+    template <std::size_t N, std::size_t E>
+    constexpr inline std::array<bool, N> reachable_vertices(const static_graph<N, E>& graph, std::size_t root) {
+        std::array<bool, N> seen {};
+        std::array<std::size_t, N> pending {};
+        std::size_t num_pending = 0;
+
+        pending[num_pending++] = root;
+        seen[root] = true;
+
+        while (num_pending > 0) {
+            for (auto w : graph.out_neighbors(pending[--num_pending])) {
+                if (!seen[w]) {
+                    seen[w] = true;
+                    pending[num_pending++] = w;
+                }
+            }
+        }
+
+        return seen;
+    }
+
+
+    /**
+     * @ingroup Alg
+     * Returns true if there is a path from vertex from to vertex to in the given static graph. Every vertex is reachable from itself.
+     * Can be used in constant expressions.
+     */
+    template <std::size_t N, std::size_t E>
+    constexpr inline bool is_reachable(const static_graph<N, E>& graph, std::size_t from, std::size_t to) {
+        return reachable_vertices(graph, from)[to];
+    }
+}
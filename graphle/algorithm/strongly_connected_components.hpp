@@ -7,34 +7,242 @@
 #include <storage/default_storage_provider.hpp>
 #include <storage/storage_provider_helpers.hpp>
 #include <utility/storage_utils.hpp>
+#include <utility/jagged_array.hpp>
+#include <utility/jagged_array_output_iterator.hpp>
 #include <utility/vec_of_vecs_output_iterator.hpp>
+#include <utility/prefetch.hpp>
+#include <utility/work_budget.hpp>
 
+#include <algorithm>
 #include <concepts>
 #include <iterator>
 #include <limits>
+#include <utility>
 
 
 namespace graphle::alg {
     namespace detail {
-        template <graph_ref G> using out_edge_range_t = decltype(util::out_edges(std::declval<G>(), std::declval<vertex_of<G>>()));
+        template <graph_ref G> using out_neighbor_range_t = decltype(util::out_neighbors(std::declval<G>(), std::declval<vertex_of<G>>()));
 
 
+        /**
+         * Per-vertex state of Tarjan's algorithm.
+         * The neighbour iterator may refer to the neighbour range stored in the same object (e.g. for transforming views),
+         * so copying the data recreates the iterator at the same position within the new copy of the range.
+         */
         template <graph_ref G> struct tarjan_vertex_data {
             tarjan_vertex_data(std::size_t index, G& graph, vertex_of<G> vertex) :
                 index(index),
                 low_link(index),
                 stacked(true),
-                edges(util::out_edges(graph, vertex)),
-                edge_iterator(rng::begin(edges))
+                neighbors(util::out_neighbors(graph, vertex)),
+                neighbor_iterator(rng::begin(neighbors)),
+                neighbor_position(0)
             {}
 
+            tarjan_vertex_data(const tarjan_vertex_data& other) :
+                index(other.index),
+                low_link(other.low_link),
+                stacked(other.stacked),
+                neighbors(other.neighbors),
+                neighbor_iterator(rng::next(rng::begin(neighbors), other.neighbor_position)),
+                neighbor_position(other.neighbor_position)
+            {}
+
+            tarjan_vertex_data& operator=(const tarjan_vertex_data&) = delete;
+
+
+            void next_neighbor(void) {
+                ++neighbor_iterator;
+                ++neighbor_position;
+            }
+
 
             std::size_t index;
             std::size_t low_link;
             bool stacked;
 
-            out_edge_range_t<G> edges;
-            rng::iterator_t<out_edge_range_t<G>> edge_iterator;
+            out_neighbor_range_t<G> neighbors;
+            rng::iterator_t<out_neighbor_range_t<G>> neighbor_iterator;
+            std::size_t neighbor_position;
+        };
+
+
+        /** An output iterator whose elements are output iterators of vertices, e.g. @ref util::jagged_array_output_iterator. */
+        template <typename T, typename Vertex> concept nested_output_iterator =
+            std::weakly_incrementable<T> &&
+            std::output_iterator<std::remove_cvref_t<std::iter_reference_t<T>>, Vertex>;
+
+        /**
+         * State of Tarjan's algorithm, which can be run in steps of a limited amount of work and continued later.
+         * The state refers to the range of vertices stored within itself, so it cannot be copied or moved.
+         *
+         * @tparam G The type of the graph, as used for the per-vertex data in the map.
+         * @tparam Target The type of the output iterator. If this is a reference type, the iterator is stored by reference.
+         * @tparam CallStack, LowStack, Data The storage types, as returned by their storage-providers.
+         */
+        template <graph_ref G, typename Target, typename CallStack, typename LowStack, typename Data>
+        class tarjan_state {
+        public:
+            using graph_type  = std::remove_reference_t<G>;
+            using vertex_type = vertex_of<G>;
+
+
+            tarjan_state(graph_type& graph, Target&& target, std::size_t min_size, CallStack&& call_stack, LowStack&& low_stack, Data&& data) :
+                graph(&graph),
+                target(GRAPHLE_FWD(target)),
+                min_size(min_size),
+                call_stack(GRAPHLE_FWD(call_stack)),
+                low_stack(GRAPHLE_FWD(low_stack)),
+                data(GRAPHLE_FWD(data)),
+                vertices(graph.get_vertices()),
+                vertex_iterator(rng::begin(vertices))
+            {}
+
+            tarjan_state(const tarjan_state&) = delete;
+            tarjan_state& operator=(const tarjan_state&) = delete;
+
+
+            /**
+             * Continues the algorithm until it finishes or the given budget is exhausted.
+             * Every step of the algorithm consumes one unit of work, plus one for every edge visited during it.
+             * At least one step is performed on every call, even if the budget is already exhausted.
+             *
+             * @param budget A @ref util::work_budget or @ref util::unlimited_budget. If an lvalue is passed, the work performed is consumed from it.
+             * @return FINISHED if all components have been written to the output iterator, CANCELLED if the budget was exhausted because of a stop request,
+             *  or SUSPENDED otherwise. Running the algorithm after it has finished or was cancelled has no effect.
+             */
+            template <util::budget Budget> util::run_status run(Budget&& budget) {
+                if (status != util::run_status::SUSPENDED) return status;
+
+                bool exhausted = false;
+                std::size_t work = 0;
+
+                while (true) {
+                    // Look for the next root before suspending, so that a budget exhausted by the step completing the last component
+                    // still results in FINISHED rather than a suspended (or cancelled) algorithm that has nothing left to do.
+                    if (rng::empty(call_stack)) {
+                        for (/* no init */; vertex_iterator != rng::end(vertices) && data.contains(*vertex_iterator); ++vertex_iterator) ++work;
+
+                        if (vertex_iterator == rng::end(vertices)) {
+                            budget.consume(work);
+                            return status = util::run_status::FINISHED;
+                        }
+
+                        call_stack.push_back(*vertex_iterator);
+                        ++vertex_iterator;
+                    }
+
+                    if (exhausted) {
+                        budget.consume(work);
+                        if (budget.cancelled()) status = util::run_status::CANCELLED;
+                        return status;
+                    }
+
+                    ++work;
+                    step(work);
+                    exhausted = !budget.consume(std::exchange(work, 0));
+                }
+            }
+
+
+            [[nodiscard]] util::run_status get_status(void) const { return status; }
+            [[nodiscard]] bool finished(void) const { return status != util::run_status::SUSPENDED; }
+        private:
+            using vertex_range_t = decltype(std::declval<graph_type&>().get_vertices());
+
+            graph_type* graph;
+            Target target;
+            std::size_t min_size;
+
+            CallStack call_stack;
+            LowStack low_stack;
+            Data data;
+            std::size_t index = 0;
+
+            vertex_range_t vertices;
+            rng::iterator_t<vertex_range_t> vertex_iterator;
+
+            util::run_status status = util::run_status::SUSPENDED;
+
+
+            /** Takes a vertex from the call stack and visits its neighbours until one of them has to be visited first. Adds the number of visited edges to work. */
+            void step(std::size_t& work) {
+                auto v = util::take_back(call_stack);
+
+                if (!data.contains(v)) {
+                    data.emplace(v, tarjan_vertex_data<G> { index++, *graph, v });
+                    low_stack.push_back(v);
+                } else {
+                    // Returning from the neighbour the iterator points at, so its low-link value is final.
+                    auto& vd = data.at(v);
+                    vd.low_link = std::min(vd.low_link, data.at(*vd.neighbor_iterator).low_link);
+                    vd.next_neighbor();
+                }
+
+
+                auto& vd = data.at(v);
+                auto& it = vd.neighbor_iterator;
+
+                for (/* no init */; it != rng::end(vd.neighbors) && data.contains(*it); vd.next_neighbor()) {
+                    // The algorithm descends into the first unvisited neighbour, which requires its neighbour list,
+                    // so load neighbours a few positions ahead while the current ones are being looked up.
+                    if constexpr (contiguous_out_neighbors_graph<G> && util::default_prefetch_distance > 0) {
+                        const std::size_t ahead = vd.neighbor_position + util::default_prefetch_distance;
+                        if (ahead < rng::size(vd.neighbors)) util::prefetch(vd.neighbors[ahead]);
+                    }
+
+                    auto& wd = data.at(*it);
+                    if (wd.stacked) vd.low_link = std::min(vd.low_link, wd.index);
+
+                    ++work;
+                }
+
+
+                if (it != rng::end(vd.neighbors)) {
+                    call_stack.push_back(v);
+                    call_stack.push_back(*it);
+
+                    ++work;
+                    return;
+                }
+
+
+                if (vd.low_link == vd.index) {
+                    // Output iterators are not guaranteed to be dereferencable multiple times for the same element,
+                    // so only dereference it if we're actually going to output an SCC.
+                    const bool should_output = min_size < 2 || [&] {
+                        std::size_t count = 1;
+
+                        for (auto w : low_stack | views::reverse) {
+                            if (vertex_compare_of<G>{}(v, w)) break;
+                            else ++count;
+                        }
+
+                        return count >= min_size;
+                    } ();
+
+
+                    vertex_type w;
+
+                    auto unstack = [&] {
+                        w = util::take_back(low_stack);
+                        data.at(w).stacked = false;
+                        return w;
+                    };
+
+
+                    if (should_output) {
+                        decltype(auto) scc_target = *target++;
+
+                        do *scc_target++ = unstack();
+                        while (!vertex_compare_of<G>{}(v, w));
+                    } else {
+                        do unstack();
+                        while (!vertex_compare_of<G>{}(v, w));
+                    }
+                }
+            }
         };
     }
 
@@ -48,6 +256,8 @@ namespace graphle::alg {
      * https://stackoverflow.com/a/62006383
      *
      * This overload outputs its data into the provided output iterator.
+     * For every strongly connected component, the output iterator is incremented and the vertices of the component
+     * are written to the output iterator obtained by dereferencing it (i.e. *target++).
      *
      * @param graph A graphle::graph to find the strongly connected components of.
      * @param output An output iterator with a value type that is itself an output iterator, into which vertices can be pushed.
@@ -79,8 +289,7 @@ namespace graphle::alg {
     > requires (
         vertex_list_graph<G> &&
         (edge_list_graph<G> || out_edges_graph<G>) &&
-        std::output_iterator<std::remove_cvref_t<Target>, typename std::remove_cvref_t<Target>::value_type> &&
-        std::output_iterator<typename std::remove_cvref_t<Target>::value_type, vertex_of<G>>
+        detail::nested_output_iterator<std::remove_cvref_t<Target>, vertex_of<G>>
     ) constexpr inline void strongly_connected_components(
         G&& graph,
         Target&& target,
@@ -89,86 +298,130 @@ namespace graphle::alg {
         PVM&& min_stack_provider = store::get_default_storage_provider<store::storage_type::VECTOR, vertex_of<G>>(),
         PM&&  map_provider       = store::get_default_storage_provider<store::storage_type::UNORDERED_MAP, vertex_of<G>, detail::tarjan_vertex_data<G>, vertex_hash_of<G>, vertex_compare_of<G>>()
     ) {
-        decltype(auto) call_stack = stack_provider();
-        decltype(auto) low_stack  = min_stack_provider();
-        decltype(auto) data       = map_provider();
-        std::size_t index         = 0;
-
-
-        for (auto vertex : graph.get_vertices()) {
-            if (!data.contains(vertex)) {
-                call_stack.push_back(vertex);
-
-
-                while (!rng::empty(call_stack)) {
-                    auto v = util::take_back(call_stack);
-
-                    if (!data.contains(v)) {
-                        data.emplace(v, detail::tarjan_vertex_data<G> { index++, graph, v });
-                        low_stack.push_back(v);
-                    } else {
-                        auto& vd = data.at(v);
-                        vd.low_link = std::min(vd.low_link, data.at(vd.edge_iterator->second).low_link);
-                    }
-
-
-                    auto& vd = data.at(v);
-                    auto& it = vd.edge_iterator;
-
-                    for (/* no init */; it != vd.edges.end() && data.contains(it->second); ++it) {
-                        auto  w  = it->second;
-                        auto& wd = data.at(w);
-
-                        if (wd.stacked) vd.low_link = std::min(vd.low_link, wd.index);
-                    }
-
-
-                    if (it != vd.edges.end()) {
-                        call_stack.push_back(v);
-                        call_stack.push_back(it->second);
-
-                        ++it;
-                        continue;
-                    }
-
-
-                    if (vd.low_link == vd.index) {
-                        // Output iterators are not guaranteed to be dereferencable multiple times for the same element,
-                        // so only dereference it if we're actually going to output an SCC.
-                        const bool should_output = min_size < 2 || [&] {
-                            std::size_t count = 0;
-
-                            for (auto w : low_stack | views::reverse) {
-                                if (!vertex_compare_of<G>(v, w)) ++count;
-                                else break;
-                            }
-
-                            return count >= min_size;
-                        } ();
+        detail::tarjan_state<G, Target, decltype(stack_provider()), decltype(min_stack_provider()), decltype(map_provider())> state {
+            graph, GRAPHLE_FWD(target), min_size, stack_provider(), min_stack_provider(), map_provider()
+        };
 
+        state.run(util::unlimited_budget {});
+    }
 
-                        vertex_of<G> w;
 
-                        auto unstack = [&] {
-                            w = util::take_back(low_stack);
-                            data.at(w).stacked = false;
-                            return w;
-                        };
+    /**
+     * @ingroup Alg
+     *
+     * Equivalent to the output iterator overload of @ref strongly_connected_components, but cancels the algorithm once the given budget is exhausted,
+     * e.g. when its deadline has passed or a stop is requested through its stop token. See @ref util::work_budget.
+     * Components found before the algorithm was cancelled have already been written to the output iterator.
+     *
+     * @param graph A graphle::graph to find the strongly connected components of.
+     * @param output An output iterator with a value type that is itself an output iterator, into which vertices can be pushed.
+     * @param budget A @ref util::work_budget limiting the algorithm. If an lvalue is passed, the work performed is consumed from it.
+     * @param min_size Strongly connected components with a cycle length smaller than this value will be discarded.
+     * @param stack_provider An optional storage-provider which can provide a vector-like type for the algorithm to use.
+     * @param min_stack_provider An optional storage-provider which can provide a vector-like type for the algorithm to use.
+     * @param map_provider An optional storage-provider which can provide a unordered-map-like type for the algorithm to use.
+     * @return FINISHED if all components were found, or CANCELLED if the budget was exhausted first.
+     *
+     * @graph_requires{
+     *  directed_graph<G>    &&
+     *  vertex_list_graph<G> &&
+     *  (
+     *      edge_list_graph<G> ||
+     *      out_edges_graph<G>
+     *  )
+     * }
+     */
+    template <
+        directed_graph G,
+        typename Target,
+        util::budget Budget,
+        store::storage_provider_ref<store::storage_type::VECTOR, vertex_of<G>> PV
+            = store::default_provided_t<store::storage_type::VECTOR, vertex_of<G>>,
+        store::storage_provider_ref<store::storage_type::VECTOR, vertex_of<G>> PVM
+            = store::default_provided_t<store::storage_type::VECTOR, vertex_of<G>>,
+        store::storage_provider_ref<store::storage_type::UNORDERED_MAP, vertex_of<G>, detail::tarjan_vertex_data<G>, vertex_hash_of<G>, vertex_compare_of<G>> PM
+            = store::default_provided_t<store::storage_type::UNORDERED_MAP, vertex_of<G>, detail::tarjan_vertex_data<G>, vertex_hash_of<G>, vertex_compare_of<G>>
+    > requires (
+        vertex_list_graph<G> &&
+        (edge_list_graph<G> || out_edges_graph<G>) &&
+        detail::nested_output_iterator<std::remove_cvref_t<Target>, vertex_of<G>>
+    ) constexpr inline util::run_status strongly_connected_components(
+        G&& graph,
+        Target&& target,
+        Budget&& budget,
+        std::size_t min_size     = 0,
+        PV&&  stack_provider     = store::get_default_storage_provider<store::storage_type::VECTOR, vertex_of<G>>(),
+        PVM&& min_stack_provider = store::get_default_storage_provider<store::storage_type::VECTOR, vertex_of<G>>(),
+        PM&&  map_provider       = store::get_default_storage_provider<store::storage_type::UNORDERED_MAP, vertex_of<G>, detail::tarjan_vertex_data<G>, vertex_hash_of<G>, vertex_compare_of<G>>()
+    ) {
+        detail::tarjan_state<G, Target, decltype(stack_provider()), decltype(min_stack_provider()), decltype(map_provider())> state {
+            graph, GRAPHLE_FWD(target), min_size, stack_provider(), min_stack_provider(), map_provider()
+        };
 
+        const auto status = state.run(budget);
+        return status == util::run_status::SUSPENDED ? util::run_status::CANCELLED : status;
+    }
 
-                        if (should_output) {
-                            decltype(auto) scc_target = *target;
 
-                            do *scc_target++ = unstack();
-                            while (!vertex_compare_of<G>(v, w));
-                        } else {
-                            do unstack();
-                            while (!vertex_compare_of<G>(v, w));
-                        }
-                    }
-                }
-            }
-        }
+    /**
+     * @ingroup Alg
+     *
+     * Prepares finding the strongly connected components of the given directed graph, in the same way as @ref strongly_connected_components,
+     * but the returned object can be run in steps limited by a @ref util::work_budget, e.g. to spread the algorithm over multiple frames:
+     * ~~~
+     * std::vector<std::vector<vertex_of<G>>> result;
+     * auto provider = store::get_default_storage_provider<store::storage_type::VECTOR, vertex_of<G>>();
+     * auto scc      = alg::resumable_strongly_connected_components(graph, util::vec_of_vecs_output_iterator { result, provider });
+     *
+     * // Every frame:
+     * if (scc.run(util::work_budget::of_time(2ms)) == util::run_status::FINISHED) { ... }
+     * ~~~
+     * Components are written to the output iterator as soon as they are found. Between runs, all state is stored in the storage
+     * obtained from the given providers. The graph must outlive the returned object and must not be modified until it has finished.
+     * The returned object cannot be moved, so it should be initialized directly from the return value of this function.
+     *
+     * @param graph A graphle::graph to find the strongly connected components of.
+     * @param output An output iterator with a value type that is itself an output iterator, into which vertices can be pushed.
+     *  If an lvalue is passed, it is stored by reference and must outlive the returned object.
+     * @param min_size Strongly connected components with a cycle length smaller than this value will be discarded.
+     * @param stack_provider An optional storage-provider which can provide a vector-like type for the algorithm to use.
+     * @param min_stack_provider An optional storage-provider which can provide a vector-like type for the algorithm to use.
+     * @param map_provider An optional storage-provider which can provide a unordered-map-like type for the algorithm to use.
+     * @return An object with a method run(budget), returning a @ref util::run_status.
+     *
+     * @graph_requires{
+     *  directed_graph<G>    &&
+     *  vertex_list_graph<G> &&
+     *  (
+     *      edge_list_graph<G> ||
+     *      out_edges_graph<G>
+     *  )
+     * }
+     */
+    template <
+        directed_graph G,
+        typename Target,
+        store::storage_provider_ref<store::storage_type::VECTOR, vertex_of<G>> PV
+            = store::default_provided_t<store::storage_type::VECTOR, vertex_of<G>>,
+        store::storage_provider_ref<store::storage_type::VECTOR, vertex_of<G>> PVM
+            = store::default_provided_t<store::storage_type::VECTOR, vertex_of<G>>,
+        store::storage_provider_ref<store::storage_type::UNORDERED_MAP, vertex_of<G>, detail::tarjan_vertex_data<G&>, vertex_hash_of<G>, vertex_compare_of<G>> PM
+            = store::default_provided_t<store::storage_type::UNORDERED_MAP, vertex_of<G>, detail::tarjan_vertex_data<G&>, vertex_hash_of<G>, vertex_compare_of<G>>
+    > requires (
+        vertex_list_graph<G> &&
+        (edge_list_graph<G> || out_edges_graph<G>) &&
+        detail::nested_output_iterator<std::remove_cvref_t<Target>, vertex_of<G>>
+    ) constexpr inline auto resumable_strongly_connected_components(
+        G& graph,
+        Target&& target,
+        std::size_t min_size     = 0,
+        PV&&  stack_provider     = store::get_default_storage_provider<store::storage_type::VECTOR, vertex_of<G>>(),
+        PVM&& min_stack_provider = store::get_default_storage_provider<store::storage_type::VECTOR, vertex_of<G>>(),
+        PM&&  map_provider       = store::get_default_storage_provider<store::storage_type::UNORDERED_MAP, vertex_of<G>, detail::tarjan_vertex_data<G&>, vertex_hash_of<G>, vertex_compare_of<G>>()
+    ) {
+        return detail::tarjan_state<G&, Target, decltype(stack_provider()), decltype(min_stack_provider()), decltype(map_provider())> {
+            graph, GRAPHLE_FWD(target), min_size, stack_provider(), min_stack_provider(), map_provider()
+        };
     }
 
 
@@ -180,22 +433,21 @@ namespace graphle::alg {
      * This non-recursive version of the algorithm is based on the implementation by Thomas Ahle:
      * https://stackoverflow.com/a/62006383
      *
-     * This overload returns its data as a Vector<Vector<Vertex>> (See return type).
+     * This overload returns its data as a @ref util::jagged_array, which stores the vertices of all components in a single contiguous array.
+     * To obtain a vector of vectors instead, use the output iterator overload with a @ref util::vec_of_vecs_output_iterator.
      *
      * @param graph A graphle::graph to find the strongly connected components of.
      * @param min_size Strongly connected components with a cycle length smaller than this value will be discarded.
      *  Typically, when e.g. searching for cyclic dependencies, you will want to discard all size-1 cycles,
      *  since these indicate vertices that do not have any dependencies at all.
-     * @param inner_ret_provider An optional storage-provider which can provide a vector-like type for the algorithm to use. Used for the returned value (See return type).
-     * @param outer_ret_provider An optional storage-provider which can provide a vector-like type for the algorithm to use. Used for the returned value (See return type).
+     * @param data_ret_provider An optional storage-provider which can provide a vector-like type for the algorithm to use. Used for the returned value (See return type).
+     * @param offsets_ret_provider An optional storage-provider which can provide a vector-like type for the algorithm to use. Used for the returned value (See return type).
      * @param stack_provider An optional storage-provider which can provide a vector-like type for the algorithm to use.
      * @param min_stack_provider An optional storage-provider which can provide a vector-like type for the algorithm to use.
      * @param map_provider An optional storage-provider which can provide a unordered-map-like type for the algorithm to use.
-     * @return Returns a VectorOuter<VectorInner<Vertex>>,
-     *  where VectorOuter is the storage type provided by OuterPR (std::vector by default)
-     *  where VectorInner is the storage type provided by InnerPR (std::vector by default)
-     *  The value category of the returned value is equal to that of the outer_ret_provider,
-     *  i.e. if outer_ret_provider() returns a reference, this function returns a reference also.
+     * @return Returns a util::jagged_array<Vertex, VectorData, VectorOffsets> containing one group of vertices for every strongly connected component,
+     *  where VectorData is the storage type provided by DataPR (std::vector by default), which must be contiguous,
+     *  where VectorOffsets is the storage type provided by OffsetsPR (std::vector by default)
      *
      * @graph_requires{
      *  directed_graph<G>    &&
@@ -208,10 +460,10 @@ namespace graphle::alg {
      */
     template <
         directed_graph G,
-        store::storage_provider_ref<store::storage_type::VECTOR, vertex_of<G>> InnerPR
+        store::storage_provider_ref<store::storage_type::VECTOR, vertex_of<G>> DataPR
             = store::default_provided_t<store::storage_type::VECTOR, vertex_of<G>>,
-        store::storage_provider_ref<store::storage_type::VECTOR, store::provided_storage_value_type<InnerPR>> OuterPR
-            = store::default_provided_t<store::storage_type::VECTOR, store::provided_storage_value_type<InnerPR>>,
+        store::storage_provider_ref<store::storage_type::VECTOR, std::size_t> OffsetsPR
+            = store::default_provided_t<store::storage_type::VECTOR, std::size_t>,
         store::storage_provider_ref<store::storage_type::VECTOR, vertex_of<G>> PV
             = store::default_provided_t<store::storage_type::VECTOR, vertex_of<G>>,
         store::storage_provider_ref<store::storage_type::VECTOR, vertex_of<G>> PVM
@@ -220,21 +472,22 @@ namespace graphle::alg {
             = store::default_provided_t<store::storage_type::UNORDERED_MAP, vertex_of<G>, detail::tarjan_vertex_data<G>, vertex_hash_of<G>, vertex_compare_of<G>>
     > requires (
         vertex_list_graph<G> &&
-        (edge_list_graph<G> || out_edges_graph<G>)
-    ) constexpr inline decltype(auto) strongly_connected_components(
+        (edge_list_graph<G> || out_edges_graph<G>) &&
+        rng::contiguous_range<store::provided_storage_value_type<DataPR>>
+    ) constexpr inline auto strongly_connected_components(
         G&& graph,
-        std::size_t min_size                          = 0,
-        GRAPHLE_MULTIPLE InnerPR&& inner_ret_provider = store::get_default_storage_provider<store::storage_type::VECTOR, vertex_of<G>>(),
-        OuterPR&& outer_ret_provider                  = store::get_default_storage_provider<store::storage_type::VECTOR, store::provided_storage_value_type<InnerPR>>(),
-        PV&&  stack_provider                          = store::get_default_storage_provider<store::storage_type::VECTOR, vertex_of<G>>(),
-        PVM&& min_stack_provider                      = store::get_default_storage_provider<store::storage_type::VECTOR, vertex_of<G>>(),
-        PM&&  map_provider                            = store::get_default_storage_provider<store::storage_type::UNORDERED_MAP, vertex_of<G>, detail::tarjan_vertex_data<G>, vertex_hash_of<G>, vertex_compare_of<G>>()
+        std::size_t min_size             = 0,
+        DataPR&& data_ret_provider       = store::get_default_storage_provider<store::storage_type::VECTOR, vertex_of<G>>(),
+        OffsetsPR&& offsets_ret_provider = store::get_default_storage_provider<store::storage_type::VECTOR, std::size_t>(),
+        PV&&  stack_provider             = store::get_default_storage_provider<store::storage_type::VECTOR, vertex_of<G>>(),
+        PVM&& min_stack_provider         = store::get_default_storage_provider<store::storage_type::VECTOR, vertex_of<G>>(),
+        PM&&  map_provider               = store::get_default_storage_provider<store::storage_type::UNORDERED_MAP, vertex_of<G>, detail::tarjan_vertex_data<G>, vertex_hash_of<G>, vertex_compare_of<G>>()
     ) {
-        decltype(auto) result = outer_ret_provider();
+        util::jagged_array result { data_ret_provider(), offsets_ret_provider() };
 
         strongly_connected_components(
             graph,
-            util::vec_of_vecs_output_iterator { result, inner_ret_provider },
+            util::jagged_array_output_iterator { result },
             min_size,
             GRAPHLE_FWD(stack_provider),
             GRAPHLE_FWD(min_stack_provider),
@@ -243,4 +496,76 @@ namespace graphle::alg {
 
         return result;
     }
+
+
+    /**
+     * @ingroup Alg
+     *
+     * Equivalent to the @ref util::jagged_array overload of @ref strongly_connected_components, but cancels the algorithm once the given budget is exhausted,
+     * e.g. when its deadline has passed or a stop is requested through its stop token. See @ref util::work_budget.
+     * ~~~
+     * auto [status, components] = alg::strongly_connected_components(graph, util::work_budget::of_time(50ms));
+     * ~~~
+     *
+     * @param graph A graphle::graph to find the strongly connected components of.
+     * @param budget A @ref util::work_budget limiting the algorithm. If an lvalue is passed, the work performed is consumed from it.
+     * @param min_size Strongly connected components with a cycle length smaller than this value will be discarded.
+     * @param data_ret_provider An optional storage-provider which can provide a vector-like type for the algorithm to use. Used for the returned value (See return type).
+     * @param offsets_ret_provider An optional storage-provider which can provide a vector-like type for the algorithm to use. Used for the returned value (See return type).
+     * @param stack_provider An optional storage-provider which can provide a vector-like type for the algorithm to use.
+     * @param min_stack_provider An optional storage-provider which can provide a vector-like type for the algorithm to use.
+     * @param map_provider An optional storage-provider which can provide a unordered-map-like type for the algorithm to use.
+     * @return Returns a std::pair of the @ref util::run_status (FINISHED if all components were found, or CANCELLED if the budget was exhausted first)
+     *  and the util::jagged_array of the components found, as returned by the jagged array overload. If the algorithm was cancelled, only the components found before it are included.
+     *
+     * @graph_requires{
+     *  directed_graph<G>    &&
+     *  vertex_list_graph<G> &&
+     *  (
+     *      edge_list_graph<G> ||
+     *      out_edges_graph<G>
+     *  )
+     * }
+     */
+    template <
+        directed_graph G,
+        util::budget Budget,
+        store::storage_provider_ref<store::storage_type::VECTOR, vertex_of<G>> DataPR
+            = store::default_provided_t<store::storage_type::VECTOR, vertex_of<G>>,
+        store::storage_provider_ref<store::storage_type::VECTOR, std::size_t> OffsetsPR
+            = store::default_provided_t<store::storage_type::VECTOR, std::size_t>,
+        store::storage_provider_ref<store::storage_type::VECTOR, vertex_of<G>> PV
+            = store::default_provided_t<store::storage_type::VECTOR, vertex_of<G>>,
+        store::storage_provider_ref<store::storage_type::VECTOR, vertex_of<G>> PVM
+            = store::default_provided_t<store::storage_type::VECTOR, vertex_of<G>>,
+        store::storage_provider_ref<store::storage_type::UNORDERED_MAP, vertex_of<G>, detail::tarjan_vertex_data<G>, vertex_hash_of<G>, vertex_compare_of<G>> PM
+            = store::default_provided_t<store::storage_type::UNORDERED_MAP, vertex_of<G>, detail::tarjan_vertex_data<G>, vertex_hash_of<G>, vertex_compare_of<G>>
+    > requires (
+        vertex_list_graph<G> &&
+        (edge_list_graph<G> || out_edges_graph<G>) &&
+        rng::contiguous_range<store::provided_storage_value_type<DataPR>>
+    ) constexpr inline auto strongly_connected_components(
+        G&& graph,
+        Budget&& budget,
+        std::size_t min_size             = 0,
+        DataPR&& data_ret_provider       = store::get_default_storage_provider<store::storage_type::VECTOR, vertex_of<G>>(),
+        OffsetsPR&& offsets_ret_provider = store::get_default_storage_provider<store::storage_type::VECTOR, std::size_t>(),
+        PV&&  stack_provider             = store::get_default_storage_provider<store::storage_type::VECTOR, vertex_of<G>>(),
+        PVM&& min_stack_provider         = store::get_default_storage_provider<store::storage_type::VECTOR, vertex_of<G>>(),
+        PM&&  map_provider               = store::get_default_storage_provider<store::storage_type::UNORDERED_MAP, vertex_of<G>, detail::tarjan_vertex_data<G>, vertex_hash_of<G>, vertex_compare_of<G>>()
+    ) {
+        util::jagged_array result { data_ret_provider(), offsets_ret_provider() };
+
+        const auto status = strongly_connected_components(
+            graph,
+            util::jagged_array_output_iterator { result },
+            budget,
+            min_size,
+            GRAPHLE_FWD(stack_provider),
+            GRAPHLE_FWD(min_stack_provider),
+            GRAPHLE_FWD(map_provider)
+        );
+
+        return std::pair { status, std::move(result) };
+    }
 }
\ No newline at end of file
@@ -4,7 +4,16 @@
 
 #pragma once
 
+#include <graph/bit_matrix_graph.hpp>
+#include <graph/compact_graph.hpp>
 #include <graph/constraint_debug_helper.hpp>
+#include <graph/edge_property_map.hpp>
 #include <graph/graph.hpp>
 #include <graph/graph_concepts.hpp>
+#include <graph/grid_graph.hpp>
+#include <graph/identified_edge.hpp>
+#include <graph/masked_subgraph.hpp>
+#include <graph/static_graph.hpp>
+#include <graph/versioned_graph.hpp>
 #include <graph/vertex_compare.hpp>
+#include <graph/vertex_property_map.hpp>
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <common.hpp>
+#include <graph/graph.hpp>
+#include <storage/storage_provider.hpp>
+#include <storage/default_storage_provider.hpp>
+#include <utility/dynamic_bitset.hpp>
+#include <utility/edge_utils.hpp>
+#include <utility/vertex_index.hpp>
+#include <views/edge_from_vertex.hpp>
+
+#include <span>
+#include <vector>
+
+
+namespace graphle {
+    /**
+     * @ingroup Graph
+     * Graph stored as an adjacency bit matrix, where bit j of row i is set if there is an edge from vertex i to vertex j.
+     * This representation is intended for small, dense graphs (up to a few thousand vertices), where it allows algorithms to operate on
+     * entire sets of vertices a word at a time (See bit_matrix_algorithms.hpp), rather than visiting every edge individually.
+     *
+     * Rows are stored contiguously in a single allocation, and each row is padded to a whole number of words.
+     * The graph is always directed. A non-directed graph is represented by setting the bits for both directions of every edge.
+     *
+     * @tparam Vertex The vertex type of the graph (The graph will use Vertex* as its vertex type).
+     * @tparam Index A @ref util::vertex_index mapping vertices to rows of the matrix.
+     */
+    template <typename Vertex, typename Index> class bit_matrix_graph {
+    public:
+        using vertex_type = Vertex*;
+
+
+        /** Constructs a graph without any edges containing the vertices in the given index. */
+        constexpr explicit bit_matrix_graph(Index index) :
+            index(std::move(index)),
+            row_words(util::words_for_bits(this->index.size())),
+            matrix(this->index.size() * row_words, 0)
+        {}
+
+
+        constexpr void add_edge(std::size_t from, std::size_t to) {
+            row(from)[to / util::bits_per_word] |= (util::bit_word { 1 } << (to % util::bits_per_word));
+        }
+
+        constexpr void remove_edge(std::size_t from, std::size_t to) {
+            row(from)[to / util::bits_per_word] &= ~(util::bit_word { 1 } << (to % util::bits_per_word));
+        }
+
+        [[nodiscard]] constexpr bool has_edge(std::size_t from, std::size_t to) const {
+            return (row(from)[to / util::bits_per_word] >> (to % util::bits_per_word)) & 1;
+        }
+
+
+        constexpr void add_edge(vertex_type from, vertex_type to) { add_edge(index_of(from), index_of(to)); }
+        constexpr void remove_edge(vertex_type from, vertex_type to) { remove_edge(index_of(from), index_of(to)); }
+        [[nodiscard]] constexpr bool has_edge(vertex_type from, vertex_type to) const { return has_edge(index_of(from), index_of(to)); }
+
+
+        /** Returns the words of the row for the given vertex index. Bit j is set if there is an edge to the vertex with index j. */
+        [[nodiscard]] constexpr std::span<util::bit_word> row(std::size_t vertex) {
+            return std::span { matrix }.subspan(vertex * row_words, row_words);
+        }
+
+        /** @copydoc row */
+        [[nodiscard]] constexpr std::span<const util::bit_word> row(std::size_t vertex) const {
+            return std::span { matrix }.subspan(vertex * row_words, row_words);
+        }
+
+        /** Returns the indices of the out-neighbours of the given vertex index in ascending order. */
+        [[nodiscard]] constexpr util::set_bit_range out_neighbors(std::size_t vertex) const {
+            return util::set_bit_range { row(vertex) };
+        }
+
+
+        /** Returns a graph with every edge of this graph reversed. */
+        [[nodiscard]] constexpr bit_matrix_graph transposed(void) const {
+            bit_matrix_graph result { index };
+
+            for (std::size_t from = 0; from < num_vertices(); ++from) {
+                for (auto to : out_neighbors(from)) result.add_edge(to, from);
+            }
+
+            return result;
+        }
+
+
+        [[nodiscard]] constexpr std::size_t index_of(vertex_type vertex) const { return index.index_of(vertex); }
+        [[nodiscard]] constexpr vertex_type vertex_at(std::size_t i) const { return index.vertex_at(i); }
+        [[nodiscard]] constexpr std::size_t num_vertices(void) const { return index.size(); }
+        [[nodiscard]] constexpr std::size_t words_per_row(void) const { return row_words; }
+        [[nodiscard]] constexpr const Index& get_index(void) const { return index; }
+
+
+        /** Returns a graphle::graph view of this graph. */
+        [[nodiscard]] constexpr auto view_as_graph(void) const {
+            return graph {
+                .deduce_vertex_type = meta::deduce_as<Vertex>,
+                .get_vertices       = [this] { return views::all(index.get_vertices()); },
+                .get_out_edges      = [this] (vertex_type v) {
+                    return out_neighbors(index_of(v))
+                        | views::transform([this] (std::size_t i) { return vertex_at(i); })
+                        | views::edge_from(v);
+                }
+            };
+        }
+    private:
+        Index index;
+        std::size_t row_words;
+        std::vector<util::bit_word> matrix;
+    };
+
+
+    /**
+     * @ingroup Graph
+     * Constructs a @ref bit_matrix_graph with the same vertices and edges as the given graph.
+     * Vertices are assigned rows in the order in which they are returned by graph.get_vertices().
+     *
+     * @param graph The graph to copy.
+     * @param map_provider An optional storage-provider which can provide a unordered-map-like type for the vertex index of the new graph.
+     * @return A bit_matrix_graph containing every vertex and edge of the given graph.
+     *
+     * @graph_requires{
+     *  vertex_list_graph<G> &&
+     *  (
+     *      edge_list_graph<G> ||
+     *      out_edges_graph<G> ||
+     *      (non_directed_graph<G> && in_edges_graph<G>)
+     *  )
+     * }
+     */
+    template <
+        graph_ref G,
+        store::storage_provider_ref<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>> PM
+            = store::default_provided_t<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>
+    > requires (
+        vertex_list_graph<G> &&
+        (edge_list_graph<G> || out_edges_graph<G> || (non_directed_graph<G> && in_edges_graph<G>))
+    ) constexpr inline auto make_bit_matrix_graph(
+        G&& graph,
+        PM&& map_provider = store::get_default_storage_provider<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>()
+    ) {
+        using vertex = std::remove_pointer_t<vertex_of<G>>;
+        using index  = decltype(util::make_vertex_index(graph, GRAPHLE_FWD(map_provider)));
+
+        bit_matrix_graph<vertex, index> result { util::make_vertex_index(graph, GRAPHLE_FWD(map_provider)) };
+
+
+        for (std::size_t from = 0; from < result.num_vertices(); ++from) {
+            for (auto edge : util::out_edges(graph, result.vertex_at(from))) {
+                const std::size_t to = result.index_of(edge.second);
+
+                result.add_edge(from, to);
+                if constexpr (!graph_is_directed<G>) result.add_edge(to, from);
+            }
+        }
+
+
+        return result;
+    }
+}
@@ -0,0 +1,172 @@
+#pragma once
+
+#include <common.hpp>
+#include <graph/graph.hpp>
+#include <graph/identified_edge.hpp>
+#include <storage/storage_provider.hpp>
+#include <storage/default_storage_provider.hpp>
+#include <utility/edge_utils.hpp>
+#include <utility/vertex_index.hpp>
+
+#include <algorithm>
+#include <span>
+#include <utility>
+#include <vector>
+
+
+namespace graphle {
+    /**
+     * @ingroup Graph
+     * Immutable graph stored in compressed sparse row (CSR) form: the out-neighbours of every vertex are stored contiguously
+     * in a single array of vertex indices, and vertex i's neighbours are found at positions [offsets[i], offsets[i + 1]).
+     *
+     * Every edge is identified by its position in this array, which gives each edge a dense id in [0, E) that stays the same for the lifetime of the graph,
+     * even for parallel edges. The edges of the graph are @ref identified_edge "identified edges" and the graph view provides get_edge_id,
+     * so the graph can be used with an @ref edge_property_map. Since the out edges of a vertex have consecutive ids,
+     * an algorithm visiting them reads their properties sequentially from each column.
+     * Likewise, the index of every vertex is used as its vertex id.
+     *
+     * The graph is always directed. A non-directed graph is represented by storing both directions of every edge, each with its own id.
+     *
+     * @tparam Vertex The vertex type of the graph (The graph will use Vertex* as its vertex type).
+     * @tparam Index A @ref util::vertex_index mapping vertices to their indices.
+     */
+    template <typename Vertex, typename Index> class compact_graph {
+    public:
+        using vertex_type = Vertex*;
+        using edge_type   = identified_edge<Vertex>;
+        using index_edge  = std::pair<std::size_t, std::size_t>;
+
+
+        /**
+         * Constructs a graph containing the vertices in the given index and the given edges.
+         * Edges from the same vertex are assigned ids in the order in which they appear in the given range.
+         * @param index The vertices of the graph.
+         * @param edges A range of pairs of vertex indices. The range is traversed twice, so it must be a forward range.
+         */
+        template <rng::forward_range R> requires std::convertible_to<rng::range_value_t<R>, index_edge>
+        constexpr compact_graph(Index index, R&& edges) : index(std::move(index)), offsets(this->index.size() + 1, 0) {
+            for (const index_edge& edge : edges) ++offsets[edge.first + 1];
+            for (std::size_t i = 1; i < offsets.size(); ++i) offsets[i] += offsets[i - 1];
+
+            targets.resize(offsets.back());
+            std::vector<std::size_t> cursor { offsets.begin(), offsets.end() - 1 };
+
+            for (const index_edge& edge : edges) targets[cursor[edge.first]++] = edge.second;
+        }
+
+
+        /** Returns the indices of the out-neighbours of the given vertex index, ordered by the ids of the edges to them. */
+        [[nodiscard]] constexpr std::span<const std::size_t> out_neighbors(std::size_t vertex) const {
+            return std::span { targets }.subspan(offsets[vertex], offsets[vertex + 1] - offsets[vertex]);
+        }
+
+        /** Returns the ids of the out edges of the given vertex index. These are always a consecutive range. */
+        [[nodiscard]] constexpr auto out_edge_ids(std::size_t vertex) const {
+            return views::iota(offsets[vertex], offsets[vertex + 1]);
+        }
+
+        [[nodiscard]] constexpr std::size_t out_degree(std::size_t vertex) const {
+            return offsets[vertex + 1] - offsets[vertex];
+        }
+
+
+        /** Returns the index of the vertex the edge with the given id comes from. This requires a binary search over the vertices. */
+        [[nodiscard]] constexpr std::size_t source_of(std::size_t edge_id) const {
+            return std::size_t(std::ranges::upper_bound(offsets, edge_id) - offsets.begin()) - 1;
+        }
+
+        /** Returns the index of the vertex the edge with the given id goes to. */
+        [[nodiscard]] constexpr std::size_t target_of(std::size_t edge_id) const {
+            return targets[edge_id];
+        }
+
+        /** Returns the edge with the given id. */
+        [[nodiscard]] constexpr edge_type edge_at(std::size_t edge_id) const {
+            return edge_type { vertex_at(source_of(edge_id)), vertex_at(target_of(edge_id)), edge_id };
+        }
+
+
+        [[nodiscard]] constexpr std::size_t index_of(vertex_type vertex) const { return index.index_of(vertex); }
+        [[nodiscard]] constexpr vertex_type vertex_at(std::size_t i) const { return index.vertex_at(i); }
+        [[nodiscard]] constexpr std::size_t num_vertices(void) const { return index.size(); }
+        [[nodiscard]] constexpr std::size_t num_edges(void) const { return targets.size(); }
+        [[nodiscard]] constexpr const Index& get_index(void) const { return index; }
+
+
+        /** Returns a graphle::graph view of this graph. */
+        [[nodiscard]] constexpr auto view_as_graph(void) const {
+            return graph {
+                .deduce_vertex_type = meta::deduce_as<Vertex>,
+                .get_vertices       = [this] { return views::all(index.get_vertices()); },
+                .get_edges          = [this] {
+                    return views::iota(std::size_t { 0 }, num_edges())
+                        | views::transform([this] (std::size_t id) { return edge_at(id); });
+                },
+                .get_out_edges      = [this] (vertex_type v) {
+                    return out_edge_ids(index_of(v))
+                        | views::transform([this, v] (std::size_t id) { return edge_type { v, vertex_at(target_of(id)), id }; });
+                },
+                .get_vertex_id      = [this] (vertex_type v) { return index_of(v); },
+                .get_edge_id        = identified_edge_id<Vertex> {}
+            };
+        }
+    private:
+        Index index;
+        std::vector<std::size_t> offsets;
+        std::vector<std::size_t> targets;
+    };
+
+
+    /**
+     * @ingroup Graph
+     * Constructs a @ref compact_graph with the same vertices and edges as the given graph.
+     * Vertices are assigned indices in the order in which they are returned by graph.get_vertices(),
+     * and the out edges of every vertex are assigned ids in the order in which they are returned by the graph.
+     *
+     * @param graph The graph to copy.
+     * @param map_provider An optional storage-provider which can provide a unordered-map-like type for the vertex index of the new graph.
+     * @return A compact_graph containing every vertex and edge of the given graph.
+     *
+     * @graph_requires{
+     *  vertex_list_graph<G> &&
+     *  (
+     *      edge_list_graph<G> ||
+     *      out_edges_graph<G> ||
+     *      (non_directed_graph<G> && in_edges_graph<G>)
+     *  )
+     * }
+     */
+    template <
+        graph_ref G,
+        store::storage_provider_ref<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>> PM
+            = store::default_provided_t<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>
+    > requires (
+        vertex_list_graph<G> &&
+        (edge_list_graph<G> || out_edges_graph<G> || (non_directed_graph<G> && in_edges_graph<G>))
+    ) constexpr inline auto make_compact_graph(
+        G&& graph,
+        PM&& map_provider = store::get_default_storage_provider<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>()
+    ) {
+        using vertex = std::remove_pointer_t<vertex_of<G>>;
+        using index  = decltype(util::make_vertex_index(graph, GRAPHLE_FWD(map_provider)));
+
+        index vertices = util::make_vertex_index(graph, GRAPHLE_FWD(map_provider));
+        std::vector<std::pair<std::size_t, std::size_t>> edges;
+
+
+        for (std::size_t from = 0; from < vertices.size(); ++from) {
+            for (auto edge : util::out_edges(graph, vertices.vertex_at(from))) {
+                const std::size_t to = vertices.index_of(edge.second);
+
+                edges.emplace_back(from, to);
+
+                // Out edges found from the edge list of a non-directed graph only contain one direction of every edge.
+                if constexpr (!graph_is_directed<G> && !graph_has_out_edges<G> && !graph_has_in_edges<G>) edges.emplace_back(to, from);
+            }
+        }
+
+
+        return compact_graph<vertex, index> { std::move(vertices), edges };
+    }
+}
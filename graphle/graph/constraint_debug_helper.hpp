@@ -20,6 +20,10 @@ namespace graphle::detail {
     template <typename Vertex, typename Get> struct invalid_in_edge_getter {};
     /** Invalid value for parameter GetOutEdges. @ingroup graph_constraint_errors */
     template <typename Vertex, typename Get> struct invalid_out_edge_getter {};
+    /** Invalid value for parameter GetVertexId. @ingroup graph_constraint_errors */
+    template <typename Vertex, typename Get> struct invalid_vertex_id_getter {};
+    /** Invalid value for parameter GetEdgeId. @ingroup graph_constraint_errors */
+    template <typename Vertex, typename Get> struct invalid_edge_id_getter {};
 
 
     /**
@@ -47,7 +51,9 @@ namespace graphle::detail {
      *  invalid_vertex_getter<Vertex, Getter>,
      *  invalid_edge_getter<Vertex, Getter>,
      *  invalid_in_edge_getter<Vertex, Getter>,
-     *  invalid_out_edge_getter<Vertex, Getter>
+     *  invalid_out_edge_getter<Vertex, Getter>,
+     *  invalid_vertex_id_getter<Vertex, Getter>,
+     *  invalid_edge_id_getter<Vertex, Getter>
      *
      *  @todo: While using the static_assert works for Clang, MSVC still refuses to actually tell us the full reason for the constraint failure here.
      *    Might be fixable by moving these asserts elsewhere because there are situations where it does give the full failure reason.
@@ -58,7 +64,9 @@ namespace graphle::detail {
         typename GetVertices,
         typename GetEdges,
         typename GetOutEdges,
-        typename GetInEdges
+        typename GetInEdges,
+        typename GetVertexId = meta::none,
+        typename GetEdgeId   = meta::none
     > consteval auto graph_constraints_check(void) {
         #ifndef GRAPHLE_NO_STATIC_ASSERT
             static_assert(meta::value_wrapper_of<IsDirected, bool>);
@@ -66,6 +74,8 @@ namespace graphle::detail {
             static_assert(maybe_edge_getter<GetEdges, Vertex>);
             static_assert(maybe_vertex_edge_getter<GetInEdges, Vertex>);
             static_assert(maybe_vertex_edge_getter<GetOutEdges, Vertex>);
+            static_assert(maybe_vertex_value_getter<GetVertexId, Vertex, std::size_t>);
+            static_assert(maybe_edge_value_getter<GetEdgeId, Vertex, std::size_t>);
         #endif
 
 
@@ -88,6 +98,14 @@ namespace graphle::detail {
         else if constexpr (!maybe_vertex_edge_getter<GetOutEdges, Vertex>) {
             return invalid_out_edge_getter<Vertex, GetOutEdges> {};
         }
+
+        else if constexpr (!maybe_vertex_value_getter<GetVertexId, Vertex, std::size_t>) {
+            return invalid_vertex_id_getter<Vertex, GetVertexId> {};
+        }
+
+        else if constexpr (!maybe_edge_value_getter<GetEdgeId, Vertex, std::size_t>) {
+            return invalid_edge_id_getter<Vertex, GetEdgeId> {};
+        }
         
         else return all_constraints_satisfied {};
     }
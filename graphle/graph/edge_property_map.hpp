@@ -0,0 +1,98 @@
+#pragma once
+
+#include <common.hpp>
+#include <graph/graph.hpp>
+#include <graph/identified_edge.hpp>
+#include <utility/property_columns.hpp>
+
+#include <functional>
+#include <limits>
+#include <type_traits>
+
+
+namespace graphle {
+    /**
+     * @ingroup Graph
+     * Stores one or more properties (e.g. weights or capacities) for the edges of a graph in a structure-of-arrays layout,
+     * using the id of every edge (See @ref edge_id_graph) as its index into each column.
+     * Finding the properties of an edge is therefore a single array access rather than a hash lookup of its vertices,
+     * and parallel edges can have different properties.
+     *
+     * The map can be invoked as map(edge) to get the first property, so it can be used wherever an @ref edge_value_getter is expected.
+     * Edges without an id (e.g. plain edges passed to a graph whose edges are @ref identified_edge "identified edges") have the default value.
+     *
+     * @tparam G The type of graph the map stores properties for.
+     * @tparam Ts The types of the properties. bool is not supported since std::vector<bool> is not contiguous (use e.g. std::uint8_t instead).
+     */
+    template <edge_id_graph G, typename... Ts> requires (sizeof...(Ts) > 0 && (!std::is_same_v<Ts, bool> && ...))
+    class edge_property_map : public util::property_columns<Ts...> {
+    public:
+        using edge_type = edge_of<G>;
+        using columns   = util::property_columns<Ts...>;
+        template <std::size_t I> using property_type = typename columns::template property_type<I>;
+
+        /** Returned by @ref find_slot for edges without a slot. */
+        constexpr static inline std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+
+        /**
+         * Constructs a new property map for the given graph. If the graph has an edge list, storage for every edge is allocated up front.
+         * @param graph The graph to store properties for. The map does not keep a reference to the graph.
+         * @param defaults The value of each property for edges that have not been assigned a value.
+         */
+        constexpr explicit edge_property_map(const std::remove_cvref_t<G>& graph, Ts... defaults) :
+            columns(std::move(defaults)...),
+            ids(graph.get_edge_id)
+        {
+            if constexpr (edge_list_graph<G>) columns::resize(std::size_t(rng::size(graph.get_edges())));
+        }
+
+
+        /** Returns the slot of the given edge (i.e. its id), growing the columns if required. The edge must have an id. */
+        template <typename E> constexpr std::size_t slot_of(const E& edge) {
+            const auto slot = std::size_t(std::invoke(ids, edge));
+            if (slot >= columns::num_slots()) columns::resize(slot + 1);
+
+            return slot;
+        }
+
+        /** Returns the slot of the given edge, or npos if it does not have one. */
+        template <typename E> [[nodiscard]] constexpr std::size_t find_slot(const E& edge) const {
+            const auto slot = std::size_t(std::invoke(ids, edge));
+            return slot < columns::num_slots() ? slot : npos;
+        }
+
+
+        /** Returns a reference to property I of the given edge. */
+        template <std::size_t I = 0, typename E> constexpr property_type<I>& get(const E& edge) {
+            return columns::template at<I>(slot_of(edge));
+        }
+
+        /** Returns the value of property I of the given edge, or its default value if the edge has no slot. */
+        template <std::size_t I = 0, typename E> [[nodiscard]] constexpr property_type<I> value(const E& edge) const {
+            return columns::template value<I>(find_slot(edge));
+        }
+
+        /** Sets property I of the given edge. */
+        template <std::size_t I = 0, typename E> constexpr void set(const E& edge, property_type<I> value) {
+            get<I>(edge) = std::move(value);
+        }
+
+        /** Equivalent to value<0>(edge). */
+        template <typename E> [[nodiscard]] constexpr property_type<0> operator()(const E& edge) const {
+            return value<0>(edge);
+        }
+    private:
+        typename std::remove_cvref_t<G>::get_edge_id_t ids;
+    };
+
+
+    /**
+     * @ingroup Graph
+     * Constructs an @ref edge_property_map for the given graph, with the property types deduced from the given default values.
+     */
+    template <edge_id_graph G, typename... Ts>
+    constexpr inline auto make_edge_property_map(const G& graph, Ts... defaults) {
+        return edge_property_map<G, Ts...> { graph, std::move(defaults)... };
+    }
+}
@@ -32,6 +32,12 @@ namespace graphle {
      * @tparam GetEdges    The type of a function object returning the edges of this graph, or meta::none.
      * @tparam GetOutEdges The type of a function object returning the outgoing edges of a vertex, or meta::none.
      * @tparam GetInEdges  The type of a function object returning the ingoing edges of a vertex, or meta::none.
+     * @tparam GetVertexId The type of a function object returning a dense integer id for a vertex, or meta::none.
+     *  Ids should be unique and close to the range [0, N) where N is the number of vertices, since they are used to index flat per-vertex arrays
+     *  (See e.g. @ref vertex_property_map).
+     * @tparam GetEdgeId   The type of a function object returning a dense integer id for an edge, or meta::none.
+     *  Unlike vertices, edges are not identified by their address, so graphs that need to distinguish parallel edges or store per-edge data
+     *  should return edges carrying their id (See @ref identified_edge) from their edge getters (See e.g. @ref edge_property_map).
      * @tparam CompareAs   A struct containing typedefs for comparators and hashers for vertices and edges.
      *  The default value compares and hashes vertices by their address, and uses the contained vertices to compare and hash edges.
      *  The comparators and hashers are always provided together, since they must be mutually consistent
@@ -41,13 +47,15 @@ namespace graphle {
      */
     template <
         typename Vertex,
-        meta::value_wrapper_of<bool>     IsDirected  = std::true_type,
-        maybe_vertex_getter<Vertex>      GetVertices = meta::none,
-        maybe_edge_getter<Vertex>        GetEdges    = meta::none,
-        maybe_vertex_edge_getter<Vertex> GetOutEdges = meta::none,
-        maybe_vertex_edge_getter<Vertex> GetInEdges  = meta::none,
-        graph_compare_traits<Vertex>     CompareAs   = compare_by_address<Vertex>,
-        typename Error                               = decltype(detail::graph_constraints_check<Vertex, IsDirected, GetVertices, GetEdges, GetOutEdges, GetInEdges>())
+        meta::value_wrapper_of<bool>                   IsDirected  = std::true_type,
+        maybe_vertex_getter<Vertex>                    GetVertices = meta::none,
+        maybe_edge_getter<Vertex>                      GetEdges    = meta::none,
+        maybe_vertex_edge_getter<Vertex>               GetOutEdges = meta::none,
+        maybe_vertex_edge_getter<Vertex>               GetInEdges  = meta::none,
+        maybe_vertex_value_getter<Vertex, std::size_t> GetVertexId = meta::none,
+        maybe_edge_value_getter<Vertex, std::size_t>   GetEdgeId   = meta::none,
+        graph_compare_traits<Vertex>                   CompareAs   = compare_by_address<Vertex>,
+        typename Error                                             = decltype(detail::graph_constraints_check<Vertex, IsDirected, GetVertices, GetEdges, GetOutEdges, GetInEdges, GetVertexId, GetEdgeId>())
     > struct graph {
         using vertex_type = Vertex*;
         using edge_type   = detail::edge_for<Vertex>;
@@ -58,11 +66,16 @@ namespace graphle {
         constexpr static inline bool has_edge_list   = !meta::is_none_v<GetEdges>;
         constexpr static inline bool has_out_edges   = !meta::is_none_v<GetOutEdges>;
         constexpr static inline bool has_in_edges    = !meta::is_none_v<GetInEdges>;
+        constexpr static inline bool has_vertex_id   = !meta::is_none_v<GetVertexId>;
+        constexpr static inline bool has_edge_id     = !meta::is_none_v<GetEdgeId>;
 
         using get_vertices_t   = GetVertices;
         using get_edges_t      = GetEdges;
         using get_out_edges_t  = GetOutEdges;
         using get_in_edges_t   = GetInEdges;
+        using get_vertex_id_t  = GetVertexId;
+        using get_edge_id_t    = GetEdgeId;
+        using compare_as_t     = CompareAs;
         using vertex_compare_t = typename CompareAs::vertex_compare;
         using edge_compare_t   = typename CompareAs::edge_compare;
         using vertex_hash_t    = typename CompareAs::vertex_hash;
@@ -79,6 +92,8 @@ namespace graphle {
         GetEdges get_edges;
         GetOutEdges get_out_edges;
         GetInEdges get_in_edges;
+        GetVertexId get_vertex_id;
+        GetEdgeId get_edge_id;
     };
 
 
@@ -99,6 +114,8 @@ namespace graphle {
     template <graph_ref G> using vertex_hash_of = typename std::remove_cvref_t<G>::vertex_hash_t;
     /** The edge hasher associated with the graph type G. @ingroup Graph */
     template <graph_ref G> using edge_hash_of = typename std::remove_cvref_t<G>::edge_hash_t;
+    /** The comparator and hasher traits (The CompareAs parameter) of the graph type G. @ingroup Graph */
+    template <graph_ref G> using compare_as_of = typename std::remove_cvref_t<G>::compare_as_t;
 
 
     /** Checks whether or not a graph is directed. @ingroup Graph */
@@ -111,6 +128,10 @@ namespace graphle {
     template <graph_ref G> constexpr inline bool graph_has_out_edges   = std::remove_cvref_t<G>::has_out_edges;
     /** Checks whether or not a graph provides a list of in edges for a vertex. @ingroup Graph */
     template <graph_ref G> constexpr inline bool graph_has_in_edges    = std::remove_cvref_t<G>::has_in_edges;
+    /** Checks whether or not a graph provides a dense integer id for every vertex. @ingroup Graph */
+    template <graph_ref G> constexpr inline bool graph_has_vertex_id   = std::remove_cvref_t<G>::has_vertex_id;
+    /** Checks whether or not a graph provides a dense integer id for every edge. @ingroup Graph */
+    template <graph_ref G> constexpr inline bool graph_has_edge_id     = std::remove_cvref_t<G>::has_edge_id;
 
     /** Checks that a graph is directed. @ingroup Graph */
     template <typename G> concept directed_graph     = graph_is_directed<G>;
@@ -124,6 +145,10 @@ namespace graphle {
     template <typename G> concept out_edges_graph    = graph_has_out_edges<G>;
     /** Checks whether or not a graph provides a list of in edges for a vertex. @ingroup Graph */
     template <typename G> concept in_edges_graph     = graph_has_in_edges<G>;
+    /** Checks whether or not a graph provides a dense integer id for every vertex. @ingroup Graph */
+    template <typename G> concept vertex_id_graph    = graph_has_vertex_id<G>;
+    /** Checks whether or not a graph provides a dense integer id for every edge. @ingroup Graph */
+    template <typename G> concept edge_id_graph      = graph_has_edge_id<G>;
 
 
     /** Checks whether or not T is a valid vertex type. @ingroup Graph */
@@ -0,0 +1,253 @@
+#pragma once
+
+#include <common.hpp>
+#include <utility/dynamic_bitset.hpp>
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+
+namespace graphle {
+    /**
+     * @ingroup Graph
+     * The set of neighbours of a cell in a @ref grid_graph.
+     */
+    enum class grid_connectivity {
+        /** 2D grid where every cell is connected to the cells that share an edge with it. */
+        FOUR,
+        /** 2D grid where every cell is connected to the cells that share an edge or a corner with it. */
+        EIGHT,
+        /** 3D grid where every cell is connected to the cells that share a face with it. */
+        SIX,
+        /** 3D grid where every cell is connected to the cells that share a face, an edge or a corner with it. */
+        TWENTY_SIX
+    };
+
+
+    namespace detail {
+        /** Returns the number of dimensions of a grid with the given connectivity. */
+        consteval std::size_t grid_dimensions(grid_connectivity connectivity) {
+            return (connectivity == grid_connectivity::FOUR || connectivity == grid_connectivity::EIGHT) ? 2 : 3;
+        }
+
+
+        /** Offset from a cell to one of its neighbours, together with the length of the step. */
+        template <std::size_t Dimensions> struct grid_step {
+            std::array<std::ptrdiff_t, Dimensions> offset;
+            double length;
+        };
+
+
+        /** Returns the offsets to all neighbours of a cell for the given connectivity. */
+        template <grid_connectivity Connectivity> consteval auto make_grid_steps(void) {
+            constexpr std::size_t dimensions = grid_dimensions(Connectivity);
+            constexpr bool diagonal          = (Connectivity == grid_connectivity::EIGHT || Connectivity == grid_connectivity::TWENTY_SIX);
+            constexpr std::size_t count      = diagonal ? (dimensions == 2 ? 8 : 26) : 2 * dimensions;
+
+            // std::sqrt is not constexpr, so the diagonal step lengths are provided as constants.
+            constexpr std::array<double, 4> lengths { 0.0, 1.0, 1.4142135623730951, 1.7320508075688772 };
+
+            std::array<grid_step<dimensions>, count> result {};
+            std::size_t index = 0;
+
+            for (std::size_t combination = 0; combination < (dimensions == 2 ? 9 : 27); ++combination) {
+                std::array<std::ptrdiff_t, dimensions> offset {};
+                std::size_t nonzero = 0, remainder = combination;
+
+                for (auto& component : offset) {
+                    component  = std::ptrdiff_t(remainder % 3) - 1;
+                    remainder /= 3;
+
+                    if (component != 0) ++nonzero;
+                }
+
+                if (nonzero == 0 || (!diagonal && nonzero > 1)) continue;
+                result[index++] = grid_step<dimensions> { offset, lengths[nonzero] };
+            }
+
+            return result;
+        }
+    }
+
+
+    /**
+     * @ingroup Graph
+     * Implicit 2D or 3D grid graph, where every cell of the grid is a vertex and the neighbours of a cell are computed from its index,
+     * rather than being stored. Each cell can be marked as impassable, in which case it has no edges to or from it,
+     * and can optionally have a cost, which is the cost of moving into the cell (multiplied by the length of the step for diagonal moves).
+     *
+     * Cells are identified by their index, with the first coordinate varying the fastest (i.e. index = x + y * width + z * width * height).
+     * Searches on grid graphs can be found in grid_search.hpp.
+     *
+     * @tparam Connectivity The set of neighbours of every cell. Also determines the number of dimensions of the grid.
+     * @tparam Cost The type used to store the cost of each cell. Should be a floating point type if the grid has diagonal connectivity,
+     *  since the cost of diagonal steps is scaled by their length.
+     */
+    template <grid_connectivity Connectivity, typename Cost = float> class grid_graph {
+    public:
+        constexpr static inline std::size_t dimensions = detail::grid_dimensions(Connectivity);
+        constexpr static inline auto steps             = detail::make_grid_steps<Connectivity>();
+
+        using coordinates = std::array<std::size_t, dimensions>;
+        using cost_type   = Cost;
+
+
+        /**
+         * Constructs a grid of the given size where every cell is passable and has a cost of 1.
+         * @param extent The size of the grid along each dimension.
+         */
+        constexpr explicit grid_graph(coordinates extent) : extent(extent) {
+            std::size_t cells = 1;
+            for (auto size : extent) cells *= size;
+
+            passable.assign(cells);
+            passable.set_all();
+        }
+
+
+        /** Marks the given cell as passable or impassable. */
+        constexpr void set_passable(std::size_t cell, bool value) {
+            if (value) passable.set(cell);
+            else passable.reset(cell);
+        }
+
+        [[nodiscard]] constexpr bool is_passable(std::size_t cell) const {
+            return passable.test(cell);
+        }
+
+
+        /** Sets the cost of moving into the given cell. The first call to this method allocates a cost for every cell. */
+        constexpr void set_cost(std::size_t cell, Cost cost) {
+            if (costs.empty()) costs.assign(num_cells(), Cost { 1 });
+            costs[cell] = cost;
+        }
+
+        /** Returns the cost of moving into the given cell. */
+        [[nodiscard]] constexpr Cost cost(std::size_t cell) const {
+            return costs.empty() ? Cost { 1 } : costs[cell];
+        }
+
+        /** Returns the lowest cost of any cell in the grid. */
+        [[nodiscard]] constexpr Cost min_cost(void) const {
+            Cost result = Cost { 1 };
+
+            if (!costs.empty()) {
+                result = std::numeric_limits<Cost>::max();
+                for (auto c : costs) result = std::min(result, c);
+            }
+
+            return result;
+        }
+
+        /** Returns true if cells have individual costs, or false if every cell has a cost of 1. */
+        [[nodiscard]] constexpr bool has_costs(void) const {
+            return !costs.empty();
+        }
+
+
+        /**
+         * Invokes the given callback for every passable neighbour of the given cell.
+         * @param cell The index of the cell to find the neighbours of.
+         * @param callback An object invocable as callback(std::size_t neighbour, Cost cost), where cost is the cost of moving to the neighbour.
+         */
+        template <typename F> constexpr void for_each_neighbor(std::size_t cell, F&& callback) const {
+            const auto position = coordinates_of(cell);
+
+            for (const auto& step : steps) {
+                std::size_t neighbor = 0, stride = 1;
+                bool in_bounds       = true;
+
+                for (std::size_t d = 0; d < dimensions; ++d) {
+                    const auto coordinate = std::ptrdiff_t(position[d]) + step.offset[d];
+                    in_bounds &= (coordinate >= 0 && coordinate < std::ptrdiff_t(extent[d]));
+
+                    neighbor += std::size_t(coordinate) * stride;
+                    stride   *= extent[d];
+                }
+
+                if (in_bounds && passable.test(neighbor)) {
+                    callback(neighbor, Cost(double(cost(neighbor)) * step.length));
+                }
+            }
+        }
+
+
+        /** Returns the index of the cell at the given coordinates. */
+        [[nodiscard]] constexpr std::size_t index_of(const coordinates& position) const {
+            std::size_t result = 0, stride = 1;
+
+            for (std::size_t d = 0; d < dimensions; ++d) {
+                result += position[d] * stride;
+                stride *= extent[d];
+            }
+
+            return result;
+        }
+
+        /** Returns the coordinates of the cell with the given index. */
+        [[nodiscard]] constexpr coordinates coordinates_of(std::size_t cell) const {
+            coordinates result;
+
+            for (std::size_t d = 0; d < dimensions; ++d) {
+                result[d] = cell % extent[d];
+                cell     /= extent[d];
+            }
+
+            return result;
+        }
+
+
+        /**
+         * Returns a lower bound for the cost of moving from cell a to cell b, assuming every cell has the lowest cost in the grid.
+         * This is the length of the shortest path on an empty grid with the same connectivity, multiplied by min_cost.
+         */
+        [[nodiscard]] constexpr double distance_lower_bound(std::size_t a, std::size_t b, Cost min_cost) const {
+            const auto pa = coordinates_of(a), pb = coordinates_of(b);
+
+            std::array<std::size_t, dimensions> delta;
+            for (std::size_t d = 0; d < dimensions; ++d) delta[d] = pa[d] > pb[d] ? pa[d] - pb[d] : pb[d] - pa[d];
+
+
+            double result = 0.0;
+
+            if constexpr (Connectivity == grid_connectivity::FOUR || Connectivity == grid_connectivity::SIX) {
+                for (auto d : delta) result += double(d);
+            } else {
+                // Move diagonally along as many axes as possible, then along fewer axes for the remaining distance.
+                std::ranges::sort(delta, std::greater<>{});
+
+                for (std::size_t d = 0; d < dimensions; ++d) {
+                    const std::size_t next = (d + 1 < dimensions) ? delta[d + 1] : 0;
+                    result += double(delta[d] - next) * steps_length(d + 1);
+                }
+            }
+
+            return result * double(min_cost);
+        }
+
+
+        [[nodiscard]] constexpr std::size_t num_cells(void) const { return passable.size(); }
+        [[nodiscard]] constexpr const coordinates& get_extent(void) const { return extent; }
+    private:
+        coordinates extent;
+        util::dynamic_bitset passable;
+        std::vector<Cost> costs;
+
+
+        /** Returns the length of a step along the given number of axes at once. */
+        constexpr static double steps_length(std::size_t axes) {
+            for (const auto& step : steps) {
+                std::size_t nonzero = 0;
+                for (auto component : step.offset) nonzero += (component != 0);
+
+                if (nonzero == axes) return step.length;
+            }
+
+            return 0.0;
+        }
+    };
+}
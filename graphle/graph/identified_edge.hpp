@@ -0,0 +1,59 @@
+#pragma once
+
+#include <common.hpp>
+#include <graph/vertex_compare.hpp>
+
+#include <cstddef>
+#include <limits>
+#include <tuple>
+#include <utility>
+
+
+namespace graphle {
+    /**
+     * @ingroup Graph
+     * An edge that carries a dense integer id next to its vertices.
+     * Since edges are otherwise just pairs of vertices, this is the only way to tell parallel edges apart, or to find per-edge data without hashing the edge.
+     *
+     * identified_edge derives from the regular edge type, so it can be used anywhere a regular edge is expected (losing the id in the process).
+     * Graphs whose edge getters return identified edges can provide their id to algorithms through @ref graph::get_edge_id,
+     * e.g. using @ref identified_edge_id. Regular edges implicitly convert to an identified edge with id npos.
+     *
+     * @tparam Vertex The vertex type of the edge (The edge will hold two Vertex*).
+     */
+    template <typename Vertex> struct identified_edge : detail::edge_for<Vertex> {
+        /** The id of edges that do not have an id. */
+        constexpr static inline std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+        std::size_t edge_id = npos;
+
+
+        constexpr identified_edge(void) = default;
+
+        constexpr identified_edge(detail::edge_for<Vertex> edge, std::size_t edge_id = npos) :
+            detail::edge_for<Vertex>(std::move(edge)),
+            edge_id(edge_id)
+        {}
+
+        constexpr identified_edge(Vertex* from, Vertex* to, std::size_t edge_id) :
+            detail::edge_for<Vertex>(from, to),
+            edge_id(edge_id)
+        {}
+    };
+
+
+    /**
+     * @ingroup Graph
+     * Edge id getter for graphs whose edges are @ref identified_edge "identified edges". Can be used as the get_edge_id member of a graphle::graph.
+     */
+    template <typename Vertex> struct identified_edge_id {
+        constexpr std::size_t operator()(const identified_edge<Vertex>& edge) const {
+            return edge.edge_id;
+        }
+    };
+}
+
+
+// Make identified edges usable with structured bindings like regular edges. Only the vertices are bound.
+template <typename Vertex> struct std::tuple_size<graphle::identified_edge<Vertex>> : std::integral_constant<std::size_t, 2> {};
+template <std::size_t I, typename Vertex> struct std::tuple_element<I, graphle::identified_edge<Vertex>> { using type = Vertex*; };
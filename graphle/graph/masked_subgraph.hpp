@@ -0,0 +1,266 @@
+#pragma once
+
+#include <common.hpp>
+#include <graph/graph.hpp>
+#include <utility/dynamic_bitset.hpp>
+#include <utility/edge_utils.hpp>
+#include <views/edge_from_vertex.hpp>
+
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+
+namespace graphle {
+    namespace detail {
+        /**
+         * Forward view of the elements of R for which Pred returns true, with a size that is known up front.
+         * Unlike std::views::filter, this view does not cache its first element, so it can be iterated when const (as required by e.g. @ref views::edge_from).
+         */
+        template <rng::view R, typename Pred> requires (rng::forward_range<const R> && rng::common_range<const R>)
+        class counted_filter_view : public rng::view_interface<counted_filter_view<R, Pred>> {
+        public:
+            class iterator {
+            public:
+                using value_type        = rng::range_value_t<const R>;
+                using difference_type   = std::ptrdiff_t;
+                using iterator_category = std::forward_iterator_tag;
+
+
+                constexpr iterator(void) = default;
+
+                constexpr iterator(const counted_filter_view* parent, rng::iterator_t<const R> current) : parent(parent), current(std::move(current)) {
+                    skip_rejected();
+                }
+
+
+                [[nodiscard]] constexpr decltype(auto) operator*(void) const {
+                    return *current;
+                }
+
+                constexpr iterator& operator++(void) {
+                    ++current;
+                    skip_rejected();
+                    return *this;
+                }
+
+                constexpr iterator operator++(int) {
+                    auto copy = *this;
+                    ++(*this);
+                    return copy;
+                }
+
+                [[nodiscard]] constexpr bool operator==(const iterator& other) const {
+                    return current == other.current;
+                }
+            private:
+                const counted_filter_view* parent = nullptr;
+                rng::iterator_t<const R> current;
+
+
+                constexpr void skip_rejected(void) {
+                    while (current != rng::end(parent->base_range) && !std::invoke(parent->predicate, *current)) ++current;
+                }
+            };
+
+
+            constexpr counted_filter_view(R base_range, Pred predicate, std::size_t count) :
+                base_range(std::move(base_range)),
+                predicate(std::move(predicate)),
+                count(count)
+            {}
+
+
+            [[nodiscard]] constexpr iterator begin(void) const { return iterator { this, rng::begin(base_range) }; }
+            [[nodiscard]] constexpr iterator end(void) const { return iterator { this, rng::end(base_range) }; }
+            [[nodiscard]] constexpr std::size_t size(void) const { return count; }
+        private:
+            R base_range;
+            Pred predicate;
+            std::size_t count;
+        };
+    }
+
+
+    /**
+     * @ingroup Graph
+     * View of the subgraph of a graph induced by a mask of vertex ids, optionally also restricted to the edges in a mask of edge ids.
+     * A vertex is part of the subgraph if the bit for its id is set in the vertex mask, and an edge is part of the subgraph
+     * if both its vertices are (and if an edge mask is used, the bit for its id is set in the edge mask).
+     *
+     * The base graph is not copied, so many subgraphs of the same graph can be used at the same time.
+     * Constructing the subgraph counts the out-degree of every vertex in the subgraph once,
+     * so degree queries on the subgraph are O(1) and its ranges of vertices and edges are sized without iterating them.
+     * The vertices of the subgraph are found by iterating the set bits of the vertex mask a word at a time, so words of the mask without any set bits are skipped entirely.
+     * If the base graph is a @ref contiguous_out_neighbors_graph, the neighbours of a vertex are found by scanning its neighbour span
+     * and testing each neighbour against the vertex mask, without constructing an edge for neighbours outside the subgraph.
+     *
+     * @tparam G The type of the base graph.
+     * @tparam UseEdgeMask True if the subgraph is also restricted by a mask of edge ids.
+     */
+    template <graph_ref G, bool UseEdgeMask = false> requires (
+        vertex_id_graph<G> &&
+        vertex_list_graph<G> &&
+        out_edges_graph<G> &&
+        (!UseEdgeMask || edge_id_graph<G>)
+    ) class masked_subgraph {
+    public:
+        using base_graph  = std::remove_cvref_t<G>;
+        using vertex_type = vertex_of<G>;
+
+
+        /**
+         * Constructs the subgraph of the given graph induced by the given vertex mask.
+         * @param graph The base graph. Only the graph object itself is copied, not the data it refers to.
+         * @param vertex_mask A bitmask with a bit set for the id of every vertex in the subgraph. Must contain a bit for every vertex id.
+         */
+        constexpr masked_subgraph(const base_graph& graph, util::dynamic_bitset vertex_mask) requires (!UseEdgeMask) :
+            base(graph),
+            vertex_mask(std::move(vertex_mask))
+        {
+            count_degrees();
+        }
+
+        /**
+         * Constructs the subgraph of the given graph induced by the given vertex mask and restricted to the edges in the given edge mask.
+         * @param graph The base graph. Only the graph object itself is copied, not the data it refers to.
+         * @param vertex_mask A bitmask with a bit set for the id of every vertex in the subgraph. Must contain a bit for every vertex id.
+         * @param edge_mask A bitmask with a bit set for the id of every edge in the subgraph. Must contain a bit for every edge id.
+         */
+        constexpr masked_subgraph(const base_graph& graph, util::dynamic_bitset vertex_mask, util::dynamic_bitset edge_mask) requires UseEdgeMask :
+            base(graph),
+            vertex_mask(std::move(vertex_mask)),
+            edge_mask(std::move(edge_mask))
+        {
+            count_degrees();
+        }
+
+
+        [[nodiscard]] constexpr bool contains(vertex_type vertex) const {
+            return vertex_mask.test(vertex_id(vertex));
+        }
+
+        template <typename E> [[nodiscard]] constexpr bool contains_edge(const E& edge) const {
+            if constexpr (UseEdgeMask) {
+                if (!edge_mask.test(std::size_t(std::invoke(base.get_edge_id, edge)))) return false;
+            }
+
+            return contains(edge.first) && contains(edge.second);
+        }
+
+
+        /** Returns the out edges of the given vertex of the subgraph, as a sized range. */
+        [[nodiscard]] constexpr auto out_edges(vertex_type vertex) const {
+            if constexpr (!UseEdgeMask && contiguous_out_neighbors_graph<G>) {
+                return out_neighbors(vertex) | views::edge_from(vertex);
+            } else {
+                return detail::counted_filter_view { base.get_out_edges(vertex), edge_filter { this }, out_degree(vertex) };
+            }
+        }
+
+        /** Returns the vertices the out edges of the given vertex of the subgraph go to, as a sized range. */
+        [[nodiscard]] constexpr auto out_neighbors(vertex_type vertex) const {
+            if constexpr (!UseEdgeMask && contiguous_out_neighbors_graph<G>) {
+                return detail::counted_filter_view { util::out_neighbors(base, vertex), vertex_filter { this }, out_degree(vertex) };
+            } else {
+                return out_edges(vertex) | views::transform(util::edge_target);
+            }
+        }
+
+        /** Returns the vertices of the subgraph in order of their ids, as a sized range. */
+        [[nodiscard]] constexpr auto vertices(void) const {
+            auto ids = vertex_mask.set_bits();
+
+            return rng::subrange { ids.begin(), ids.end(), vertex_count }
+                | views::transform([this] (std::size_t id) { return vertex_by_id[id]; });
+        }
+
+
+        /** Returns the number of out edges of the given vertex within the subgraph. This is O(1). */
+        [[nodiscard]] constexpr std::size_t out_degree(vertex_type vertex) const { return degrees[vertex_id(vertex)]; }
+        [[nodiscard]] constexpr std::size_t num_vertices(void) const { return vertex_count; }
+        [[nodiscard]] constexpr const util::dynamic_bitset& get_vertex_mask(void) const { return vertex_mask; }
+        [[nodiscard]] constexpr const util::dynamic_bitset& get_edge_mask(void) const requires UseEdgeMask { return edge_mask; }
+        [[nodiscard]] constexpr const base_graph& get_base(void) const { return base; }
+
+
+        /** Returns a graphle::graph view of this subgraph, with the same vertex ids, edge ids and comparators as the base graph. */
+        [[nodiscard]] constexpr auto view_as_graph(void) const {
+            return graph {
+                .deduce_vertex_type = meta::deduce_as<std::remove_pointer_t<vertex_type>>,
+                .deduce_is_directed = meta::deduce_as<std::bool_constant<graph_is_directed<G>>>,
+                .deduce_compare_as  = meta::deduce_as<compare_as_of<G>>,
+                .get_vertices       = [this] { return vertices(); },
+                .get_out_edges      = [this] (vertex_type v) { return out_edges(v); },
+                .get_vertex_id      = base.get_vertex_id,
+                .get_edge_id        = base.get_edge_id
+            };
+        }
+    private:
+        base_graph base;
+        util::dynamic_bitset vertex_mask;
+        util::dynamic_bitset edge_mask;
+
+        // Vertex and out-degree within the subgraph of every vertex, indexed by vertex id. Only entries for vertices in the subgraph are used.
+        std::vector<vertex_type> vertex_by_id;
+        std::vector<std::size_t> degrees;
+        std::size_t vertex_count = 0;
+
+
+        struct vertex_filter {
+            const masked_subgraph* self;
+            constexpr bool operator()(vertex_type vertex) const { return self->contains(vertex); }
+        };
+
+        struct edge_filter {
+            const masked_subgraph* self;
+            template <typename E> constexpr bool operator()(const E& edge) const { return self->contains_edge(edge); }
+        };
+
+
+        constexpr std::size_t vertex_id(vertex_type vertex) const {
+            return std::size_t(std::invoke(base.get_vertex_id, vertex));
+        }
+
+
+        constexpr void count_degrees(void) {
+            vertex_count = vertex_mask.count();
+            degrees.assign(vertex_mask.size(), 0);
+            vertex_by_id.resize(vertex_mask.size());
+
+            for (auto vertex : base.get_vertices()) vertex_by_id[vertex_id(vertex)] = vertex;
+
+            for (auto id : vertex_mask.set_bits()) {
+                const auto vertex = vertex_by_id[id];
+                auto& degree = degrees[id];
+
+                if constexpr (!UseEdgeMask && contiguous_out_neighbors_graph<G>) {
+                    for (auto neighbor : util::out_neighbors(base, vertex)) degree += contains(neighbor);
+                } else {
+                    for (const auto& edge : base.get_out_edges(vertex)) degree += contains_edge(edge);
+                }
+            }
+        }
+    };
+
+
+    /**
+     * @ingroup Graph
+     * Constructs a @ref masked_subgraph of the given graph induced by the given mask of vertex ids.
+     */
+    template <graph_ref G> requires (vertex_id_graph<G> && vertex_list_graph<G> && out_edges_graph<G>)
+    constexpr inline auto make_induced_subgraph(const G& graph, util::dynamic_bitset vertex_mask) {
+        return masked_subgraph<G, false> { graph, std::move(vertex_mask) };
+    }
+
+
+    /**
+     * @ingroup Graph
+     * Constructs a @ref masked_subgraph of the given graph induced by the given mask of vertex ids and restricted to the given mask of edge ids.
+     */
+    template <graph_ref G> requires (vertex_id_graph<G> && vertex_list_graph<G> && out_edges_graph<G> && edge_id_graph<G>)
+    constexpr inline auto make_filtered_subgraph(const G& graph, util::dynamic_bitset vertex_mask, util::dynamic_bitset edge_mask) {
+        return masked_subgraph<G, true> { graph, std::move(vertex_mask), std::move(edge_mask) };
+    }
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <common.hpp>
+
+#include <array>
+#include <span>
+#include <utility>
+
+
+namespace graphle {
+    /** An edge of a @ref static_graph, from the first vertex index to the second. @ingroup Graph */
+    using static_edge = std::pair<std::size_t, std::size_t>;
+
+
+    /**
+     * @ingroup Graph
+     * Directed graph with a number of vertices and edges fixed at compile time, stored as a CSR (Compressed Sparse Row) adjacency list.
+     * Vertices are identified by their index in [0, NumVertices).
+     *
+     * Unlike graphle::graph, this graph does not use pointers as vertices and all of its storage is contained in std::arrays,
+     * so it can be constructed and used by the algorithms in static_graph_algorithms.hpp entirely at compile time, e.g.:
+     * ~~~
+     * constexpr auto g = make_static_graph<3>(std::array { static_edge { 0, 1 }, static_edge { 1, 2 } });
+     * static_assert(alg::topological_sort(g).has_value());
+     * ~~~
+     *
+     * @tparam NumVertices The number of vertices in the graph.
+     * @tparam NumEdges The number of edges in the graph.
+     */
+    template <std::size_t NumVertices, std::size_t NumEdges> struct static_graph {
+        /** The out edges of vertex i are the targets in [offsets[i], offsets[i + 1]). */
+        std::array<std::size_t, NumVertices + 1> offsets {};
+        /** The target of every edge, grouped by source vertex. */
+        std::array<std::size_t, NumEdges> targets {};
+
+
+        /**
+         * Constructs a static_graph from the given list of edges. The order of the out-neighbours of each vertex is the order in which their edges appear in the list.
+         * @param edges A list of edges. Every vertex index in the list must be smaller than NumVertices.
+         */
+        constexpr static static_graph from_edges(const std::array<static_edge, NumEdges>& edges) {
+            static_graph result;
+
+            for (const auto& [from, to] : edges) ++result.offsets[from + 1];
+            for (std::size_t i = 0; i < NumVertices; ++i) result.offsets[i + 1] += result.offsets[i];
+
+            auto cursor = result.offsets;
+            for (const auto& [from, to] : edges) result.targets[cursor[from]++] = to;
+
+            return result;
+        }
+
+
+        /** Returns the indices of the out-neighbours of the given vertex. */
+        [[nodiscard]] constexpr std::span<const std::size_t> out_neighbors(std::size_t vertex) const {
+            return std::span { targets }.subspan(offsets[vertex], offsets[vertex + 1] - offsets[vertex]);
+        }
+
+        [[nodiscard]] constexpr std::size_t out_degree(std::size_t vertex) const {
+            return offsets[vertex + 1] - offsets[vertex];
+        }
+
+        [[nodiscard]] constexpr bool has_edge(std::size_t from, std::size_t to) const {
+            for (auto target : out_neighbors(from)) {
+                if (target == to) return true;
+            }
+
+            return false;
+        }
+
+
+        [[nodiscard]] constexpr static std::size_t num_vertices(void) { return NumVertices; }
+        [[nodiscard]] constexpr static std::size_t num_edges(void) { return NumEdges; }
+    };
+
+
+    /**
+     * @ingroup Graph
+     * Constructs a @ref static_graph with the given number of vertices from the given list of edges.
+     * @tparam NumVertices The number of vertices in the graph.
+     * @param edges A list of edges. Every vertex index in the list must be smaller than NumVertices.
+     */
+    template <std::size_t NumVertices, std::size_t NumEdges>
+    constexpr inline static_graph<NumVertices, NumEdges> make_static_graph(const std::array<static_edge, NumEdges>& edges) {
+        return static_graph<NumVertices, NumEdges>::from_edges(edges);
+    }
+
+
+    /** @copydoc make_static_graph */
+    template <std::size_t NumVertices>
+    constexpr inline static_graph<NumVertices, 0> make_static_graph(void) {
+        return static_graph<NumVertices, 0> {};
+    }
+}
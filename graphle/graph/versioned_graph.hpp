@@ -0,0 +1,333 @@
+#pragma once
+
+#include <common.hpp>
+#include <graph/graph.hpp>
+#include <meta/value.hpp>
+#include <utility/epoch_reclaimer.hpp>
+#include <views/edge_from_vertex.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bitset>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+
+namespace graphle {
+    /**
+     * @ingroup Graph
+     * Owning graph container which allows readers on other threads to run Graphle algorithms on the graph while it is being modified.
+     *
+     * The graph is modified by a single writer thread. Modifications are not visible to readers until the writer calls publish,
+     * which creates a new immutable snapshot of the graph. Readers pin a snapshot, which they can view as a graphle::graph,
+     * and which will remain unchanged and valid until it is released, no matter how the graph is modified in the meantime.
+     * Pinning a snapshot is lock-free and does not copy the graph.
+     *
+     * Adjacency lists are stored in blocks of BlockSize vertices, which are shared between snapshots and copied by the writer when they are first modified after a publish.
+     * Publishing a snapshot therefore costs O(V / BlockSize) plus the cost of copying any modified blocks.
+     * Old snapshots are reclaimed using epoch-based reclamation once no reader has them pinned anymore.
+     *
+     * @note Snapshots version the structure of the graph (its vertices and edges). The values stored in vertices are shared between snapshots,
+     *  and should not be modified while they may be read by other threads.
+     *
+     * @tparam T The type of value stored in each vertex.
+     * @tparam BlockSize The number of vertices whose adjacency lists are grouped into a single copy-on-write block.
+     */
+    template <typename T, std::size_t BlockSize = 64> class versioned_graph {
+    public:
+        /** Vertex type of the graph. Vertices are never moved in memory, so pointers to vertices remain valid until the vertex is removed. */
+        struct vertex {
+            T value;
+            std::size_t id;
+        };
+
+    private:
+        struct adjacency_block {
+            const std::optional<vertex>* vertices;
+            std::array<std::vector<const vertex*>, BlockSize> out;
+            std::array<std::vector<const vertex*>, BlockSize> in;
+            std::bitset<BlockSize> alive;
+        };
+
+
+        struct snapshot_data {
+            std::vector<std::shared_ptr<const adjacency_block>> blocks;
+            std::size_t num_vertices;
+            std::uint64_t version;
+
+
+            [[nodiscard]] const adjacency_block& block_of(std::size_t id) const { return *blocks[id / BlockSize]; }
+            [[nodiscard]] std::size_t capacity(void) const { return blocks.size() * BlockSize; }
+            [[nodiscard]] bool is_alive(std::size_t id) const { return block_of(id).alive.test(id % BlockSize); }
+            [[nodiscard]] const vertex* vertex_at(std::size_t id) const { return std::addressof(*block_of(id).vertices[id % BlockSize]); }
+        };
+
+
+        /** Sized range over the live vertices of a snapshot. */
+        class vertex_range : public rng::view_interface<vertex_range> {
+        public:
+            class iterator {
+            public:
+                using value_type       = const vertex*;
+                using difference_type  = std::ptrdiff_t;
+                using iterator_concept = std::forward_iterator_tag;
+
+                constexpr iterator(void) = default;
+                iterator(const snapshot_data* data, std::size_t id) : data(data), id(id) { skip_dead(); }
+
+                [[nodiscard]] value_type operator*(void) const { return data->vertex_at(id); }
+                [[nodiscard]] bool operator==(const iterator& other) const { return id == other.id; }
+
+                iterator& operator++(void) { ++id; skip_dead(); return *this; }
+                iterator  operator++(int)  { auto old = *this; ++(*this); return old; }
+            private:
+                const snapshot_data* data = nullptr;
+                std::size_t id = 0;
+
+                void skip_dead(void) {
+                    while (id < data->capacity() && !data->is_alive(id)) ++id;
+                }
+            };
+
+
+            constexpr vertex_range(void) = default;
+            explicit vertex_range(const snapshot_data* data) : data(data) {}
+
+            [[nodiscard]] iterator begin(void) const { return iterator { data, 0 }; }
+            [[nodiscard]] iterator end  (void) const { return iterator { data, data->capacity() }; }
+            [[nodiscard]] std::size_t size(void) const { return data->num_vertices; }
+        private:
+            const snapshot_data* data = nullptr;
+        };
+
+    public:
+        /**
+         * A pinned, immutable version of the graph. The snapshot remains valid until it is destroyed,
+         * regardless of any modifications made to the graph after it was pinned.
+         */
+        class snapshot {
+        public:
+            snapshot(snapshot&&) noexcept = default;
+            snapshot& operator=(snapshot&&) noexcept = default;
+
+
+            /** Returns a graphle::graph view of this snapshot. The view may only be used while the snapshot is alive. */
+            [[nodiscard]] auto view_as_graph(void) const {
+                const snapshot_data* d = data;
+
+                return graph {
+                    .deduce_vertex_type = meta::deduce_as<const vertex>,
+                    .get_vertices       = [d] { return vertex_range { d }; },
+                    .get_out_edges      = [d] (const vertex* v) { return views::all(d->block_of(v->id).out[v->id % BlockSize]) | views::edge_from(v); },
+                    .get_in_edges       = [d] (const vertex* v) { return views::all(d->block_of(v->id).in[v->id % BlockSize]) | views::edge_to(v); }
+                };
+            }
+
+
+            /** Returns the out-neighbours of the given vertex in this snapshot. */
+            [[nodiscard]] const std::vector<const vertex*>& out_neighbors(const vertex* v) const {
+                return data->block_of(v->id).out[v->id % BlockSize];
+            }
+
+            /** Returns the in-neighbours of the given vertex in this snapshot. */
+            [[nodiscard]] const std::vector<const vertex*>& in_neighbors(const vertex* v) const {
+                return data->block_of(v->id).in[v->id % BlockSize];
+            }
+
+            /** Returns true if the given vertex is part of this snapshot. */
+            [[nodiscard]] bool contains(const vertex* v) const {
+                return v->id < data->capacity() && data->is_alive(v->id) && data->vertex_at(v->id) == v;
+            }
+
+
+            /** Returns the version number of this snapshot, as returned by versioned_graph::publish. */
+            [[nodiscard]] std::uint64_t version(void) const { return data->version; }
+            /** Returns the number of vertices in this snapshot. */
+            [[nodiscard]] std::size_t num_vertices(void) const { return data->num_vertices; }
+        private:
+            friend class versioned_graph;
+
+            snapshot(util::epoch_reclaimer::guard guard, const snapshot_data* data) : guard(std::move(guard)), data(data) {}
+
+            util::epoch_reclaimer::guard guard;
+            const snapshot_data* data;
+        };
+
+
+        /** @param max_readers The maximum number of snapshots that can be pinned at the same time before pin starts spinning. */
+        explicit versioned_graph(std::size_t max_readers = 64) : reclaimer(max_readers) {
+            current.store(new snapshot_data { .blocks = {}, .num_vertices = 0, .version = 0 });
+        }
+
+        versioned_graph(const versioned_graph&) = delete;
+        versioned_graph& operator=(const versioned_graph&) = delete;
+
+        /** No snapshots may be pinned when the graph is destroyed. */
+        ~versioned_graph(void) {
+            // Retired snapshots reference the vertex storage, so they must be destroyed before it is.
+            reclaimer.collect();
+            delete current.load();
+        }
+
+
+        /**
+         * Pins the most recently published version of the graph. May be called from any thread.
+         * @return A snapshot which remains valid and unchanged until it is destroyed.
+         */
+        [[nodiscard]] snapshot pin(void) const {
+            // Note: the epoch must be pinned before loading the current snapshot, otherwise the writer could reclaim it in between.
+            auto guard = reclaimer.pin();
+            return snapshot { std::move(guard), current.load(std::memory_order_seq_cst) };
+        }
+
+
+        /**
+         * Makes all modifications since the last call to publish visible to readers calling pin.
+         * Snapshots that are no longer reachable are reclaimed once no reader has them pinned anymore.
+         * @return The version number of the newly published snapshot.
+         */
+        std::uint64_t publish(void) {
+            auto* next = new snapshot_data {
+                .blocks       = { blocks.begin(), blocks.end() },
+                .num_vertices = live_vertices,
+                .version      = ++latest_version
+            };
+
+            const snapshot_data* previous = current.exchange(next, std::memory_order_seq_cst);
+            std::fill(block_shared.begin(), block_shared.end(), true);
+
+
+            // Removed vertices may still be referenced by the previous snapshot, so their slots can only be reused once it has been reclaimed.
+            reclaimer.retire([this, previous, removed = std::move(removed_ids)] {
+                delete previous;
+
+                for (auto id : removed) {
+                    vertex_chunks[id / BlockSize][id % BlockSize].reset();
+                    free_ids.push_back(id);
+                }
+            });
+
+            removed_ids.clear();
+            reclaimer.collect();
+
+            return latest_version;
+        }
+
+
+        /** Destroys any old snapshots that are no longer pinned by any reader. This is also done automatically by publish. */
+        void collect(void) {
+            reclaimer.collect();
+        }
+
+
+        /** Adds a new vertex with the given value to the graph. */
+        vertex* add_vertex(T value) {
+            std::size_t id;
+
+            if (!free_ids.empty()) {
+                id = free_ids.back();
+                free_ids.pop_back();
+            } else {
+                id = next_id++;
+
+                if (id / BlockSize == vertex_chunks.size()) {
+                    vertex_chunks.emplace_back(std::make_unique<std::optional<vertex>[]>(BlockSize));
+                    blocks.emplace_back(std::make_shared<adjacency_block>(adjacency_block { .vertices = vertex_chunks.back().get() }));
+                    block_shared.push_back(false);
+                }
+            }
+
+
+            auto& slot = vertex_chunks[id / BlockSize][id % BlockSize];
+            slot.emplace(vertex { std::move(value), id });
+
+            writable_block(id).alive.set(id % BlockSize);
+            ++live_vertices;
+
+            return std::addressof(*slot);
+        }
+
+
+        /** Removes the given vertex and all edges to and from it from the graph. */
+        void remove_vertex(const vertex* v) {
+            const std::size_t i = v->id % BlockSize;
+
+            for (auto* target : writable_block(v->id).out[i]) erase_one(writable_block(target->id).in[target->id % BlockSize], v);
+            for (auto* source : writable_block(v->id).in[i])  erase_one(writable_block(source->id).out[source->id % BlockSize], v);
+
+            auto& block = writable_block(v->id);
+            block.out[i].clear();
+            block.in[i].clear();
+            block.alive.reset(i);
+
+            removed_ids.push_back(v->id);
+            --live_vertices;
+        }
+
+
+        /** Adds an edge from the vertex 'from' to the vertex 'to'. Parallel edges are allowed. */
+        void add_edge(const vertex* from, const vertex* to) {
+            writable_block(from->id).out[from->id % BlockSize].push_back(to);
+            writable_block(to->id).in[to->id % BlockSize].push_back(from);
+        }
+
+
+        /**
+         * Removes an edge from the vertex 'from' to the vertex 'to'. If there are multiple such edges, only one of them is removed.
+         * @return True if an edge was removed, or false if no such edge exists.
+         */
+        bool remove_edge(const vertex* from, const vertex* to) {
+            const auto& out = blocks[from->id / BlockSize]->out[from->id % BlockSize];
+            if (std::ranges::find(out, to) == out.end()) return false;
+
+            erase_one(writable_block(from->id).out[from->id % BlockSize], to);
+            erase_one(writable_block(to->id).in[to->id % BlockSize], from);
+            return true;
+        }
+
+
+        /** Returns the number of vertices in the graph, including unpublished changes. */
+        [[nodiscard]] std::size_t num_vertices(void) const { return live_vertices; }
+        /** Returns the version number of the most recently published snapshot. */
+        [[nodiscard]] std::uint64_t version(void) const { return latest_version; }
+        /** Returns the number of old snapshots that are still waiting to be reclaimed. */
+        [[nodiscard]] std::size_t num_retired_snapshots(void) const { return reclaimer.num_retired(); }
+    private:
+        std::atomic<const snapshot_data*> current;
+
+        // Writer state. Blocks for which block_shared is true are referenced by a published snapshot and must be copied before being modified.
+        std::vector<std::unique_ptr<std::optional<vertex>[]>> vertex_chunks;
+        std::vector<std::shared_ptr<adjacency_block>> blocks;
+        std::vector<bool> block_shared;
+
+        std::vector<std::size_t> free_ids;
+        std::vector<std::size_t> removed_ids;
+        std::size_t next_id          = 0;
+        std::size_t live_vertices    = 0;
+        std::uint64_t latest_version = 0;
+
+        // Declared last so it is destroyed first: pending deleters write into vertex_chunks and free_ids.
+        mutable util::epoch_reclaimer reclaimer;
+
+
+        adjacency_block& writable_block(std::size_t id) {
+            const std::size_t b = id / BlockSize;
+
+            if (block_shared[b]) {
+                blocks[b] = std::make_shared<adjacency_block>(*blocks[b]);
+                block_shared[b] = false;
+            }
+
+            return *blocks[b];
+        }
+
+
+        static void erase_one(std::vector<const vertex*>& list, const vertex* v) {
+            if (auto it = std::ranges::find(list, v); it != list.end()) list.erase(it);
+        }
+    };
+}
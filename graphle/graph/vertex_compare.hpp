@@ -37,7 +37,8 @@ namespace graphle {
                 return vertex_comparator(a.first, b.first) && vertex_comparator(a.second, b.second);
             }
 
-            constexpr bool operator()(const const_edge& a, const const_edge& b) const {
+            // If Vertex is already const, edge and const_edge are the same type.
+            constexpr bool operator()(const const_edge& a, const const_edge& b) const requires (!std::is_const_v<Vertex>) {
                 return vertex_comparator(a.first, b.first) && vertex_comparator(a.second, b.second);
             }
         };
@@ -55,14 +56,14 @@ namespace graphle {
 
         /** Hasher that hashes a vertex's address. */
         template <typename Vertex> struct vertex_address {
-            constexpr bool operator()(const Vertex* a) const {
-                return std::hash<Vertex*>{}(a);
+            constexpr std::size_t operator()(const Vertex* a) const {
+                return std::hash<const Vertex*>{}(a);
             }
         };
 
         /** Hasher that invokes std::hash for the vertex (not the pointer). */
         template <typename Vertex> struct vertex_value {
-            constexpr bool operator()(const Vertex* a) const {
+            constexpr std::size_t operator()(const Vertex* a) const {
                 return std::hash<Vertex>{}(*a);
             }
         };
@@ -74,11 +75,12 @@ namespace graphle {
             using edge       = std::pair<Vertex*, Vertex*>;
             using const_edge = std::pair<const Vertex*, const Vertex*>;
 
-            constexpr bool operator()(const edge& a) const {
+            constexpr std::size_t operator()(const edge& a) const {
                 return hash_combine(vertex_hasher(a.first), vertex_hasher(a.second));
             }
 
-            constexpr bool operator()(const const_edge& a) const {
+            // If Vertex is already const, edge and const_edge are the same type.
+            constexpr std::size_t operator()(const const_edge& a) const requires (!std::is_const_v<Vertex>) {
                 return hash_combine(vertex_hasher(a.first), vertex_hasher(a.second));
             }
         };
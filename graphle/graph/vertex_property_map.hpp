@@ -0,0 +1,140 @@
+#pragma once
+
+#include <common.hpp>
+#include <graph/graph.hpp>
+#include <utility/flat_slot_map.hpp>
+#include <utility/property_columns.hpp>
+
+#include <functional>
+#include <limits>
+#include <type_traits>
+
+
+namespace graphle {
+    /**
+     * @ingroup Graph
+     * Stores one or more properties for the vertices of a graph in a structure-of-arrays layout:
+     * each property is stored in its own contiguous column, and every vertex is assigned a slot which is its index into each column.
+     *
+     * If the graph provides vertex ids (See @ref vertex_id_graph), the id of a vertex is used as its slot directly.
+     * Otherwise, slots are assigned on first access using a @ref util::flat_slot_map.
+     * Vertices that have not been assigned a value yet have the default value provided for each property.
+     *
+     * Columns can be accessed directly with @ref util::property_columns::column to read or write the properties of all vertices at once.
+     * The map can also be invoked as map(vertex) to get the first property, so it can be used wherever a @ref vertex_value_getter is expected.
+     *
+     * @tparam G The type of graph the map stores properties for.
+     * @tparam Ts The types of the properties. bool is not supported since std::vector<bool> is not contiguous (use e.g. std::uint8_t instead).
+     */
+    template <graph_ref G, typename... Ts> requires (sizeof...(Ts) > 0 && (!std::is_same_v<Ts, bool> && ...))
+    class vertex_property_map : public util::property_columns<Ts...> {
+    public:
+        using vertex_type = vertex_of<G>;
+        using columns     = util::property_columns<Ts...>;
+        template <std::size_t I> using property_type = typename columns::template property_type<I>;
+
+        /** True if the map uses the graph's vertex ids as slots, false if it hashes the vertices instead. */
+        constexpr static inline bool uses_vertex_id = vertex_id_graph<G>;
+        /** Returned by @ref find_slot for vertices without a slot. */
+        constexpr static inline std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+
+        /**
+         * Constructs a new property map for the given graph. If the graph has a vertex list, storage for every vertex is allocated up front.
+         * @param graph The graph to store properties for. The map does not keep a reference to the graph.
+         * @param defaults The value of each property for vertices that have not been assigned a value.
+         */
+        constexpr explicit vertex_property_map(const std::remove_cvref_t<G>& graph, Ts... defaults) :
+            columns(std::move(defaults)...),
+            slots(make_slots(graph))
+        {
+            if constexpr (vertex_list_graph<G>) {
+                const auto count = std::size_t(rng::size(graph.get_vertices()));
+
+                if constexpr (uses_vertex_id) {
+                    columns::resize(count);
+                } else {
+                    columns::reserve(count);
+                    slots.reserve(count);
+                }
+            }
+        }
+
+
+        /** Returns the slot of the given vertex, assigning it a new slot if it does not have one yet. */
+        constexpr std::size_t slot_of(vertex_type vertex) {
+            std::size_t slot;
+
+            if constexpr (uses_vertex_id) slot = std::size_t(std::invoke(slots, vertex));
+            else slot = slots.insert(vertex).first;
+
+            if (slot >= columns::num_slots()) columns::resize(slot + 1);
+            return slot;
+        }
+
+
+        /** Returns the slot of the given vertex, or npos if it does not have one. */
+        [[nodiscard]] constexpr std::size_t find_slot(vertex_type vertex) const {
+            if constexpr (uses_vertex_id) {
+                const auto slot = std::size_t(std::invoke(slots, vertex));
+                return slot < columns::num_slots() ? slot : npos;
+            } else {
+                return slots.find(vertex);
+            }
+        }
+
+
+        /** Returns a reference to property I of the given vertex. */
+        template <std::size_t I = 0> constexpr property_type<I>& get(vertex_type vertex) {
+            return columns::template at<I>(slot_of(vertex));
+        }
+
+        /** Returns the value of property I of the given vertex, or its default value if the vertex has no slot. */
+        template <std::size_t I = 0> [[nodiscard]] constexpr property_type<I> value(vertex_type vertex) const {
+            return columns::template value<I>(find_slot(vertex));
+        }
+
+        /** Sets property I of the given vertex. */
+        template <std::size_t I = 0> constexpr void set(vertex_type vertex, property_type<I> value) {
+            get<I>(vertex) = std::move(value);
+        }
+
+        /** Equivalent to value<0>(vertex). */
+        [[nodiscard]] constexpr property_type<0> operator()(vertex_type vertex) const {
+            return value<0>(vertex);
+        }
+
+
+        /** Returns the vertex with the given slot. Only available if the map does not use vertex ids. */
+        [[nodiscard]] constexpr vertex_type vertex_at(std::size_t slot) const requires (!uses_vertex_id) {
+            return slots.key_at(slot);
+        }
+
+        [[nodiscard]] constexpr bool contains(vertex_type vertex) const { return find_slot(vertex) != npos; }
+    private:
+        using slot_map = std::conditional_t<
+            uses_vertex_id,
+            typename std::remove_cvref_t<G>::get_vertex_id_t,
+            util::flat_slot_map<vertex_type, vertex_hash_of<G>, vertex_compare_of<G>>
+        >;
+
+        slot_map slots;
+
+
+        // Vertex id getters may be lambdas with captures, which can be copied but not default-constructed or assigned.
+        constexpr static slot_map make_slots(const std::remove_cvref_t<G>& graph) {
+            if constexpr (uses_vertex_id) return graph.get_vertex_id;
+            else return slot_map {};
+        }
+    };
+
+
+    /**
+     * @ingroup Graph
+     * Constructs a @ref vertex_property_map for the given graph, with the property types deduced from the given default values.
+     */
+    template <graph_ref G, typename... Ts>
+    constexpr inline auto make_vertex_property_map(const G& graph, Ts... defaults) {
+        return vertex_property_map<G, Ts...> { graph, std::move(defaults)... };
+    }
+}
@@ -5,14 +5,27 @@
 #pragma once
 
 #include <algorithm.hpp>
+#include <algorithm/bit_matrix_algorithms.hpp>
+#include <algorithm/graph_partition.hpp>
+#include <algorithm/parallel_reachability.hpp>
+#include <algorithm/static_graph_algorithms.hpp>
 #include <algorithm/strongly_connected_components.hpp>
 #include <common.hpp>
 #include <doxygen.hpp>
 #include <graph.hpp>
+#include <graph/bit_matrix_graph.hpp>
+#include <graph/compact_graph.hpp>
 #include <graph/constraint_debug_helper.hpp>
+#include <graph/edge_property_map.hpp>
 #include <graph/graph.hpp>
 #include <graph/graph_concepts.hpp>
+#include <graph/grid_graph.hpp>
+#include <graph/identified_edge.hpp>
+#include <graph/masked_subgraph.hpp>
+#include <graph/static_graph.hpp>
+#include <graph/versioned_graph.hpp>
 #include <graph/vertex_compare.hpp>
+#include <graph/vertex_property_map.hpp>
 #include <meta.hpp>
 #include <meta/concepts.hpp>
 #include <meta/const_pointer.hpp>
@@ -20,8 +33,18 @@
 #include <meta/type_list.hpp>
 #include <meta/value.hpp>
 #include <search.hpp>
+#include <search/bidirectional_search.hpp>
 #include <search/breadth_first_search.hpp>
+#include <search/breadth_first_tree.hpp>
+#include <search/classified_depth_first_search.hpp>
 #include <search/depth_first_search.hpp>
+#include <search/depth_limited_search.hpp>
+#include <search/dfs_frame.hpp>
+#include <search/direction_optimizing_search.hpp>
+#include <search/grid_search.hpp>
+#include <search/multi_source_search.hpp>
+#include <search/parallel_search.hpp>
+#include <search/resumable_search.hpp>
 #include <search/search_impl.hpp>
 #include <search/visitor.hpp>
 #include <storage.hpp>
@@ -29,14 +52,26 @@
 #include <storage/storage_provider.hpp>
 #include <storage/storage_provider_helpers.hpp>
 #include <utility.hpp>
+#include <utility/atomic_bitset.hpp>
+#include <utility/dynamic_bitset.hpp>
 #include <utility/edge_utils.hpp>
+#include <utility/epoch_reclaimer.hpp>
+#include <utility/flat_slot_map.hpp>
 #include <utility/functional.hpp>
+#include <utility/jagged_array.hpp>
+#include <utility/jagged_array_output_iterator.hpp>
+#include <utility/prefetch.hpp>
+#include <utility/property_columns.hpp>
 #include <utility/range_utils.hpp>
 #include <utility/storage_utils.hpp>
+#include <utility/thread_pool.hpp>
 #include <utility/vec_of_vecs_output_iterator.hpp>
+#include <utility/vertex_index.hpp>
 #include <utility/vertex_utils.hpp>
+#include <utility/work_budget.hpp>
 #include <views.hpp>
 #include <views/duplicate_transposed_edges.hpp>
 #include <views/edge_from_vertex.hpp>
 #include <views/edge_perspective.hpp>
 #include <views/maybe_exists.hpp>
+#include <views/search_view.hpp>
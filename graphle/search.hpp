@@ -4,7 +4,17 @@
 
 #pragma once
 
+#include <search/bidirectional_search.hpp>
 #include <search/breadth_first_search.hpp>
+#include <search/breadth_first_tree.hpp>
+#include <search/classified_depth_first_search.hpp>
 #include <search/depth_first_search.hpp>
+#include <search/depth_limited_search.hpp>
+#include <search/dfs_frame.hpp>
+#include <search/direction_optimizing_search.hpp>
+#include <search/grid_search.hpp>
+#include <search/multi_source_search.hpp>
+#include <search/parallel_search.hpp>
+#include <search/resumable_search.hpp>
 #include <search/search_impl.hpp>
 #include <search/visitor.hpp>
@@ -0,0 +1,245 @@
+#pragma once
+
+#include <common.hpp>
+#include <graph/graph.hpp>
+#include <meta/value.hpp>
+#include <search/direction_optimizing_search.hpp>
+#include <storage/storage_provider.hpp>
+#include <storage/default_storage_provider.hpp>
+#include <utility/edge_utils.hpp>
+#include <utility/vertex_index.hpp>
+#include <utility/work_budget.hpp>
+
+#include <algorithm>
+#include <optional>
+#include <utility>
+#include <vector>
+
+
+namespace graphle::search {
+    /**
+     * @ingroup Search
+     * Finds a shortest path (in number of edges) from the source vertex to the target vertex by searching from both ends at once.
+     *
+     * The search keeps a breadth first search layer for both ends, and always expands the layer containing the fewest vertices:
+     * the forward layer along the out edges of its vertices and the backward layer along their in edges. The search stops as soon as one side
+     * reaches a vertex the other side has reached, since no shorter path can exist at that point. On graphs where the number of vertices
+     * within some distance grows quickly, this visits far fewer vertices than a breadth first search from the source.
+     *
+     * The backward side uses the in edges of the graph if it has them, or the out edges if the graph is non-directed.
+     * Otherwise the in edges of every vertex are gathered once before the search starts, which requires visiting every edge of the graph.
+     *
+     * @param graph A graphle::graph to search.
+     * @param source The vertex the path starts at.
+     * @param target The vertex the path ends at.
+     * @param budget A @ref util::work_budget limiting the search. If an lvalue is passed, the work performed is consumed from it.
+     *  Every expanded layer consumes one unit of work for every vertex in it, plus one for every edge scanned, and the budget is only checked between layers.
+     * @param forward_parent_provider An optional storage-provider which can provide a unordered-map-like type from vertices to edges for the algorithm to use.
+     * @param backward_parent_provider An optional storage-provider which can provide a unordered-map-like type from vertices to edges for the algorithm to use.
+     *  Both maps are in use at the same time, so this must not return the same object as forward_parent_provider.
+     * @param index_provider An optional storage-provider which can provide a unordered-map-like type for the algorithm to use.
+     *  Only used if the in edges of the graph have to be gathered, and the graph has no vertex ids.
+     * @return A pair of the status of the search and the edges on a shortest path from the source to the target, in order,
+     *  or std::nullopt if the target is not reachable from the source or the search was cancelled.
+     *  The status is FINISHED if the search finished, or CANCELLED if the budget was exhausted first.
+     *  The path is empty if the source and the target are the same vertex.
+     *
+     * @graph_requires{
+     *  (
+     *      out_edges_graph<G> ||
+     *      (non_directed_graph<G> && in_edges_graph<G>)
+     *  ) && (
+     *      in_edges_graph<G> ||
+     *      non_directed_graph<G> ||
+     *      vertex_list_graph<G>
+     *  )
+     * }
+     */
+    template <
+        graph_ref G,
+        util::budget Budget,
+        store::storage_provider_ref<store::storage_type::UNORDERED_MAP, vertex_of<G>, edge_of<G>, vertex_hash_of<G>, vertex_compare_of<G>> PFP
+            = store::default_provided_t<store::storage_type::UNORDERED_MAP, vertex_of<G>, edge_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>,
+        store::storage_provider_ref<store::storage_type::UNORDERED_MAP, vertex_of<G>, edge_of<G>, vertex_hash_of<G>, vertex_compare_of<G>> PBP
+            = store::default_provided_t<store::storage_type::UNORDERED_MAP, vertex_of<G>, edge_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>,
+        store::storage_provider_ref<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>> PM
+            = store::default_provided_t<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>
+    > requires (
+        (out_edges_graph<G> || (non_directed_graph<G> && in_edges_graph<G>)) &&
+        (in_edges_graph<G> || non_directed_graph<G> || vertex_list_graph<G>)
+    ) constexpr inline std::pair<util::run_status, std::optional<std::vector<edge_of<G>>>> bidirectional_shortest_path(
+        G&& graph,
+        vertex_of<G> source,
+        vertex_of<G> target,
+        Budget&& budget,
+        PFP&& forward_parent_provider  = store::get_default_storage_provider<store::storage_type::UNORDERED_MAP, vertex_of<G>, edge_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>(),
+        PBP&& backward_parent_provider = store::get_default_storage_provider<store::storage_type::UNORDERED_MAP, vertex_of<G>, edge_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>(),
+        PM&&  index_provider           = store::get_default_storage_provider<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>()
+    ) {
+        // For non-directed graphs, the out edges of a vertex are also its in edges.
+        constexpr bool has_native_in_edges = graph_has_in_edges<G> || !graph_is_directed<G>;
+
+        using path_type = std::vector<edge_of<G>>;
+
+        const vertex_compare_of<G> equal {};
+        if (equal(source, target)) return std::pair { util::run_status::FINISHED, std::optional { path_type {} } };
+
+
+        // The edge through which every vertex was reached, excluding the source and the target themselves.
+        // For the backward side, this is the edge leading from the vertex towards the target.
+        decltype(auto) forward_parents  = forward_parent_provider();
+        decltype(auto) backward_parents = backward_parent_provider();
+
+        auto reached_forward  = [&] (vertex_of<G> v) { return equal(v, source) || forward_parents.contains(v);  };
+        auto reached_backward = [&] (vertex_of<G> v) { return equal(v, target) || backward_parents.contains(v); };
+
+
+        std::size_t work = 0;
+
+        // Returns the path through the given vertex, which must have been reached by both sides.
+        // The work of the final layer is consumed as well, so an lvalue budget reflects the work of the entire search.
+        auto make_path = [&] (vertex_of<G> meeting_point) {
+            budget.consume(work);
+            path_type path;
+
+            for (vertex_of<G> v = meeting_point; !equal(v, source); v = path.back().first) path.push_back(forward_parents.at(v));
+            std::ranges::reverse(path);
+
+            for (vertex_of<G> v = meeting_point; !equal(v, target); v = path.back().second) path.push_back(backward_parents.at(v));
+
+            return std::pair { util::run_status::FINISHED, std::optional { std::move(path) } };
+        };
+
+
+        std::vector<vertex_of<G>> forward_frontier { source }, backward_frontier { target }, next;
+
+        const auto in = [&] {
+            if constexpr (has_native_in_edges) return meta::none {};
+            else {
+                auto index   = util::make_dense_vertex_index(graph, GRAPHLE_FWD(index_provider));
+                auto reverse = graphle::detail::reverse_adjacency<std::remove_reference_t<G>> { graph, index };
+
+                return std::pair { std::move(index), std::move(reverse) };
+            }
+        }();
+
+
+        while (!forward_frontier.empty() && !backward_frontier.empty()) {
+            next.clear();
+
+            if (forward_frontier.size() <= backward_frontier.size()) {
+                for (vertex_of<G> vertex : forward_frontier) {
+                    ++work;
+
+                    for (const auto& edge : util::out_edges(graph, vertex)) {
+                        ++work;
+                        if (reached_forward(edge.second)) continue;
+
+                        forward_parents.emplace(edge.second, edge);
+                        if (reached_backward(edge.second)) return make_path(edge.second);
+
+                        next.push_back(edge.second);
+                    }
+                }
+
+                forward_frontier.swap(next);
+            } else {
+                auto visit_edge = [&] (const edge_of<G>& edge) {
+                    ++work;
+                    if (reached_backward(edge.first)) return false;
+
+                    backward_parents.emplace(edge.first, edge);
+                    if (reached_forward(edge.first)) return true;
+
+                    next.push_back(edge.first);
+                    return false;
+                };
+
+
+                for (vertex_of<G> vertex : backward_frontier) {
+                    ++work;
+
+                    if constexpr (has_native_in_edges) {
+                        for (const auto& edge : util::in_edges(graph, vertex)) {
+                            if (visit_edge(edge)) return make_path(edge.first);
+                        }
+                    } else {
+                        const auto& [index, reverse] = in;
+                        const std::size_t i = index.index_of(vertex);
+
+                        for (std::size_t position = reverse.offsets[i]; position < reverse.offsets[i + 1]; ++position) {
+                            if (visit_edge(reverse.edges[position])) return make_path(reverse.edges[position].first);
+                        }
+                    }
+                }
+
+                backward_frontier.swap(next);
+            }
+
+            // Only cancel if there is work left, so a budget exhausted by the last layer still finishes the search.
+            if (!budget.consume(std::exchange(work, 0)) && !forward_frontier.empty() && !backward_frontier.empty()) {
+                return std::pair { util::run_status::CANCELLED, std::optional<path_type> {} };
+            }
+        }
+
+
+        return std::pair { util::run_status::FINISHED, std::optional<path_type> {} };
+    }
+
+
+    /**
+     * @ingroup Search
+     * Equivalent to the budget overload of @ref bidirectional_shortest_path, but without a budget.
+     *
+     * @param graph A graphle::graph to search.
+     * @param source The vertex the path starts at.
+     * @param target The vertex the path ends at.
+     * @param forward_parent_provider An optional storage-provider which can provide a unordered-map-like type from vertices to edges for the algorithm to use.
+     * @param backward_parent_provider An optional storage-provider which can provide a unordered-map-like type from vertices to edges for the algorithm to use.
+     *  Both maps are in use at the same time, so this must not return the same object as forward_parent_provider.
+     * @param index_provider An optional storage-provider which can provide a unordered-map-like type for the algorithm to use.
+     *  Only used if the in edges of the graph have to be gathered, and the graph has no vertex ids.
+     * @return The edges on a shortest path from the source to the target, in order, or std::nullopt if the target is not reachable from the source.
+     *  The path is empty if the source and the target are the same vertex.
+     *
+     * @graph_requires{
+     *  (
+     *      out_edges_graph<G> ||
+     *      (non_directed_graph<G> && in_edges_graph<G>)
+     *  ) && (
+     *      in_edges_graph<G> ||
+     *      non_directed_graph<G> ||
+     *      vertex_list_graph<G>
+     *  )
+     * }
+     */
+    template <
+        graph_ref G,
+        store::storage_provider_ref<store::storage_type::UNORDERED_MAP, vertex_of<G>, edge_of<G>, vertex_hash_of<G>, vertex_compare_of<G>> PFP
+            = store::default_provided_t<store::storage_type::UNORDERED_MAP, vertex_of<G>, edge_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>,
+        store::storage_provider_ref<store::storage_type::UNORDERED_MAP, vertex_of<G>, edge_of<G>, vertex_hash_of<G>, vertex_compare_of<G>> PBP
+            = store::default_provided_t<store::storage_type::UNORDERED_MAP, vertex_of<G>, edge_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>,
+        store::storage_provider_ref<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>> PM
+            = store::default_provided_t<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>
+    > requires (
+        (out_edges_graph<G> || (non_directed_graph<G> && in_edges_graph<G>)) &&
+        (in_edges_graph<G> || non_directed_graph<G> || vertex_list_graph<G>)
+    ) constexpr inline std::optional<std::vector<edge_of<G>>> bidirectional_shortest_path(
+        G&& graph,
+        vertex_of<G> source,
+        vertex_of<G> target,
+        PFP&& forward_parent_provider  = store::get_default_storage_provider<store::storage_type::UNORDERED_MAP, vertex_of<G>, edge_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>(),
+        PBP&& backward_parent_provider = store::get_default_storage_provider<store::storage_type::UNORDERED_MAP, vertex_of<G>, edge_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>(),
+        PM&&  index_provider           = store::get_default_storage_provider<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>()
+    ) {
+        return bidirectional_shortest_path(
+            graph,
+            source,
+            target,
+            util::unlimited_budget {},
+            GRAPHLE_FWD(forward_parent_provider),
+            GRAPHLE_FWD(backward_parent_provider),
+            GRAPHLE_FWD(index_provider)
+        ).second;
+    }
+}
\ No newline at end of file
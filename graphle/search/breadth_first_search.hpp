@@ -2,11 +2,15 @@
 
 #include <common.hpp>
 #include <graph/graph.hpp>
+#include <search/resumable_search.hpp>
 #include <search/search_impl.hpp>
 #include <storage/storage_provider.hpp>
 #include <storage/default_storage_provider.hpp>
+#include <utility/edge_utils.hpp>
 #include <utility/storage_utils.hpp>
 
+#include <vector>
+
 
 namespace graphle::search {
     /**
@@ -54,4 +58,352 @@ namespace graphle::search {
             GRAPHLE_FWD(set_provider)
         );
     }
+
+
+    /**
+     * @ingroup Search
+     * Equivalent to @ref breadth_first_search, but cancels the search once the given budget is exhausted, e.g. when its deadline has passed
+     * or a stop is requested through its stop token. See @ref util::work_budget.
+     *
+     * @param graph A graphle::graph to visit.
+     * @param root The root vertex to start the search from.
+     * @param visitor A visitor implementing the graphle::search_visitor interface.
+     * @param budget A @ref util::work_budget limiting the search. If an lvalue is passed, the work performed is consumed from it.
+     * @param deque_provider An optional storage-provider which can provide a deque-like type for the algorithm to use.
+     * @param set_provider An optional storage-provider which can provide a unordered-set-like type for the algorithm to use.
+     * @return FINISHED if the search finished normally, STOPPED if the visitor caused the algorithm to return early,
+     *  or CANCELLED if the budget was exhausted first.
+     *
+     * @graph_requires{
+     *  edge_list_graph<G> ||
+     *  out_edges_graph<G> ||
+     *  (non_directed_graph<G> && in_edges_graph<G>)
+     * }
+     */
+    template <
+        graph_ref G,
+        search_visitor_ref<G> V,
+        util::budget Budget,
+        store::storage_provider_ref<store::storage_type::DEQUE, vertex_of<G>> PQ
+            = store::default_provided_t<store::storage_type::DEQUE, vertex_of<G>>,
+        store::storage_provider_ref<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>> PS
+            = store::default_provided_t<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>
+    > requires (
+        edge_list_graph<G> ||
+        out_edges_graph<G> ||
+        (non_directed_graph<G> && in_edges_graph<G>)
+    ) constexpr inline util::run_status breadth_first_search(
+        G&& graph,
+        vertex_of<G> root,
+        V&& visitor,
+        Budget&& budget,
+        PQ&& deque_provider = store::get_default_storage_provider<store::storage_type::DEQUE, vertex_of<G>>(),
+        PS&& set_provider   = store::get_default_storage_provider<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>()
+    ) {
+        const auto status = resumable_breadth_first_search(graph, root, visitor, GRAPHLE_FWD(deque_provider), GRAPHLE_FWD(set_provider)).run(budget);
+        return status == util::run_status::SUSPENDED ? util::run_status::CANCELLED : status;
+    }
+
+
+    /**
+     * @ingroup Search
+     * Performs a breadth first search (BFS) from every vertex of the given graph that has not been visited yet, in the order of graph.get_vertices(),
+     * so that every vertex of the graph is visited exactly once. All search trees share a single pending vertex list and set of visited vertices,
+     * so no storage is allocated or cleared per tree, unlike calling @ref breadth_first_search for every root.
+     *
+     * begin_search and finish_search are invoked once for the entire traversal, and begin_tree and finish_tree are invoked for the root of every tree.
+     *
+     * The traversal is cancelled once the given budget is exhausted, e.g. when its deadline has passed or a stop is requested through its stop token.
+     * See @ref util::work_budget. Every vertex consumes one unit of work, plus one for every edge visited from it, like in @ref breadth_first_search.
+     *
+     * @param graph A graphle::graph to visit.
+     * @param visitor A visitor implementing the graphle::search_visitor interface.
+     * @param budget A @ref util::work_budget limiting the traversal. If an lvalue is passed, the work performed is consumed from it.
+     * @param deque_provider An optional storage-provider which can provide a deque-like type for the algorithm to use.
+     * @param set_provider An optional storage-provider which can provide a unordered-set-like type for the algorithm to use.
+     * @return FINISHED if the traversal finished normally, STOPPED if the visitor caused the algorithm to return early,
+     *  or CANCELLED if the budget was exhausted first.
+     *
+     * @graph_requires{
+     *  vertex_list_graph<G> &&
+     *  (
+     *      edge_list_graph<G> ||
+     *      out_edges_graph<G> ||
+     *      (non_directed_graph<G> && in_edges_graph<G>)
+     *  )
+     * }
+     */
+    template <
+        graph_ref G,
+        search_visitor_ref<G> V,
+        util::budget Budget,
+        store::storage_provider_ref<store::storage_type::DEQUE, vertex_of<G>> PQ
+            = store::default_provided_t<store::storage_type::DEQUE, vertex_of<G>>,
+        store::storage_provider_ref<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>> PS
+            = store::default_provided_t<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>
+    > requires (
+        vertex_list_graph<G> &&
+        (edge_list_graph<G> || out_edges_graph<G> || (non_directed_graph<G> && in_edges_graph<G>))
+    ) constexpr inline util::run_status breadth_first_search_forest(
+        G&& graph,
+        V&& visitor,
+        Budget&& budget,
+        PQ&& deque_provider = store::get_default_storage_provider<store::storage_type::DEQUE, vertex_of<G>>(),
+        PS&& set_provider   = store::get_default_storage_provider<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>()
+    ) {
+        return detail::search_forest<store::storage_type::DEQUE>(
+            graph,
+            visitor,
+            [] (auto& queue, auto elem) { queue.push_back(elem); },
+            [] (auto& queue) { return util::take_front(queue); },
+            budget,
+            GRAPHLE_FWD(deque_provider),
+            GRAPHLE_FWD(set_provider)
+        );
+    }
+
+
+    /**
+     * @ingroup Search
+     * Equivalent to the budget overload of @ref breadth_first_search_forest, but without a budget.
+     *
+     * @param graph A graphle::graph to visit.
+     * @param visitor A visitor implementing the graphle::search_visitor interface.
+     * @param deque_provider An optional storage-provider which can provide a deque-like type for the algorithm to use.
+     * @param set_provider An optional storage-provider which can provide a unordered-set-like type for the algorithm to use.
+     * @return True if the algorithm finished normally or false if the visitor caused the algorithm to return early.
+     *
+     * @graph_requires{
+     *  vertex_list_graph<G> &&
+     *  (
+     *      edge_list_graph<G> ||
+     *      out_edges_graph<G> ||
+     *      (non_directed_graph<G> && in_edges_graph<G>)
+     *  )
+     * }
+     */
+    template <
+        graph_ref G,
+        search_visitor_ref<G> V,
+        store::storage_provider_ref<store::storage_type::DEQUE, vertex_of<G>> PQ
+            = store::default_provided_t<store::storage_type::DEQUE, vertex_of<G>>,
+        store::storage_provider_ref<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>> PS
+            = store::default_provided_t<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>
+    > requires (
+        vertex_list_graph<G> &&
+        (edge_list_graph<G> || out_edges_graph<G> || (non_directed_graph<G> && in_edges_graph<G>))
+    ) constexpr inline bool breadth_first_search_forest(
+        G&& graph,
+        V&& visitor,
+        PQ&& deque_provider = store::get_default_storage_provider<store::storage_type::DEQUE, vertex_of<G>>(),
+        PS&& set_provider   = store::get_default_storage_provider<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>()
+    ) {
+        return breadth_first_search_forest(graph, visitor, util::unlimited_budget {}, GRAPHLE_FWD(deque_provider), GRAPHLE_FWD(set_provider)) == util::run_status::FINISHED;
+    }
+
+
+    /**
+     * @ingroup Search
+     * Performs a breadth first search on the given graph one layer at a time, passing the vertices of every layer and the edges through which
+     * the next layer is reached to the visitor in batches, so visitors doing simple bulk work (appending to arrays, counting, tagging vertices)
+     * can process them in a single loop rather than through a call for every vertex and edge.
+     *
+     * For every layer, the visitor is invoked as follows:
+     *  - begin_layer is invoked with the distance of the layer from the root.
+     *  - discover_vertex, discover_branch and discover_leaf are invoked for every vertex of the layer, if the visitor implements them.
+     *    Vertices for which they return STOP_TREE are removed from the layer.
+     *  - discover_vertices is invoked with the remaining vertices of the layer.
+     *  - The edges of the layer are visited like in @ref breadth_first_search, invoking discover_edge_to_new_vertex and discover_edge_to_known_vertex,
+     *    if the visitor implements them.
+     *  - discover_edges_to_new_vertices is invoked with the edges through which every vertex of the next layer was reached.
+     *  - finish_layer is invoked with the distance of the layer from the root.
+     *
+     * Vertices are visited in the same layers as with @ref breadth_first_search, and within every layer in the same order.
+     *
+     * The search is cancelled once the given budget is exhausted, e.g. when its deadline has passed or a stop is requested through its stop token.
+     * See @ref util::work_budget. Every vertex of a layer consumes one unit of work, plus one for every edge visited from it.
+     *
+     * @param graph A graphle::graph to visit.
+     * @param root The root vertex to start the search from.
+     * @param visitor A visitor implementing the graphle::search_visitor interface.
+     * @param budget A @ref util::work_budget limiting the search. If an lvalue is passed, the work performed is consumed from it.
+     *  The budget is only checked between layers, so the search may exceed it by the work of a single layer.
+     * @param set_provider An optional storage-provider which can provide a unordered-set-like type for the algorithm to use.
+     * @param layer_provider An optional storage-provider which can provide a vector-like type for the vertices of the current layer.
+     *  The type must be contiguous, since the layer is passed to the visitor as a span.
+     * @param edge_provider An optional storage-provider which can provide a vector-like type for the edges to the next layer.
+     *  The type must be contiguous, since the edges are passed to the visitor as a span.
+     * @return FINISHED if the search finished normally, STOPPED if the visitor caused the algorithm to return early,
+     *  or CANCELLED if the budget was exhausted first.
+     *
+     * @graph_requires{
+     *  edge_list_graph<G> ||
+     *  out_edges_graph<G> ||
+     *  (non_directed_graph<G> && in_edges_graph<G>)
+     * }
+     */
+    template <
+        graph_ref G,
+        search_visitor_ref<G> V,
+        util::budget Budget,
+        store::storage_provider_ref<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>> PS
+            = store::default_provided_t<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>,
+        store::storage_provider_ref<store::storage_type::VECTOR, vertex_of<G>> PV
+            = store::default_provided_t<store::storage_type::VECTOR, vertex_of<G>>,
+        store::storage_provider_ref<store::storage_type::VECTOR, edge_of<G>> PE
+            = store::default_provided_t<store::storage_type::VECTOR, edge_of<G>>
+    > requires (
+        edge_list_graph<G> ||
+        out_edges_graph<G> ||
+        (non_directed_graph<G> && in_edges_graph<G>)
+    ) constexpr inline util::run_status batched_breadth_first_search(
+        G&& graph,
+        vertex_of<G> root,
+        V&& visitor,
+        Budget&& budget,
+        PS&& set_provider   = store::get_default_storage_provider<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>(),
+        PV&& layer_provider = store::get_default_storage_provider<store::storage_type::VECTOR, vertex_of<G>>(),
+        PE&& edge_provider  = store::get_default_storage_provider<store::storage_type::VECTOR, edge_of<G>>()
+    ) {
+        using VR   = visitor_result;
+        using NVR  = nonlocal_visitor_result;
+        using Hook = visitor_hook;
+
+        constexpr bool visit_vertices   = visitor_implements<V>(Hook::DISCOVER_VERTEX);
+        constexpr bool visit_branches   = visitor_implements<V>(Hook::DISCOVER_BRANCH) && graph_is_directed<G>;
+        constexpr bool visit_leaves     = visitor_implements<V>(Hook::DISCOVER_LEAF)   && graph_is_directed<G>;
+
+
+        if (auto result = visitor.begin_search_base(graph); result == NVR::STOP_SEARCH) return util::run_status::STOPPED;
+
+
+        decltype(auto) seen = set_provider();
+        seen.emplace(root);
+
+        decltype(auto) layer = layer_provider();
+        layer.push_back(root);
+
+        decltype(auto) new_edges = edge_provider();
+
+
+        for (std::size_t depth = 0; !layer.empty(); ++depth) {
+            if (visitor.begin_layer_base(depth, graph) == NVR::STOP_SEARCH) return util::run_status::STOPPED;
+
+
+            // Remove vertices for which the per-vertex methods stop the tree from the layer.
+            if constexpr (visit_vertices || visit_branches || visit_leaves) {
+                std::size_t kept = 0;
+
+                for (vertex_of<G> vertex : layer) {
+                    VR result = VR::CONTINUE;
+
+                    if constexpr (visit_vertices) result = visitor.discover_vertex_base(vertex, graph);
+
+                    // Concepts 'branch' and 'leaf' don't make sense for a non-directed graph so ignore these visitor callbacks.
+                    if constexpr (visit_branches || visit_leaves) {
+                        if (result == VR::CONTINUE) {
+                            const bool is_branch = util::is_branch(graph, vertex);
+
+                            if constexpr (visit_branches) {
+                                if (is_branch) result = visitor.discover_branch_base(vertex, graph);
+                            }
+
+                            if constexpr (visit_leaves) {
+                                if (!is_branch) result = visitor.discover_leaf_base(vertex, graph);
+                            }
+                        }
+                    }
+
+                    if (result == VR::STOP_SEARCH) return util::run_status::STOPPED;
+                    if (result == VR::CONTINUE) layer[kept++] = vertex;
+                }
+
+                layer.resize(kept);
+            }
+
+            if (visitor.discover_vertices_base(layer, graph) == NVR::STOP_SEARCH) return util::run_status::STOPPED;
+
+
+            new_edges.clear();
+            std::size_t work = layer.size();
+
+            for (vertex_of<G> vertex : layer) {
+                const bool continued = detail::visit_out_edges(graph, visitor, seen, vertex, work, [&] (const edge_of<G>& edge) {
+                    new_edges.push_back(edge);
+                });
+
+                if (!continued) return util::run_status::STOPPED;
+            }
+
+
+            if (visitor.discover_edges_to_new_vertices_base(new_edges, graph) == NVR::STOP_SEARCH) return util::run_status::STOPPED;
+            if (visitor.finish_layer_base(depth, graph) == NVR::STOP_SEARCH) return util::run_status::STOPPED;
+
+
+            layer.clear();
+            for (const auto& edge : new_edges) layer.push_back(edge.second);
+
+            // The search is only cancelled if there is another layer left, so a budget exhausted by the last layer still finishes the search.
+            if (!budget.consume(work) && !layer.empty()) return util::run_status::CANCELLED;
+        }
+
+
+        if (auto result = visitor.finish_search_base(graph); result == NVR::STOP_SEARCH) return util::run_status::STOPPED;
+        return util::run_status::FINISHED;
+    }
+
+
+    /**
+     * @ingroup Search
+     * Equivalent to the budget overload of @ref batched_breadth_first_search, but without a budget.
+     *
+     * @param graph A graphle::graph to visit.
+     * @param root The root vertex to start the search from.
+     * @param visitor A visitor implementing the graphle::search_visitor interface.
+     * @param set_provider An optional storage-provider which can provide a unordered-set-like type for the algorithm to use.
+     * @param layer_provider An optional storage-provider which can provide a vector-like type for the vertices of the current layer.
+     *  The type must be contiguous, since the layer is passed to the visitor as a span.
+     * @param edge_provider An optional storage-provider which can provide a vector-like type for the edges to the next layer.
+     *  The type must be contiguous, since the edges are passed to the visitor as a span.
+     * @return True if the algorithm finished normally or false if the visitor caused the algorithm to return early.
+     *
+     * @graph_requires{
+     *  edge_list_graph<G> ||
+     *  out_edges_graph<G> ||
+     *  (non_directed_graph<G> && in_edges_graph<G>)
+     * }
+     */
+    template <
+        graph_ref G,
+        search_visitor_ref<G> V,
+        store::storage_provider_ref<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>> PS
+            = store::default_provided_t<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>,
+        store::storage_provider_ref<store::storage_type::VECTOR, vertex_of<G>> PV
+            = store::default_provided_t<store::storage_type::VECTOR, vertex_of<G>>,
+        store::storage_provider_ref<store::storage_type::VECTOR, edge_of<G>> PE
+            = store::default_provided_t<store::storage_type::VECTOR, edge_of<G>>
+    > requires (
+        edge_list_graph<G> ||
+        out_edges_graph<G> ||
+        (non_directed_graph<G> && in_edges_graph<G>)
+    ) constexpr inline bool batched_breadth_first_search(
+        G&& graph,
+        vertex_of<G> root,
+        V&& visitor,
+        PS&& set_provider   = store::get_default_storage_provider<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>(),
+        PV&& layer_provider = store::get_default_storage_provider<store::storage_type::VECTOR, vertex_of<G>>(),
+        PE&& edge_provider  = store::get_default_storage_provider<store::storage_type::VECTOR, edge_of<G>>()
+    ) {
+        const auto status = batched_breadth_first_search(
+            graph,
+            root,
+            visitor,
+            util::unlimited_budget {},
+            GRAPHLE_FWD(set_provider),
+            GRAPHLE_FWD(layer_provider),
+            GRAPHLE_FWD(edge_provider)
+        );
+
+        return status == util::run_status::FINISHED;
+    }
 }
\ No newline at end of file
@@ -0,0 +1,359 @@
+#pragma once
+
+#include <common.hpp>
+#include <graph/graph.hpp>
+#include <graph/vertex_property_map.hpp>
+#include <storage/storage_provider.hpp>
+#include <storage/default_storage_provider.hpp>
+#include <utility/edge_utils.hpp>
+#include <utility/vertex_index.hpp>
+#include <utility/work_budget.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+
+namespace graphle::search {
+    /**
+     * @ingroup Search
+     * The shortest path tree of a breadth first search, as computed by @ref breadth_first_tree.
+     * The distance from the root and the parent of every vertex are stored in flat arrays indexed by the dense vertex index of the graph
+     * (See @ref util::make_dense_vertex_index). The tree can be reused for later searches on the same graph, which then do not allocate.
+     *
+     * @tparam Index The type of the dense vertex index of the graph.
+     */
+    template <typename Index> struct bfs_tree {
+        using vertex_type = decltype(std::declval<const Index&>().vertex_at(0));
+
+        /** Value of a distance for vertices that have not been reached. */
+        constexpr static inline std::size_t unreached = std::numeric_limits<std::size_t>::max();
+        /** Value of a parent for vertices without a parent (the root and unreached vertices). */
+        constexpr static inline std::size_t no_parent = std::numeric_limits<std::size_t>::max();
+
+
+        /** The dense index of the vertices of the graph. */
+        Index index;
+        /** The distance from the root to every vertex, indexed by dense vertex index, or unreached. */
+        std::vector<std::size_t> distance;
+        /** The dense index of the previous vertex on the shortest path from the root to every vertex, indexed by dense vertex index, or no_parent. */
+        std::vector<std::size_t> parent;
+        /** Pending vertices of the search. */
+        std::vector<std::size_t> pending;
+
+
+        constexpr explicit bfs_tree(Index index) : index(std::move(index)) {}
+
+
+        /** Prepares the tree for a new search. */
+        constexpr void reset(void) {
+            distance.assign(index.size(), unreached);
+            parent.assign(index.size(), no_parent);
+            pending.clear();
+        }
+
+
+        /** Returns true if the given vertex was reached by the last search. */
+        [[nodiscard]] constexpr bool reached(vertex_type vertex) const {
+            return distance[index.index_of(vertex)] != unreached;
+        }
+
+        /** Returns the number of edges on the shortest path from the root to the given vertex, or unreached. */
+        [[nodiscard]] constexpr std::size_t distance_to(vertex_type vertex) const {
+            return distance[index.index_of(vertex)];
+        }
+
+        /** Returns the vertex before the given vertex on the shortest path from the root. The vertex must have been reached and must not be the root. */
+        [[nodiscard]] constexpr vertex_type parent_of(vertex_type vertex) const {
+            return index.vertex_at(parent[index.index_of(vertex)]);
+        }
+
+
+        /**
+         * Returns the vertices on the path from the root of the last search to the given vertex, including both.
+         * Returns an empty vector if the vertex was not reached.
+         */
+        [[nodiscard]] constexpr std::vector<vertex_type> path_to(vertex_type vertex) const {
+            std::vector<vertex_type> result;
+
+            const std::size_t target = index.index_of(vertex);
+            if (distance[target] == unreached) return result;
+
+            result.reserve(distance[target] + 1);
+            for (std::size_t current = target; current != no_parent; current = parent[current]) result.push_back(index.vertex_at(current));
+            std::ranges::reverse(result);
+
+            return result;
+        }
+    };
+
+
+    /**
+     * @ingroup Search
+     * Performs a breadth first search on the given graph from the given root, storing the distance to and the parent of every reached vertex
+     * in the given tree. The graph must not have gained vertices since the index of the tree was created.
+     * Reached vertices are tracked through their distance, so no set of visited vertices is needed, and no visitor methods are invoked.
+     *
+     * The search is cancelled once the given budget is exhausted, e.g. when its deadline has passed or a stop is requested through its stop token.
+     * See @ref util::work_budget. Every vertex consumes one unit of work, plus one for every edge visited from it.
+     *
+     * @param graph A graphle::graph to search.
+     * @param root The root vertex to start the search from.
+     * @param tree Storage for the search. Contains the results of the search after it finishes.
+     * @param budget A @ref util::work_budget limiting the search. If an lvalue is passed, the work performed is consumed from it.
+     * @return FINISHED if the search finished, or CANCELLED if the budget was exhausted first, in which case the tree only contains part of the result.
+     *
+     * @graph_requires{
+     *  out_edges_graph<G> ||
+     *  (non_directed_graph<G> && in_edges_graph<G>)
+     * }
+     */
+    template <graph_ref G, typename Index, util::budget Budget> requires (
+        out_edges_graph<G> ||
+        (non_directed_graph<G> && in_edges_graph<G>)
+    ) constexpr inline util::run_status breadth_first_tree(G&& graph, vertex_of<G> root, bfs_tree<Index>& tree, Budget&& budget) {
+        tree.reset();
+
+        const auto& index = tree.index;
+        auto& distance    = tree.distance;
+        auto& parent      = tree.parent;
+        auto& pending     = tree.pending;
+
+        const std::size_t root_index = index.index_of(root);
+        distance[root_index] = 0;
+        pending.push_back(root_index);
+
+
+        // pending is used as a queue without ever removing elements from the front, since every vertex is only added once.
+        for (std::size_t head = 0; head < pending.size(); ++head) {
+            const std::size_t current = pending[head];
+
+            auto visit = [&] (vertex_of<G> target) {
+                const std::size_t i = index.index_of(target);
+                if (distance[i] != bfs_tree<Index>::unreached) return;
+
+                distance[i] = distance[current] + 1;
+                parent[i]   = current;
+                pending.push_back(i);
+            };
+
+
+            std::size_t work = 1;
+            util::for_each_out_edge(graph, index.vertex_at(current), [&] (const edge_of<G>& edge) { visit(edge.second); ++work; });
+
+            // Only cancel if there are vertices left, so a budget exhausted by the last vertex still finishes the search.
+            if (!budget.consume(work) && head + 1 < pending.size()) return util::run_status::CANCELLED;
+        }
+
+        return util::run_status::FINISHED;
+    }
+
+
+    /**
+     * @ingroup Search
+     * Equivalent to the budget overload of @ref breadth_first_tree, but without a budget.
+     *
+     * @param graph A graphle::graph to search.
+     * @param root The root vertex to start the search from.
+     * @param tree Storage for the search. Contains the results of the search after it finishes.
+     *
+     * @graph_requires{
+     *  out_edges_graph<G> ||
+     *  (non_directed_graph<G> && in_edges_graph<G>)
+     * }
+     */
+    template <graph_ref G, typename Index> requires (
+        out_edges_graph<G> ||
+        (non_directed_graph<G> && in_edges_graph<G>)
+    ) constexpr inline void breadth_first_tree(G&& graph, vertex_of<G> root, bfs_tree<Index>& tree) {
+        breadth_first_tree(graph, root, tree, util::unlimited_budget {});
+    }
+
+
+    /**
+     * @ingroup Search
+     * Performs a breadth first search on the given graph from the given root, and returns the distance to and the parent of every reached vertex.
+     * See @ref breadth_first_tree.
+     *
+     * @param graph A graphle::graph to search.
+     * @param root The root vertex to start the search from.
+     * @param budget A @ref util::work_budget limiting the search. If an lvalue is passed, the work performed is consumed from it.
+     * @param map_provider An optional storage-provider which can provide a unordered-map-like type for the algorithm to use. Unused if the graph has vertex ids.
+     * @return A pair of FINISHED or CANCELLED, depending on whether the search finished before the budget was exhausted,
+     *  and a @ref bfs_tree containing the results of the search, which can be reused for later searches on the same graph.
+     *
+     * @graph_requires{
+     *  vertex_list_graph<G> &&
+     *  (
+     *      out_edges_graph<G> ||
+     *      (non_directed_graph<G> && in_edges_graph<G>)
+     *  )
+     * }
+     */
+    template <
+        graph_ref G,
+        util::budget Budget,
+        store::storage_provider_ref<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>> PM
+            = store::default_provided_t<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>
+    > requires (
+        vertex_list_graph<G> &&
+        (out_edges_graph<G> || (non_directed_graph<G> && in_edges_graph<G>))
+    ) constexpr inline auto breadth_first_tree(
+        G&& graph,
+        vertex_of<G> root,
+        Budget&& budget,
+        PM&& map_provider = store::get_default_storage_provider<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>()
+    ) {
+        bfs_tree tree { util::make_dense_vertex_index(graph, GRAPHLE_FWD(map_provider)) };
+        const auto status = breadth_first_tree(graph, root, tree, budget);
+
+        return std::pair { status, std::move(tree) };
+    }
+
+
+    /**
+     * @ingroup Search
+     * Equivalent to the budget overload of @ref breadth_first_tree returning a @ref bfs_tree, but without a budget.
+     *
+     * @param graph A graphle::graph to search.
+     * @param root The root vertex to start the search from.
+     * @param map_provider An optional storage-provider which can provide a unordered-map-like type for the algorithm to use. Unused if the graph has vertex ids.
+     * @return A @ref bfs_tree containing the results of the search, which can be reused for later searches on the same graph.
+     *
+     * @graph_requires{
+     *  vertex_list_graph<G> &&
+     *  (
+     *      out_edges_graph<G> ||
+     *      (non_directed_graph<G> && in_edges_graph<G>)
+     *  )
+     * }
+     */
+    template <
+        graph_ref G,
+        store::storage_provider_ref<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>> PM
+            = store::default_provided_t<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>
+    > requires (
+        vertex_list_graph<G> &&
+        (out_edges_graph<G> || (non_directed_graph<G> && in_edges_graph<G>))
+    ) constexpr inline auto breadth_first_tree(
+        G&& graph,
+        vertex_of<G> root,
+        PM&& map_provider = store::get_default_storage_provider<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>()
+    ) {
+        return breadth_first_tree(graph, root, util::unlimited_budget {}, GRAPHLE_FWD(map_provider)).second;
+    }
+
+
+    /**
+     * @ingroup Search
+     * Performs a breadth first search on the given graph from the given root, storing the distance to every reached vertex in the first property
+     * of the given @ref vertex_property_map, and its parent in the second property if the map has one. The map is reset before the search,
+     * so unreached vertices keep the default values of the map. The default distance must therefore not be a valid distance,
+     * e.g. std::numeric_limits<std::size_t>::max(). The parent of the root is left at its default value.
+     * ~~~
+     * auto tree = make_vertex_property_map(graph, std::numeric_limits<std::size_t>::max(), vertex_of<decltype(graph)> { nullptr });
+     * search::breadth_first_tree(graph, root, tree);
+     * ~~~
+     *
+     * @param graph A graphle::graph to search.
+     * @param root The root vertex to start the search from.
+     * @param tree A vertex property map with a std::size_t distance property and optionally a vertex parent property.
+     *  Contains the results of the search after it finishes. Its distance column can be passed to algorithms expecting a @ref vertex_value_getter.
+     * @param budget A @ref util::work_budget limiting the search. If an lvalue is passed, the work performed is consumed from it.
+     *  Every vertex consumes one unit of work, plus one for every edge visited from it.
+     * @param queue_provider An optional storage-provider which can provide a vector-like type for the algorithm to use.
+     * @return FINISHED if the search finished, or CANCELLED if the budget was exhausted first, in which case the map only contains part of the result.
+     *
+     * @graph_requires{
+     *  out_edges_graph<G> ||
+     *  (non_directed_graph<G> && in_edges_graph<G>)
+     * }
+     */
+    template <
+        graph_ref G,
+        graph_ref M,
+        typename... Ts,
+        util::budget Budget,
+        store::storage_provider_ref<store::storage_type::VECTOR, vertex_of<G>> PV
+            = store::default_provided_t<store::storage_type::VECTOR, vertex_of<G>>
+    > requires (
+        (out_edges_graph<G> || (non_directed_graph<G> && in_edges_graph<G>)) &&
+        std::is_same_v<vertex_of<M>, vertex_of<G>> &&
+        (sizeof...(Ts) == 0 || (sizeof...(Ts) == 1 && (std::is_same_v<Ts, vertex_of<G>> && ...)))
+    ) constexpr inline util::run_status breadth_first_tree(
+        G&& graph,
+        vertex_of<G> root,
+        vertex_property_map<M, std::size_t, Ts...>& tree,
+        Budget&& budget,
+        PV&& queue_provider = store::get_default_storage_provider<store::storage_type::VECTOR, vertex_of<G>>()
+    ) {
+        tree.reset();
+
+        const std::size_t unreached = tree.default_value();
+        tree.set(root, 0);
+
+        decltype(auto) pending = queue_provider();
+        pending.push_back(root);
+
+
+        // pending is used as a queue without ever removing elements from the front, since every vertex is only added once.
+        for (std::size_t head = 0; head < rng::size(pending); ++head) {
+            const vertex_of<G> current = pending[head];
+            const std::size_t depth    = tree.value(current) + 1;
+            std::size_t work           = 1;
+
+            util::for_each_out_edge(graph, current, [&] (const edge_of<G>& edge) {
+                ++work;
+
+                auto& distance = tree.get(edge.second);
+                if (distance != unreached) return;
+
+                distance = depth;
+                if constexpr (sizeof...(Ts) == 1) tree.template set<1>(edge.second, current);
+
+                pending.push_back(edge.second);
+            });
+
+            // Only cancel if there are vertices left, so a budget exhausted by the last vertex still finishes the search.
+            if (!budget.consume(work) && head + 1 < rng::size(pending)) return util::run_status::CANCELLED;
+        }
+
+        return util::run_status::FINISHED;
+    }
+
+
+    /**
+     * @ingroup Search
+     * Equivalent to the budget overload of @ref breadth_first_tree storing its result in a @ref vertex_property_map, but without a budget.
+     *
+     * @param graph A graphle::graph to search.
+     * @param root The root vertex to start the search from.
+     * @param tree A vertex property map with a std::size_t distance property and optionally a vertex parent property.
+     *  Contains the results of the search after it finishes.
+     * @param queue_provider An optional storage-provider which can provide a vector-like type for the algorithm to use.
+     *
+     * @graph_requires{
+     *  out_edges_graph<G> ||
+     *  (non_directed_graph<G> && in_edges_graph<G>)
+     * }
+     */
+    template <
+        graph_ref G,
+        graph_ref M,
+        typename... Ts,
+        store::storage_provider_ref<store::storage_type::VECTOR, vertex_of<G>> PV
+            = store::default_provided_t<store::storage_type::VECTOR, vertex_of<G>>
+    > requires (
+        (out_edges_graph<G> || (non_directed_graph<G> && in_edges_graph<G>)) &&
+        std::is_same_v<vertex_of<M>, vertex_of<G>> &&
+        (sizeof...(Ts) == 0 || (sizeof...(Ts) == 1 && (std::is_same_v<Ts, vertex_of<G>> && ...)))
+    ) constexpr inline void breadth_first_tree(
+        G&& graph,
+        vertex_of<G> root,
+        vertex_property_map<M, std::size_t, Ts...>& tree,
+        PV&& queue_provider = store::get_default_storage_provider<store::storage_type::VECTOR, vertex_of<G>>()
+    ) {
+        breadth_first_tree(graph, root, tree, util::unlimited_budget {}, GRAPHLE_FWD(queue_provider));
+    }
+}
@@ -0,0 +1,498 @@
+#pragma once
+
+#include <common.hpp>
+#include <graph/graph.hpp>
+#include <search/dfs_frame.hpp>
+#include <search/visitor.hpp>
+#include <storage/storage_provider.hpp>
+#include <storage/default_storage_provider.hpp>
+#include <utility/edge_utils.hpp>
+#include <utility/vertex_index.hpp>
+#include <utility/work_budget.hpp>
+
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+
+namespace graphle::search {
+    /**
+     * @ingroup Search
+     * The state of a depth first search with edge classification, as used by @ref classified_depth_first_search.
+     * The discovery time, finishing time and parent of every vertex are stored together in a single flat array indexed by the dense vertex index of the graph
+     * (See @ref util::make_dense_vertex_index), so classifying an edge touches a single entry of its target. Discovery and finishing share a single clock,
+     * so the times of every vertex are unique, and the color of a vertex follows from its times: undiscovered (white),
+     * discovered but not finished (gray, on the current path) or finished (black).
+     * The tree can be reused for later searches on the same graph, which then do not allocate.
+     *
+     * @tparam Index The type of the dense vertex index of the graph.
+     * @tparam Time The unsigned type used to store times and parents. The clock advances twice for every vertex, and the maximum value is reserved,
+     *  so the default 32-bit type supports graphs of fewer than 2^31 vertices. Larger graphs require a 64-bit type.
+     */
+    template <typename Index, std::unsigned_integral Time = std::uint32_t> struct dfs_tree {
+        using vertex_type = decltype(std::declval<const Index&>().vertex_at(0));
+        using time_type   = Time;
+
+        /** Value of a time for vertices that have not been discovered or finished. */
+        constexpr static inline Time unreached = std::numeric_limits<Time>::max();
+        /** Value of a parent for vertices without a parent (roots and undiscovered vertices). */
+        constexpr static inline Time no_parent = std::numeric_limits<Time>::max();
+
+
+        /** The state of a single vertex. */
+        struct entry {
+            /** The time at which the vertex was discovered, or unreached. */
+            Time discover_time = unreached;
+            /** The time at which the vertex was finished, or unreached. */
+            Time finish_time = unreached;
+            /** The dense index of the vertex through which the vertex was discovered, or no_parent. */
+            Time parent = no_parent;
+        };
+
+
+        /** The dense index of the vertices of the graph. */
+        Index index;
+        /** The state of every vertex, indexed by dense vertex index. */
+        std::vector<entry> entries;
+        /** The next time of the search clock. */
+        Time time = 0;
+
+
+        constexpr explicit dfs_tree(Index index) : index(std::move(index)) {}
+
+
+        /** Prepares the tree for a new search. */
+        constexpr void reset(void) {
+            entries.assign(index.size(), entry {});
+            time = 0;
+        }
+
+
+        /** Returns true if the given vertex was discovered by the last search. */
+        [[nodiscard]] constexpr bool discovered(vertex_type vertex) const {
+            return entries[index.index_of(vertex)].discover_time != unreached;
+        }
+
+        /** Returns true if the given vertex was finished by the last search. Discovered vertices are only unfinished if the search was stopped early. */
+        [[nodiscard]] constexpr bool finished(vertex_type vertex) const {
+            return entries[index.index_of(vertex)].finish_time != unreached;
+        }
+
+        /** Returns the discovery time of the given vertex, or unreached. */
+        [[nodiscard]] constexpr Time discover_time_of(vertex_type vertex) const {
+            return entries[index.index_of(vertex)].discover_time;
+        }
+
+        /** Returns the finishing time of the given vertex, or unreached. */
+        [[nodiscard]] constexpr Time finish_time_of(vertex_type vertex) const {
+            return entries[index.index_of(vertex)].finish_time;
+        }
+
+        /** Returns true if the given vertex has a parent, I.e. it was discovered and is not the root of a search tree. */
+        [[nodiscard]] constexpr bool has_parent(vertex_type vertex) const {
+            return entries[index.index_of(vertex)].parent != no_parent;
+        }
+
+        /** Returns the vertex through which the given vertex was discovered. The vertex must have a parent. */
+        [[nodiscard]] constexpr vertex_type parent_of(vertex_type vertex) const {
+            return index.vertex_at(entries[index.index_of(vertex)].parent);
+        }
+
+
+        /** Returns true if the first vertex is a descendant of the second one in the search forest, or the same vertex. Both vertices must be finished. */
+        [[nodiscard]] constexpr bool is_descendant_of(vertex_type descendant, vertex_type ancestor) const {
+            const entry& d = entries[index.index_of(descendant)];
+            const entry& a = entries[index.index_of(ancestor)];
+
+            return a.discover_time <= d.discover_time && d.finish_time <= a.finish_time;
+        }
+    };
+
+
+    /**
+     * @ingroup Search
+     * Returns an empty @ref dfs_tree for the given graph, to be used with @ref classified_depth_first_search.
+     *
+     * @tparam Time The type used to store times and parents. See @ref dfs_tree.
+     * @param graph A graphle::graph to search.
+     * @param map_provider An optional storage-provider which can provide a unordered-map-like type for the algorithm to use. Unused if the graph has vertex ids.
+     *
+     * @graph_requires{ vertex_list_graph<G> }
+     */
+    template <
+        std::unsigned_integral Time = std::uint32_t,
+        graph_ref G,
+        store::storage_provider_ref<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>> PM
+            = store::default_provided_t<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>
+    > requires vertex_list_graph<G> constexpr inline auto make_dfs_tree(
+        G&& graph,
+        PM&& map_provider = store::get_default_storage_provider<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>()
+    ) {
+        auto index = util::make_dense_vertex_index(graph, GRAPHLE_FWD(map_provider));
+        return dfs_tree<decltype(index), Time> { std::move(index) };
+    }
+}
+
+
+namespace graphle::detail {
+    /**
+     * Performs a single tree of a classified depth first search from the given undiscovered root,
+     * as part of @ref search::classified_depth_first_search or @ref search::classified_depth_first_search_forest.
+     * Every visited edge consumes one unit of work from the given budget. Returns STOPPED if the visitor stopped the search,
+     * or CANCELLED if the budget is exhausted while there are edges left to visit.
+     *
+     * @param frames Vector-like storage for the path from the root to the current vertex. Must be empty.
+     */
+    template <graph_ref G, typename V, typename Index, typename Time, util::budget Budget, typename Frames>
+    constexpr inline util::run_status classified_dfs_tree(G& graph, vertex_of<G> root, V& visitor, search::dfs_tree<Index, Time>& tree, Budget&& budget, Frames& frames) {
+        using VR   = search::visitor_result;
+        using NVR  = search::nonlocal_visitor_result;
+        using Hook = search::visitor_hook;
+        using RS   = util::run_status;
+        using Tree = search::dfs_tree<Index, Time>;
+
+        constexpr bool visit_vertices      = search::visitor_implements<V>(Hook::DISCOVER_VERTEX);
+        constexpr bool visit_new_edges     = search::visitor_implements<V>(Hook::DISCOVER_EDGE_TO_NEW_VERTEX);
+        constexpr bool visit_seen_edges    = search::visitor_implements<V>(Hook::DISCOVER_EDGE_TO_KNOWN_VERTEX);
+        constexpr bool visit_back_edges    = search::visitor_implements<V>(Hook::DISCOVER_BACK_EDGE);
+        constexpr bool visit_forward_edges = search::visitor_implements<V>(Hook::DISCOVER_FORWARD_EDGE);
+        constexpr bool visit_cross_edges   = search::visitor_implements<V>(Hook::DISCOVER_CROSS_EDGE);
+        constexpr bool visit_finished      = search::visitor_implements<V>(Hook::FINISH_VERTEX);
+
+        const auto& index = tree.index;
+        auto& entries     = tree.entries;
+        bool exhausted    = false;
+
+
+        // Marks the given vertex as finished. Returns false if the search should stop.
+        auto finish_vertex = [&] (vertex_of<G> vertex, std::size_t i) {
+            entries[i].finish_time = tree.time++;
+
+            if constexpr (visit_finished) {
+                if (visitor.finish_vertex_base(vertex, graph) == NVR::STOP_SEARCH) return false;
+            }
+
+            return true;
+        };
+
+
+        // Discovers the given vertex and pushes it onto the path if it should be expanded. Returns false if the search should stop.
+        auto discover_vertex = [&] (vertex_of<G> vertex, std::size_t i) {
+            entries[i].discover_time = tree.time++;
+
+            if constexpr (visit_vertices) {
+                switch (visitor.discover_vertex_base(vertex, graph)) {
+                    case VR::STOP_SEARCH: return false;
+                    case VR::STOP_TREE:   return finish_vertex(vertex, i);
+                    case VR::CONTINUE:    break;
+                }
+            }
+
+            frames.emplace_back(graph, vertex);
+            return true;
+        };
+
+
+        // Invokes the given classification method after discover_edge_to_known_vertex. Returns false if the search should stop.
+        auto classify = [&] (const edge_of<G>& edge, auto method) {
+            if constexpr (visit_seen_edges) {
+                if (visitor.discover_edge_to_known_vertex_base(edge, graph) == VR::STOP_SEARCH) return false;
+            }
+
+            return method() != VR::STOP_SEARCH;
+        };
+
+
+        if (visitor.begin_tree_base(root, graph) == NVR::STOP_SEARCH) return RS::STOPPED;
+        if (!discover_vertex(root, index.index_of(root))) return RS::STOPPED;
+
+
+        while (!rng::empty(frames)) {
+            auto& frame = frames.back();
+
+            if (frame.edge_iterator == rng::end(frame.edges)) {
+                const vertex_of<G> vertex = frame.vertex;
+                frames.pop_back();
+
+                if (!finish_vertex(vertex, index.index_of(vertex))) return RS::STOPPED;
+                continue;
+            }
+
+
+            // Only cancel the search if there is an edge left to visit, so a budget exhausted by the last edge still finishes the tree.
+            if (exhausted) return RS::CANCELLED;
+            exhausted = !budget.consume(1);
+
+            const edge_of<G> edge = *frame.edge_iterator;
+            frame.next_edge();
+
+            const std::size_t source = index.index_of(frame.vertex);
+            const std::size_t target = index.index_of(edge.second);
+            const auto target_entry  = entries[target];
+
+            if (target_entry.discover_time == Tree::unreached) {
+                if constexpr (visit_new_edges) {
+                    const auto result = visitor.discover_edge_to_new_vertex_base(edge, graph);
+
+                    if (result == VR::STOP_SEARCH) return RS::STOPPED;
+                    if (result == VR::STOP_TREE) continue;
+                }
+
+                entries[target].parent = Time(source);
+
+                // Note: frame is invalidated if the target is pushed onto the path.
+                if (!discover_vertex(edge.second, target)) return RS::STOPPED;
+            }
+
+            else if (target_entry.finish_time == Tree::unreached) {
+                const bool proceed = classify(edge, [&] {
+                    if constexpr (visit_back_edges) return visitor.discover_back_edge_base(edge, graph);
+                    else return VR::CONTINUE;
+                });
+
+                if (!proceed) return RS::STOPPED;
+            }
+
+            else if (entries[source].discover_time < target_entry.discover_time) {
+                const bool proceed = classify(edge, [&] {
+                    if constexpr (visit_forward_edges) return visitor.discover_forward_edge_base(edge, graph);
+                    else return VR::CONTINUE;
+                });
+
+                if (!proceed) return RS::STOPPED;
+            }
+
+            else {
+                const bool proceed = classify(edge, [&] {
+                    if constexpr (visit_cross_edges) return visitor.discover_cross_edge_base(edge, graph);
+                    else return VR::CONTINUE;
+                });
+
+                if (!proceed) return RS::STOPPED;
+            }
+        }
+
+
+        return visitor.finish_tree_base(root, graph) == NVR::STOP_SEARCH ? RS::STOPPED : RS::FINISHED;
+    }
+}
+
+
+namespace graphle::search {
+    /**
+     * @ingroup Search
+     * Performs a depth first search on the given graph from the given root, which invokes the visitor both when a vertex is discovered (pre-order)
+     * and when it is finished (post-order), and classifies every edge it visits, storing the discovery time, finishing time and parent of every vertex
+     * in the given tree. Unlike @ref depth_first_search, vertices are discovered when the search first reaches them through an edge,
+     * so the discovery order is the same as that of a recursive depth first search, and a single traversal provides everything
+     * needed for e.g. topological sorting (reverse finishing order), cycle detection (back edges) or dominator computations (parents and times).
+     * The graph must not have gained vertices since the index of the tree was created. Visited vertices are tracked through the times in the tree,
+     * so no set of visited vertices is needed.
+     *
+     * The visitor is invoked as follows:
+     *  - begin_search and finish_search are invoked once. begin_tree and finish_tree are invoked once for the root.
+     *  - discover_vertex is invoked when a vertex is first reached. If it returns STOP_TREE, the out edges of the vertex are not visited and it is finished immediately.
+     *  - discover_edge_to_new_vertex is invoked for edges to undiscovered vertices (tree edges). If it returns STOP_TREE, the edge is not followed.
+     *  - discover_edge_to_known_vertex is invoked for all other edges, followed by one of discover_back_edge (the target is on the current path),
+     *    discover_forward_edge (the target is a finished descendant of the source) or discover_cross_edge (any other finished target).
+     *  - finish_vertex is invoked after all out edges of a vertex have been visited, and all vertices discovered through them have been finished.
+     *  - discover_branch, discover_leaf and the batched callbacks are not invoked.
+     *
+     * For non-directed graphs every edge is visited from both of its vertices, so the tree edge to the parent of a vertex is visited again as a back edge,
+     * and every back edge is visited again as a forward edge.
+     *
+     * The search is cancelled once the given budget is exhausted, e.g. when its deadline has passed or a stop is requested through its stop token.
+     * See @ref util::work_budget. Every visited edge consumes one unit of work.
+     *
+     * @param graph A graphle::graph to visit.
+     * @param root The root vertex to start the search from.
+     * @param visitor A visitor implementing the graphle::search_visitor interface.
+     * @param tree Storage for the search, e.g. as returned by @ref make_dfs_tree. Contains the times and parents of the search after it finishes.
+     * @param budget A @ref util::work_budget limiting the search. If an lvalue is passed, the work performed is consumed from it.
+     *  If the search is cancelled, the vertices on the path at that point are discovered but not finished.
+     * @param stack_provider An optional storage-provider which can provide a vector-like type for the algorithm to use.
+     * @return FINISHED if the search finished normally, STOPPED if the visitor caused the algorithm to return early,
+     *  or CANCELLED if the budget was exhausted first.
+     *
+     * @graph_requires{
+     *  out_edges_graph<G> ||
+     *  (non_directed_graph<G> && in_edges_graph<G>)
+     * }
+     */
+    template <
+        graph_ref G,
+        search_visitor_ref<G> V,
+        typename Index,
+        typename Time,
+        util::budget Budget,
+        store::storage_provider_ref<store::storage_type::VECTOR, detail::dfs_frame<G>> PV
+            = store::default_provided_t<store::storage_type::VECTOR, detail::dfs_frame<G>>
+    > requires (
+        out_edges_graph<G> ||
+        (non_directed_graph<G> && in_edges_graph<G>)
+    ) constexpr inline util::run_status classified_depth_first_search(
+        G&& graph,
+        vertex_of<G> root,
+        V&& visitor,
+        dfs_tree<Index, Time>& tree,
+        Budget&& budget,
+        PV&& stack_provider = store::get_default_storage_provider<store::storage_type::VECTOR, detail::dfs_frame<G>>()
+    ) {
+        using NVR = nonlocal_visitor_result;
+
+        tree.reset();
+        if (visitor.begin_search_base(graph) == NVR::STOP_SEARCH) return util::run_status::STOPPED;
+
+
+        decltype(auto) frames = stack_provider();
+        if (const auto status = detail::classified_dfs_tree(graph, root, visitor, tree, budget, frames); status != util::run_status::FINISHED) return status;
+
+
+        if (visitor.finish_search_base(graph) == NVR::STOP_SEARCH) return util::run_status::STOPPED;
+        return util::run_status::FINISHED;
+    }
+
+
+    /**
+     * @ingroup Search
+     * Equivalent to the budget overload of @ref classified_depth_first_search, but without a budget.
+     *
+     * @param graph A graphle::graph to visit.
+     * @param root The root vertex to start the search from.
+     * @param visitor A visitor implementing the graphle::search_visitor interface.
+     * @param tree Storage for the search, e.g. as returned by @ref make_dfs_tree. Contains the times and parents of the search after it finishes.
+     * @param stack_provider An optional storage-provider which can provide a vector-like type for the algorithm to use.
+     * @return True if the algorithm finished normally or false if the visitor caused the algorithm to return early.
+     *
+     * @graph_requires{
+     *  out_edges_graph<G> ||
+     *  (non_directed_graph<G> && in_edges_graph<G>)
+     * }
+     */
+    template <
+        graph_ref G,
+        search_visitor_ref<G> V,
+        typename Index,
+        typename Time,
+        store::storage_provider_ref<store::storage_type::VECTOR, detail::dfs_frame<G>> PV
+            = store::default_provided_t<store::storage_type::VECTOR, detail::dfs_frame<G>>
+    > requires (
+        out_edges_graph<G> ||
+        (non_directed_graph<G> && in_edges_graph<G>)
+    ) constexpr inline bool classified_depth_first_search(
+        G&& graph,
+        vertex_of<G> root,
+        V&& visitor,
+        dfs_tree<Index, Time>& tree,
+        PV&& stack_provider = store::get_default_storage_provider<store::storage_type::VECTOR, detail::dfs_frame<G>>()
+    ) {
+        return classified_depth_first_search(graph, root, visitor, tree, util::unlimited_budget {}, GRAPHLE_FWD(stack_provider)) == util::run_status::FINISHED;
+    }
+
+
+    /**
+     * @ingroup Search
+     * Performs a classified depth first search (See @ref classified_depth_first_search) from every vertex of the graph that was not discovered
+     * by an earlier search tree, in the order of the vertex list of the graph, so every vertex is discovered and finished exactly once.
+     * The clock of the tree continues across search trees, so edges into earlier search trees are classified as cross edges.
+     *
+     * begin_search and finish_search are invoked once for the entire traversal, and begin_tree and finish_tree are invoked for the root of every tree.
+     *
+     * The traversal is cancelled once the given budget is exhausted, e.g. when its deadline has passed or a stop is requested through its stop token.
+     * See @ref util::work_budget. Every visited edge consumes one unit of work.
+     *
+     * @param graph A graphle::graph to visit.
+     * @param visitor A visitor implementing the graphle::search_visitor interface.
+     * @param tree Storage for the search, e.g. as returned by @ref make_dfs_tree. Contains the times and parents of the search after it finishes.
+     * @param budget A @ref util::work_budget limiting the traversal. If an lvalue is passed, the work performed is consumed from it.
+     * @param stack_provider An optional storage-provider which can provide a vector-like type for the algorithm to use.
+     * @return FINISHED if the traversal finished normally, STOPPED if the visitor caused the algorithm to return early,
+     *  or CANCELLED if the budget was exhausted first.
+     *
+     * @graph_requires{
+     *  vertex_list_graph<G> &&
+     *  (
+     *      out_edges_graph<G> ||
+     *      (non_directed_graph<G> && in_edges_graph<G>)
+     *  )
+     * }
+     */
+    template <
+        graph_ref G,
+        search_visitor_ref<G> V,
+        typename Index,
+        typename Time,
+        util::budget Budget,
+        store::storage_provider_ref<store::storage_type::VECTOR, detail::dfs_frame<G>> PV
+            = store::default_provided_t<store::storage_type::VECTOR, detail::dfs_frame<G>>
+    > requires (
+        vertex_list_graph<G> &&
+        (out_edges_graph<G> || (non_directed_graph<G> && in_edges_graph<G>))
+    ) constexpr inline util::run_status classified_depth_first_search_forest(
+        G&& graph,
+        V&& visitor,
+        dfs_tree<Index, Time>& tree,
+        Budget&& budget,
+        PV&& stack_provider = store::get_default_storage_provider<store::storage_type::VECTOR, detail::dfs_frame<G>>()
+    ) {
+        using NVR = nonlocal_visitor_result;
+
+        tree.reset();
+        if (visitor.begin_search_base(graph) == NVR::STOP_SEARCH) return util::run_status::STOPPED;
+
+
+        decltype(auto) frames = stack_provider();
+
+        for (auto root : graph.get_vertices()) {
+            if (tree.discovered(root)) continue;
+
+            // The previous tree may have exhausted the budget on its last edge, in which case the next tree should not be started.
+            if (!budget.consume(0)) return util::run_status::CANCELLED;
+
+            if (const auto status = detail::classified_dfs_tree(graph, root, visitor, tree, budget, frames); status != util::run_status::FINISHED) return status;
+        }
+
+
+        if (visitor.finish_search_base(graph) == NVR::STOP_SEARCH) return util::run_status::STOPPED;
+        return util::run_status::FINISHED;
+    }
+
+
+    /**
+     * @ingroup Search
+     * Equivalent to the budget overload of @ref classified_depth_first_search_forest, but without a budget.
+     *
+     * @param graph A graphle::graph to visit.
+     * @param visitor A visitor implementing the graphle::search_visitor interface.
+     * @param tree Storage for the search, e.g. as returned by @ref make_dfs_tree. Contains the times and parents of the search after it finishes.
+     * @param stack_provider An optional storage-provider which can provide a vector-like type for the algorithm to use.
+     * @return True if the algorithm finished normally or false if the visitor caused the algorithm to return early.
+     *
+     * @graph_requires{
+     *  vertex_list_graph<G> &&
+     *  (
+     *      out_edges_graph<G> ||
+     *      (non_directed_graph<G> && in_edges_graph<G>)
+     *  )
+     * }
+     */
+    template <
+        graph_ref G,
+        search_visitor_ref<G> V,
+        typename Index,
+        typename Time,
+        store::storage_provider_ref<store::storage_type::VECTOR, detail::dfs_frame<G>> PV
+            = store::default_provided_t<store::storage_type::VECTOR, detail::dfs_frame<G>>
+    > requires (
+        vertex_list_graph<G> &&
+        (out_edges_graph<G> || (non_directed_graph<G> && in_edges_graph<G>))
+    ) constexpr inline bool classified_depth_first_search_forest(
+        G&& graph,
+        V&& visitor,
+        dfs_tree<Index, Time>& tree,
+        PV&& stack_provider = store::get_default_storage_provider<store::storage_type::VECTOR, detail::dfs_frame<G>>()
+    ) {
+        return classified_depth_first_search_forest(graph, visitor, tree, util::unlimited_budget {}, GRAPHLE_FWD(stack_provider)) == util::run_status::FINISHED;
+    }
+}
@@ -2,6 +2,7 @@
 
 #include <common.hpp>
 #include <graph/graph.hpp>
+#include <search/resumable_search.hpp>
 #include <search/search_impl.hpp>
 #include <storage/storage_provider.hpp>
 #include <storage/default_storage_provider.hpp>
@@ -54,4 +55,146 @@ namespace graphle::search {
             GRAPHLE_FWD(set_provider)
         );
     }
+
+
+    /**
+     * @ingroup Search
+     * Equivalent to @ref depth_first_search, but cancels the search once the given budget is exhausted, e.g. when its deadline has passed
+     * or a stop is requested through its stop token. See @ref util::work_budget.
+     *
+     * @param graph A graphle::graph to visit.
+     * @param root The root vertex to start the search from.
+     * @param visitor A visitor implementing the graphle::search_visitor interface.
+     * @param budget A @ref util::work_budget limiting the search. If an lvalue is passed, the work performed is consumed from it.
+     * @param stack_provider An optional storage-provider which can provide a vector-like type for the algorithm to use.
+     * @param set_provider An optional storage-provider which can provide a unordered-set-like type for the algorithm to use.
+     * @return FINISHED if the search finished normally, STOPPED if the visitor caused the algorithm to return early,
+     *  or CANCELLED if the budget was exhausted first.
+     *
+     * @graph_requires{
+     *  edge_list_graph<G> ||
+     *  out_edges_graph<G> ||
+     *  (non_directed_graph<G> && in_edges_graph<G>)
+     * }
+     */
+    template <
+        graph_ref G,
+        search_visitor_ref<G> V,
+        util::budget Budget,
+        store::storage_provider_ref<store::storage_type::VECTOR, vertex_of<G>> PV
+            = store::default_provided_t<store::storage_type::VECTOR, vertex_of<G>>,
+        store::storage_provider_ref<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>> PS
+            = store::default_provided_t<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>
+    > requires (
+        edge_list_graph<G> ||
+        out_edges_graph<G> ||
+        (non_directed_graph<G> && in_edges_graph<G>)
+    ) constexpr inline util::run_status depth_first_search(
+        G&& graph,
+        vertex_of<G> root,
+        V&& visitor,
+        Budget&& budget,
+        PV&& stack_provider = store::get_default_storage_provider<store::storage_type::VECTOR, vertex_of<G>>(),
+        PS&& set_provider   = store::get_default_storage_provider<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>()
+    ) {
+        const auto status = resumable_depth_first_search(graph, root, visitor, GRAPHLE_FWD(stack_provider), GRAPHLE_FWD(set_provider)).run(budget);
+        return status == util::run_status::SUSPENDED ? util::run_status::CANCELLED : status;
+    }
+
+
+    /**
+     * @ingroup Search
+     * Performs a depth first search (DFS) from every vertex of the given graph that has not been visited yet, in the order of graph.get_vertices(),
+     * so that every vertex of the graph is visited exactly once. All search trees share a single pending vertex list and set of visited vertices,
+     * so no storage is allocated or cleared per tree, unlike calling @ref depth_first_search for every root.
+     *
+     * begin_search and finish_search are invoked once for the entire traversal, and begin_tree and finish_tree are invoked for the root of every tree.
+     *
+     * The traversal is cancelled once the given budget is exhausted, e.g. when its deadline has passed or a stop is requested through its stop token.
+     * See @ref util::work_budget. Every vertex consumes one unit of work, plus one for every edge visited from it, like in @ref depth_first_search.
+     *
+     * @param graph A graphle::graph to visit.
+     * @param visitor A visitor implementing the graphle::search_visitor interface.
+     * @param budget A @ref util::work_budget limiting the traversal. If an lvalue is passed, the work performed is consumed from it.
+     * @param stack_provider An optional storage-provider which can provide a vector-like type for the algorithm to use.
+     * @param set_provider An optional storage-provider which can provide a unordered-set-like type for the algorithm to use.
+     * @return FINISHED if the traversal finished normally, STOPPED if the visitor caused the algorithm to return early,
+     *  or CANCELLED if the budget was exhausted first.
+     *
+     * @graph_requires{
+     *  vertex_list_graph<G> &&
+     *  (
+     *      edge_list_graph<G> ||
+     *      out_edges_graph<G> ||
+     *      (non_directed_graph<G> && in_edges_graph<G>)
+     *  )
+     * }
+     */
+    template <
+        graph_ref G,
+        search_visitor_ref<G> V,
+        util::budget Budget,
+        store::storage_provider_ref<store::storage_type::VECTOR, vertex_of<G>> PV
+            = store::default_provided_t<store::storage_type::VECTOR, vertex_of<G>>,
+        store::storage_provider_ref<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>> PS
+            = store::default_provided_t<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>
+    > requires (
+        vertex_list_graph<G> &&
+        (edge_list_graph<G> || out_edges_graph<G> || (non_directed_graph<G> && in_edges_graph<G>))
+    ) constexpr inline util::run_status depth_first_search_forest(
+        G&& graph,
+        V&& visitor,
+        Budget&& budget,
+        PV&& stack_provider = store::get_default_storage_provider<store::storage_type::VECTOR, vertex_of<G>>(),
+        PS&& set_provider   = store::get_default_storage_provider<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>()
+    ) {
+        return detail::search_forest<store::storage_type::VECTOR>(
+            graph,
+            visitor,
+            [] (auto& stack, auto elem) { stack.push_back(elem); },
+            [] (auto& stack) { return util::take_back(stack); },
+            budget,
+            GRAPHLE_FWD(stack_provider),
+            GRAPHLE_FWD(set_provider)
+        );
+    }
+
+
+    /**
+     * @ingroup Search
+     * Equivalent to the budget overload of @ref depth_first_search_forest, but without a budget.
+     *
+     * @param graph A graphle::graph to visit.
+     * @param visitor A visitor implementing the graphle::search_visitor interface.
+     * @param stack_provider An optional storage-provider which can provide a vector-like type for the algorithm to use.
+     * @param set_provider An optional storage-provider which can provide a unordered-set-like type for the algorithm to use.
+     * @return True if the algorithm finished normally or false if the visitor caused the algorithm to return early.
+     *
+     * @graph_requires{
+     *  vertex_list_graph<G> &&
+     *  (
+     *      edge_list_graph<G> ||
+     *      out_edges_graph<G> ||
+     *      (non_directed_graph<G> && in_edges_graph<G>)
+     *  )
+     * }
+     */
+    template <
+        graph_ref G,
+        search_visitor_ref<G> V,
+        store::storage_provider_ref<store::storage_type::VECTOR, vertex_of<G>> PV
+            = store::default_provided_t<store::storage_type::VECTOR, vertex_of<G>>,
+        store::storage_provider_ref<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>> PS
+            = store::default_provided_t<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>
+    > requires (
+        vertex_list_graph<G> &&
+        (edge_list_graph<G> || out_edges_graph<G> || (non_directed_graph<G> && in_edges_graph<G>))
+    ) constexpr inline bool depth_first_search_forest(
+        G&& graph,
+        V&& visitor,
+        PV&& stack_provider = store::get_default_storage_provider<store::storage_type::VECTOR, vertex_of<G>>(),
+        PS&& set_provider   = store::get_default_storage_provider<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>()
+    ) {
+        return depth_first_search_forest(graph, visitor, util::unlimited_budget {}, GRAPHLE_FWD(stack_provider), GRAPHLE_FWD(set_provider)) == util::run_status::FINISHED;
+    }
 }
\ No newline at end of file
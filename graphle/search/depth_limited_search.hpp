@@ -0,0 +1,473 @@
+#pragma once
+
+#include <common.hpp>
+#include <graph/graph.hpp>
+#include <search/dfs_frame.hpp>
+#include <search/visitor.hpp>
+#include <storage/storage_provider.hpp>
+#include <storage/default_storage_provider.hpp>
+#include <utility/edge_utils.hpp>
+#include <utility/work_budget.hpp>
+
+#include <limits>
+
+
+namespace graphle::search {
+    /**
+     * @ingroup Search
+     * How a search without a set of seen vertices prevents following cycles.
+     */
+    enum class cycle_check {
+        /** Edges are followed to any vertex, so vertices on a cycle are visited repeatedly until the depth limit is reached. */
+        NONE,
+        /** Edges to vertices on the path from the root to the current vertex are not followed. */
+        PATH
+    };
+}
+
+
+namespace graphle::detail {
+    enum class depth_limited_result { FINISHED, CUTOFF, STOPPED, CANCELLED };
+
+
+    /**
+     * Performs a single depth-limited search as part of @ref search::depth_limited_search or @ref search::iterative_deepening_search.
+     * Returns CUTOFF if the search finished but some vertex at the depth limit has out edges that a search with a larger limit would follow.
+     * Every visited edge consumes one unit of work from the given budget. Returns CANCELLED if the budget is exhausted while there are edges left to visit.
+     *
+     * @param frames Vector-like storage for the path from the root to the current vertex. Must be empty.
+     * @param on_path Unordered-set-like storage for the vertices on the path, if checking for cycles. Must be empty.
+     */
+    template <graph_ref G, typename V, util::budget Budget, typename Frames, typename Path>
+    constexpr inline depth_limited_result depth_limited_tree(
+        G& graph,
+        vertex_of<G> root,
+        std::size_t max_depth,
+        V& visitor,
+        search::cycle_check check,
+        Budget&& budget,
+        Frames& frames,
+        Path& on_path
+    ) {
+        using VR   = search::visitor_result;
+        using NVR  = search::nonlocal_visitor_result;
+        using DLR  = depth_limited_result;
+        using Hook = search::visitor_hook;
+
+        constexpr bool visit_vertices   = search::visitor_implements<V>(Hook::DISCOVER_VERTEX);
+        constexpr bool visit_new_edges  = search::visitor_implements<V>(Hook::DISCOVER_EDGE_TO_NEW_VERTEX);
+        constexpr bool visit_seen_edges = search::visitor_implements<V>(Hook::DISCOVER_EDGE_TO_KNOWN_VERTEX);
+
+        const bool check_path = (check == search::cycle_check::PATH);
+        bool cutoff = false, exhausted = false;
+
+
+        // Discovers the given vertex at the given depth and pushes it onto the path if it should be expanded. Returns false if the search should stop.
+        auto discover = [&] (vertex_of<G> vertex, std::size_t depth) {
+            if constexpr (visit_vertices) {
+                switch (visitor.discover_vertex_base(vertex, graph)) {
+                    case VR::STOP_SEARCH: return false;
+                    case VR::STOP_TREE:   return true;
+                    case VR::CONTINUE:    break;
+                }
+            }
+
+
+            if (depth < max_depth) {
+                frames.emplace_back(graph, vertex);
+                if (check_path) on_path.emplace(vertex);
+            } else if (!cutoff) {
+                // Only edges that a deeper search would follow cause a cutoff. With cycle checking, that excludes edges back onto the path,
+                // which the vertex would be part of once expanded.
+                util::for_each_out_edge(graph, vertex, [&] (const edge_of<G>& edge) {
+                    cutoff = !check_path || !(on_path.contains(edge.second) || vertex_compare_of<G>{}(edge.second, vertex));
+                    return !cutoff;
+                });
+            }
+
+            return true;
+        };
+
+
+        if (visitor.begin_tree_base(root, graph) == NVR::STOP_SEARCH) return DLR::STOPPED;
+        if (!discover(root, 0)) return DLR::STOPPED;
+
+
+        while (!rng::empty(frames)) {
+            auto& frame = frames.back();
+
+            if (frame.edge_iterator == rng::end(frame.edges)) {
+                if (check_path) on_path.erase(frame.vertex);
+                frames.pop_back();
+
+                continue;
+            }
+
+
+            // Only cancel the search if there is an edge left to visit, so a budget exhausted by the last edge still finishes the tree.
+            if (exhausted) return DLR::CANCELLED;
+            exhausted = !budget.consume(1);
+
+            const edge_of<G> edge = *frame.edge_iterator;
+            frame.next_edge();
+
+            if (check_path && on_path.contains(edge.second)) {
+                if constexpr (visit_seen_edges) {
+                    if (visitor.discover_edge_to_known_vertex_base(edge, graph) == VR::STOP_SEARCH) return DLR::STOPPED;
+                }
+
+                continue;
+            }
+
+            if constexpr (visit_new_edges) {
+                const auto result = visitor.discover_edge_to_new_vertex_base(edge, graph);
+
+                if (result == VR::STOP_SEARCH) return DLR::STOPPED;
+                if (result == VR::STOP_TREE) continue;
+            }
+
+            // The depth of the target is the number of vertices on the path to it, excluding itself.
+            if (!discover(edge.second, rng::size(frames))) return DLR::STOPPED;
+        }
+
+
+        if (visitor.finish_tree_base(root, graph) == NVR::STOP_SEARCH) return DLR::STOPPED;
+        return cutoff ? DLR::CUTOFF : DLR::FINISHED;
+    }
+}
+
+
+namespace graphle::search {
+    /**
+     * @ingroup Search
+     * Performs a depth first search on the given graph which does not follow edges from vertices at the given maximum depth.
+     * No set of seen vertices is kept, so the memory used is proportional to the maximum depth rather than to the number of visited vertices,
+     * which allows searching implicit graphs that are too large to store. As a consequence, a vertex reachable through multiple paths is visited once for every path.
+     *
+     * The visitor is invoked as follows:
+     *  - begin_search and finish_search are invoked once. begin_tree and finish_tree are invoked once for the root.
+     *  - discover_vertex is invoked every time a vertex is reached, including the root. If it returns STOP_TREE, the edges of the vertex are not followed.
+     *  - discover_edge_to_new_vertex is invoked for every followed edge. If it returns STOP_TREE, the edge is not followed.
+     *  - If checking cycles along the path, discover_edge_to_known_vertex is invoked for edges to vertices on the path, which are not followed.
+     *  - discover_branch, discover_leaf and the batched callbacks are not invoked.
+     *
+     * The search is cancelled once the given budget is exhausted, e.g. when its deadline has passed or a stop is requested through its stop token.
+     * See @ref util::work_budget. Every visited edge consumes one unit of work.
+     *
+     * @param graph A graphle::graph to visit.
+     * @param root The root vertex to start the search from.
+     * @param visitor A visitor implementing the graphle::search_visitor interface.
+     * @param budget A @ref util::work_budget limiting the search. If an lvalue is passed, the work performed is consumed from it.
+     * @param max_depth The maximum number of edges between the root and any visited vertex.
+     * @param check Whether edges to vertices on the current path are followed. Without cycle checking, cycles are followed until the depth limit is reached.
+     * @param stack_provider An optional storage-provider which can provide a vector-like type for the algorithm to use.
+     * @param set_provider An optional storage-provider which can provide a unordered-set-like type for the algorithm to use. Only used if checking cycles.
+     * @return FINISHED if the search finished normally, STOPPED if the visitor caused the algorithm to return early,
+     *  or CANCELLED if the budget was exhausted first.
+     *
+     * @graph_requires{
+     *  edge_list_graph<G> ||
+     *  out_edges_graph<G> ||
+     *  (non_directed_graph<G> && in_edges_graph<G>)
+     * }
+     */
+    template <
+        graph_ref G,
+        search_visitor_ref<G> V,
+        util::budget Budget,
+        store::storage_provider_ref<store::storage_type::VECTOR, detail::dfs_frame<G>> PV
+            = store::default_provided_t<store::storage_type::VECTOR, detail::dfs_frame<G>>,
+        store::storage_provider_ref<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>> PS
+            = store::default_provided_t<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>
+    > requires (
+        edge_list_graph<G> ||
+        out_edges_graph<G> ||
+        (non_directed_graph<G> && in_edges_graph<G>)
+    ) constexpr inline util::run_status depth_limited_search(
+        G&& graph,
+        vertex_of<G> root,
+        V&& visitor,
+        Budget&& budget,
+        std::size_t max_depth,
+        cycle_check check   = cycle_check::PATH,
+        PV&& stack_provider = store::get_default_storage_provider<store::storage_type::VECTOR, detail::dfs_frame<G>>(),
+        PS&& set_provider   = store::get_default_storage_provider<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>()
+    ) {
+        using NVR = nonlocal_visitor_result;
+        using DLR = detail::depth_limited_result;
+
+        if (visitor.begin_search_base(graph) == NVR::STOP_SEARCH) return util::run_status::STOPPED;
+
+
+        decltype(auto) frames  = stack_provider();
+        decltype(auto) on_path = set_provider();
+
+        const auto result = detail::depth_limited_tree(graph, root, max_depth, visitor, check, budget, frames, on_path);
+
+        if (result == DLR::STOPPED)   return util::run_status::STOPPED;
+        if (result == DLR::CANCELLED) return util::run_status::CANCELLED;
+
+
+        if (visitor.finish_search_base(graph) == NVR::STOP_SEARCH) return util::run_status::STOPPED;
+        return util::run_status::FINISHED;
+    }
+
+
+    /**
+     * @ingroup Search
+     * Equivalent to the budget overload of @ref depth_limited_search, but without a budget.
+     *
+     * @param graph A graphle::graph to visit.
+     * @param root The root vertex to start the search from.
+     * @param visitor A visitor implementing the graphle::search_visitor interface.
+     * @param max_depth The maximum number of edges between the root and any visited vertex.
+     * @param check Whether edges to vertices on the current path are followed. Without cycle checking, cycles are followed until the depth limit is reached.
+     * @param stack_provider An optional storage-provider which can provide a vector-like type for the algorithm to use.
+     * @param set_provider An optional storage-provider which can provide a unordered-set-like type for the algorithm to use. Only used if checking cycles.
+     * @return True if the algorithm finished normally or false if the visitor caused the algorithm to return early.
+     *
+     * @graph_requires{
+     *  edge_list_graph<G> ||
+     *  out_edges_graph<G> ||
+     *  (non_directed_graph<G> && in_edges_graph<G>)
+     * }
+     */
+    template <
+        graph_ref G,
+        search_visitor_ref<G> V,
+        store::storage_provider_ref<store::storage_type::VECTOR, detail::dfs_frame<G>> PV
+            = store::default_provided_t<store::storage_type::VECTOR, detail::dfs_frame<G>>,
+        store::storage_provider_ref<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>> PS
+            = store::default_provided_t<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>
+    > requires (
+        edge_list_graph<G> ||
+        out_edges_graph<G> ||
+        (non_directed_graph<G> && in_edges_graph<G>)
+    ) constexpr inline bool depth_limited_search(
+        G&& graph,
+        vertex_of<G> root,
+        V&& visitor,
+        std::size_t max_depth,
+        cycle_check check   = cycle_check::PATH,
+        PV&& stack_provider = store::get_default_storage_provider<store::storage_type::VECTOR, detail::dfs_frame<G>>(),
+        PS&& set_provider   = store::get_default_storage_provider<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>()
+    ) {
+        return depth_limited_search(graph, root, visitor, util::unlimited_budget {}, max_depth, check, GRAPHLE_FWD(stack_provider), GRAPHLE_FWD(set_provider)) == util::run_status::FINISHED;
+    }
+
+
+    /**
+     * @ingroup Search
+     * Performs depth-limited searches (See @ref depth_limited_search) from the given root with a maximum depth of 0, 1, 2, etc.,
+     * until the visitor stops the search, the search no longer reaches the depth limit, or the given maximum depth has been searched.
+     * This visits vertices in order of increasing depth like a breadth first search, while using memory proportional to the depth of the search
+     * like a depth first search, so it can find shallow vertices in graphs that are too large for a breadth first search.
+     * Vertices at a depth smaller than the limit are visited again by every iteration.
+     *
+     * Every iteration is a separate search tree, so begin_tree and finish_tree are invoked with the root for every depth limit,
+     * while begin_search and finish_search are invoked only once. The storage for the path is shared between all iterations.
+     *
+     * The search is cancelled once the given budget is exhausted, e.g. when its deadline has passed or a stop is requested through its stop token.
+     * See @ref util::work_budget. Every visited edge consumes one unit of work, including the edges visited again by later iterations.
+     *
+     * @param graph A graphle::graph to visit.
+     * @param root The root vertex to start the search from.
+     * @param visitor A visitor implementing the graphle::search_visitor interface.
+     * @param budget A @ref util::work_budget limiting the search. If an lvalue is passed, the work performed is consumed from it.
+     * @param max_depth The maximum depth limit of the last iteration. Without cycle checking, every vertex on a cycle reaches the depth limit,
+     *  so the search only ends once the visitor stops it, the budget is exhausted or this depth has been searched. It therefore has no default in this overload.
+     * @param check Whether edges to vertices on the current path are followed. Without cycle checking, cycles are followed until the depth limit is reached.
+     * @param stack_provider An optional storage-provider which can provide a vector-like type for the algorithm to use.
+     * @param set_provider An optional storage-provider which can provide a unordered-set-like type for the algorithm to use. Only used if checking cycles.
+     * @return FINISHED if the search finished normally, STOPPED if the visitor caused the algorithm to return early,
+     *  or CANCELLED if the budget was exhausted first.
+     *
+     * @graph_requires{
+     *  edge_list_graph<G> ||
+     *  out_edges_graph<G> ||
+     *  (non_directed_graph<G> && in_edges_graph<G>)
+     * }
+     */
+    template <
+        graph_ref G,
+        search_visitor_ref<G> V,
+        util::budget Budget,
+        store::storage_provider_ref<store::storage_type::VECTOR, detail::dfs_frame<G>> PV
+            = store::default_provided_t<store::storage_type::VECTOR, detail::dfs_frame<G>>,
+        store::storage_provider_ref<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>> PS
+            = store::default_provided_t<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>
+    > requires (
+        edge_list_graph<G> ||
+        out_edges_graph<G> ||
+        (non_directed_graph<G> && in_edges_graph<G>)
+    ) constexpr inline util::run_status iterative_deepening_search(
+        G&& graph,
+        vertex_of<G> root,
+        V&& visitor,
+        Budget&& budget,
+        std::size_t max_depth,
+        cycle_check check,
+        PV&& stack_provider = store::get_default_storage_provider<store::storage_type::VECTOR, detail::dfs_frame<G>>(),
+        PS&& set_provider   = store::get_default_storage_provider<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>()
+    ) {
+        using NVR = nonlocal_visitor_result;
+        using DLR = detail::depth_limited_result;
+
+        if (visitor.begin_search_base(graph) == NVR::STOP_SEARCH) return util::run_status::STOPPED;
+
+
+        decltype(auto) frames  = stack_provider();
+        decltype(auto) on_path = set_provider();
+
+        for (std::size_t depth = 0; depth <= max_depth; ++depth) {
+            const auto result = detail::depth_limited_tree(graph, root, depth, visitor, check, budget, frames, on_path);
+
+            if (result == DLR::STOPPED)   return util::run_status::STOPPED;
+            if (result == DLR::CANCELLED) return util::run_status::CANCELLED;
+            if (result == DLR::FINISHED || depth == max_depth) break;
+
+            // The tree may have exhausted the budget on its last edge, in which case the next iteration should not be started.
+            if (!budget.consume(0)) return util::run_status::CANCELLED;
+        }
+
+
+        if (visitor.finish_search_base(graph) == NVR::STOP_SEARCH) return util::run_status::STOPPED;
+        return util::run_status::FINISHED;
+    }
+
+
+    /**
+     * @ingroup Search
+     * Equivalent to the budget overload of @ref iterative_deepening_search, checking cycles along the path (See @ref cycle_check::PATH).
+     * With cycle checking, the search ends once no path can be extended any further, so the maximum depth is optional.
+     *
+     * @param graph A graphle::graph to visit.
+     * @param root The root vertex to start the search from.
+     * @param visitor A visitor implementing the graphle::search_visitor interface.
+     * @param budget A @ref util::work_budget limiting the search. If an lvalue is passed, the work performed is consumed from it.
+     * @param max_depth The maximum depth limit of the last iteration.
+     * @param stack_provider An optional storage-provider which can provide a vector-like type for the algorithm to use.
+     * @param set_provider An optional storage-provider which can provide a unordered-set-like type for the algorithm to use.
+     * @return FINISHED if the search finished normally, STOPPED if the visitor caused the algorithm to return early,
+     *  or CANCELLED if the budget was exhausted first.
+     *
+     * @graph_requires{
+     *  edge_list_graph<G> ||
+     *  out_edges_graph<G> ||
+     *  (non_directed_graph<G> && in_edges_graph<G>)
+     * }
+     */
+    template <
+        graph_ref G,
+        search_visitor_ref<G> V,
+        util::budget Budget,
+        store::storage_provider_ref<store::storage_type::VECTOR, detail::dfs_frame<G>> PV
+            = store::default_provided_t<store::storage_type::VECTOR, detail::dfs_frame<G>>,
+        store::storage_provider_ref<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>> PS
+            = store::default_provided_t<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>
+    > requires (
+        edge_list_graph<G> ||
+        out_edges_graph<G> ||
+        (non_directed_graph<G> && in_edges_graph<G>)
+    ) constexpr inline util::run_status iterative_deepening_search(
+        G&& graph,
+        vertex_of<G> root,
+        V&& visitor,
+        Budget&& budget,
+        std::size_t max_depth = std::numeric_limits<std::size_t>::max(),
+        PV&& stack_provider   = store::get_default_storage_provider<store::storage_type::VECTOR, detail::dfs_frame<G>>(),
+        PS&& set_provider     = store::get_default_storage_provider<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>()
+    ) {
+        return iterative_deepening_search(graph, root, visitor, budget, max_depth, cycle_check::PATH, GRAPHLE_FWD(stack_provider), GRAPHLE_FWD(set_provider));
+    }
+
+
+    /**
+     * @ingroup Search
+     * Equivalent to the budget overload of @ref iterative_deepening_search, but without a budget.
+     *
+     * @param graph A graphle::graph to visit.
+     * @param root The root vertex to start the search from.
+     * @param visitor A visitor implementing the graphle::search_visitor interface.
+     * @param max_depth The maximum depth limit of the last iteration. Without cycle checking, the search only ends once the visitor stops it
+     *  or this depth has been searched, so it has no default in this overload.
+     * @param check Whether edges to vertices on the current path are followed. Without cycle checking, cycles are followed until the depth limit is reached.
+     * @param stack_provider An optional storage-provider which can provide a vector-like type for the algorithm to use.
+     * @param set_provider An optional storage-provider which can provide a unordered-set-like type for the algorithm to use. Only used if checking cycles.
+     * @return True if the algorithm finished normally or false if the visitor caused the algorithm to return early.
+     *
+     * @graph_requires{
+     *  edge_list_graph<G> ||
+     *  out_edges_graph<G> ||
+     *  (non_directed_graph<G> && in_edges_graph<G>)
+     * }
+     */
+    template <
+        graph_ref G,
+        search_visitor_ref<G> V,
+        store::storage_provider_ref<store::storage_type::VECTOR, detail::dfs_frame<G>> PV
+            = store::default_provided_t<store::storage_type::VECTOR, detail::dfs_frame<G>>,
+        store::storage_provider_ref<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>> PS
+            = store::default_provided_t<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>
+    > requires (
+        edge_list_graph<G> ||
+        out_edges_graph<G> ||
+        (non_directed_graph<G> && in_edges_graph<G>)
+    ) constexpr inline bool iterative_deepening_search(
+        G&& graph,
+        vertex_of<G> root,
+        V&& visitor,
+        std::size_t max_depth,
+        cycle_check check,
+        PV&& stack_provider = store::get_default_storage_provider<store::storage_type::VECTOR, detail::dfs_frame<G>>(),
+        PS&& set_provider   = store::get_default_storage_provider<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>()
+    ) {
+        const auto status = iterative_deepening_search(
+            graph, root, visitor, util::unlimited_budget {}, max_depth, check, GRAPHLE_FWD(stack_provider), GRAPHLE_FWD(set_provider)
+        );
+
+        return status == util::run_status::FINISHED;
+    }
+
+
+    /**
+     * @ingroup Search
+     * Equivalent to the budget overload of @ref iterative_deepening_search, checking cycles along the path (See @ref cycle_check::PATH), but without a budget.
+     * With cycle checking, the search ends once no path can be extended any further, so the maximum depth is optional.
+     *
+     * @param graph A graphle::graph to visit.
+     * @param root The root vertex to start the search from.
+     * @param visitor A visitor implementing the graphle::search_visitor interface.
+     * @param max_depth The maximum depth limit of the last iteration.
+     * @param stack_provider An optional storage-provider which can provide a vector-like type for the algorithm to use.
+     * @param set_provider An optional storage-provider which can provide a unordered-set-like type for the algorithm to use.
+     * @return True if the algorithm finished normally or false if the visitor caused the algorithm to return early.
+     *
+     * @graph_requires{
+     *  edge_list_graph<G> ||
+     *  out_edges_graph<G> ||
+     *  (non_directed_graph<G> && in_edges_graph<G>)
+     * }
+     */
+    template <
+        graph_ref G,
+        search_visitor_ref<G> V,
+        store::storage_provider_ref<store::storage_type::VECTOR, detail::dfs_frame<G>> PV
+            = store::default_provided_t<store::storage_type::VECTOR, detail::dfs_frame<G>>,
+        store::storage_provider_ref<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>> PS
+            = store::default_provided_t<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>
+    > requires (
+        edge_list_graph<G> ||
+        out_edges_graph<G> ||
+        (non_directed_graph<G> && in_edges_graph<G>)
+    ) constexpr inline bool iterative_deepening_search(
+        G&& graph,
+        vertex_of<G> root,
+        V&& visitor,
+        std::size_t max_depth = std::numeric_limits<std::size_t>::max(),
+        PV&& stack_provider   = store::get_default_storage_provider<store::storage_type::VECTOR, detail::dfs_frame<G>>(),
+        PS&& set_provider     = store::get_default_storage_provider<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>()
+    ) {
+        return iterative_deepening_search(graph, root, visitor, max_depth, cycle_check::PATH, GRAPHLE_FWD(stack_provider), GRAPHLE_FWD(set_provider));
+    }
+}
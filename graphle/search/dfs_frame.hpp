@@ -0,0 +1,47 @@
+#pragma once
+
+#include <common.hpp>
+#include <graph/graph.hpp>
+#include <utility/edge_utils.hpp>
+
+
+namespace graphle::detail {
+    template <graph_ref G> using out_edge_range_t = decltype(util::out_edges(std::declval<G>(), std::declval<vertex_of<G>>()));
+
+
+    /**
+     * A vertex on the path of an iterative depth first search, together with the position of the next out edge to visit.
+     * The edge iterator may refer to the edge range stored in the same object (e.g. for filtering views),
+     * so copying the frame recreates the iterator at the same position within the new copy of the range.
+     */
+    template <graph_ref G> struct dfs_frame {
+        dfs_frame(G& graph, vertex_of<G> vertex) :
+            vertex(vertex),
+            edges(util::out_edges(graph, vertex)),
+            edge_iterator(rng::begin(edges)),
+            edge_position(0)
+        {}
+
+        dfs_frame(const dfs_frame& other) :
+            vertex(other.vertex),
+            edges(other.edges),
+            edge_iterator(rng::next(rng::begin(edges), other.edge_position)),
+            edge_position(other.edge_position)
+        {}
+
+        dfs_frame& operator=(const dfs_frame&) = delete;
+
+
+        void next_edge(void) {
+            ++edge_iterator;
+            ++edge_position;
+        }
+
+
+        vertex_of<G> vertex;
+
+        out_edge_range_t<G> edges;
+        rng::iterator_t<out_edge_range_t<G>> edge_iterator;
+        std::size_t edge_position;
+    };
+}
@@ -0,0 +1,336 @@
+#pragma once
+
+#include <common.hpp>
+#include <graph/graph.hpp>
+#include <search/visitor.hpp>
+#include <storage/storage_provider.hpp>
+#include <storage/default_storage_provider.hpp>
+#include <utility/dynamic_bitset.hpp>
+#include <utility/edge_utils.hpp>
+#include <utility/vertex_index.hpp>
+#include <utility/work_budget.hpp>
+
+#include <optional>
+#include <utility>
+#include <vector>
+
+
+namespace graphle::detail {
+    /**
+     * The in edges of every vertex of a directed graph without in edges, grouped by the index of the vertex they go to.
+     * The index of the source of every edge is stored alongside it, so the bottom-up step can test it against the frontier without a lookup.
+     */
+    template <graph_ref G> struct reverse_adjacency {
+        std::vector<std::size_t> offsets;
+        std::vector<std::size_t> sources;
+        std::vector<edge_of<G>> edges;
+
+
+        template <typename Index> constexpr reverse_adjacency(G& graph, const Index& index) : offsets(index.size() + 1, 0) {
+            util::for_each_edge(graph, [&] (const auto& edge) { ++offsets[index.index_of(edge.second) + 1]; });
+            for (std::size_t i = 1; i < offsets.size(); ++i) offsets[i] += offsets[i - 1];
+
+            sources.resize(offsets.back());
+            edges.resize(offsets.back());
+            std::vector<std::size_t> cursor { offsets.begin(), offsets.end() - 1 };
+
+            util::for_each_edge(graph, [&] (const auto& edge) {
+                const std::size_t position = cursor[index.index_of(edge.second)]++;
+
+                sources[position] = index.index_of(edge.first);
+                edges[position]   = edge;
+            });
+        }
+    };
+}
+
+
+namespace graphle::search {
+    /**
+     * @ingroup Search
+     * Parameters controlling when @ref direction_optimizing_breadth_first_search switches between top-down and bottom-up expansion.
+     * The defaults are the values suggested by Beamer et al., which work well for low-diameter graphs.
+     */
+    struct direction_optimizing_parameters {
+        /**
+         * The search switches to bottom-up expansion once the number of edges from the frontier exceeds
+         * the number of edges from unvisited vertices divided by alpha. Must be greater than zero.
+         */
+        std::size_t alpha = 14;
+        /**
+         * The search switches back to top-down expansion once the number of vertices in the frontier
+         * drops below the number of vertices in the graph divided by beta. Must be greater than zero.
+         */
+        std::size_t beta = 24;
+    };
+
+
+    /**
+     * @ingroup Search
+     * Performs a direction-optimizing breadth first search on the given graph
+     * (Beamer, S., Asanović, K., & Patterson, D. (2012). Direction-optimizing breadth-first search. SC '12. doi:10.1109/SC.2012.50).
+     *
+     * The graph is visited one layer at a time. While the frontier is small, it is expanded top-down like in @ref breadth_first_search.
+     * Once the frontier is large, the search switches to bottom-up expansion: every unvisited vertex looks for an in edge coming from the frontier,
+     * and stops looking as soon as it finds one. On graphs with a small diameter, this skips most of the edges of the largest layers.
+     * The frontier and the set of unvisited vertices are stored as bitmaps over the dense indices of the vertices
+     * (their ids if the graph has vertex ids, see @ref util::make_dense_vertex_index).
+     *
+     * Bottom-up expansion uses the in edges of the graph if it has them. Otherwise the in edges of every vertex are gathered once,
+     * the first time the search switches to bottom-up expansion.
+     *
+     * The visitor is invoked as follows, which differs from @ref breadth_first_search for edges leading to known vertices:
+     *  - discover_vertex, discover_branch and discover_leaf are invoked for every vertex of a layer before the layer is expanded.
+     *  - discover_edge_to_new_vertex is invoked for the edge through which a vertex is reached.
+     *  - discover_edge_to_known_vertex is only invoked during top-down expansion, since bottom-up expansion does not visit these edges.
+     *  Returning STOP_TREE from discover_edge_to_new_vertex prevents the vertex from being reached through that edge,
+     *  but it may still be reached through another edge.
+     *
+     * The search is cancelled once the given budget is exhausted, e.g. when its deadline has passed or a stop is requested through its stop token.
+     * See @ref util::work_budget. Every vertex of a layer consumes one unit of work, plus one for every edge or unvisited vertex examined while expanding it.
+     *
+     * @param graph A graphle::graph to visit.
+     * @param root The root vertex to start the search from.
+     * @param visitor A visitor implementing the graphle::search_visitor interface.
+     * @param budget A @ref util::work_budget limiting the search. If an lvalue is passed, the work performed is consumed from it.
+     *  The budget is only checked between layers, so the search may exceed it by the work of a single layer.
+     * @param parameters The thresholds for switching between top-down and bottom-up expansion.
+     * @param map_provider An optional storage-provider which can provide a unordered-map-like type for the algorithm to use. Unused if the graph has vertex ids.
+     * @return FINISHED if the search finished normally, STOPPED if the visitor caused the algorithm to return early,
+     *  or CANCELLED if the budget was exhausted first.
+     *
+     * @graph_requires{
+     *  vertex_list_graph<G> &&
+     *  (
+     *      edge_list_graph<G> ||
+     *      out_edges_graph<G> ||
+     *      (non_directed_graph<G> && in_edges_graph<G>)
+     *  )
+     * }
+     */
+    template <
+        graph_ref G,
+        search_visitor_ref<G> V,
+        util::budget Budget,
+        store::storage_provider_ref<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>> PM
+            = store::default_provided_t<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>
+    > requires (
+        vertex_list_graph<G> &&
+        (edge_list_graph<G> || out_edges_graph<G> || (non_directed_graph<G> && in_edges_graph<G>))
+    ) constexpr inline util::run_status direction_optimizing_breadth_first_search(
+        G&& graph,
+        vertex_of<G> root,
+        V&& visitor,
+        Budget&& budget,
+        direction_optimizing_parameters parameters = {},
+        PM&& map_provider = store::get_default_storage_provider<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>()
+    ) {
+        using VR  = visitor_result;
+        using NVR = nonlocal_visitor_result;
+
+        // For non-directed graphs, the out edges of a vertex are also its in edges.
+        constexpr bool has_native_in_edges = graph_has_in_edges<G> || (!graph_is_directed<G> && graph_has_out_edges<G>);
+
+
+        if (auto result = visitor.begin_search_base(graph); result == NVR::STOP_SEARCH) return util::run_status::STOPPED;
+
+
+        const auto index = util::make_dense_vertex_index(graph, GRAPHLE_FWD(map_provider));
+        const std::size_t num_indices = index.size();
+
+        util::dynamic_bitset unvisited { num_indices };
+        util::dynamic_bitset frontier_bits { num_indices };
+        std::vector<std::size_t> degrees(num_indices, 0);
+        std::size_t num_vertices = 0, unexplored_edges = 0;
+
+        for (auto vertex : graph.get_vertices()) {
+            unvisited.set(index.index_of(vertex));
+            ++num_vertices;
+        }
+
+        util::for_each_edge(graph, [&] (const auto& edge) {
+            ++degrees[index.index_of(edge.first)];
+            ++unexplored_edges;
+        });
+
+
+        std::vector<std::size_t> frontier, next;
+        std::optional<graphle::detail::reverse_adjacency<std::remove_reference_t<G>>> reverse;
+        bool bottom_up = false;
+        std::size_t work = 0;
+
+        auto reach = [&] (std::size_t i) {
+            next.push_back(i);
+            unexplored_edges -= degrees[i];
+        };
+
+        const std::size_t root_index = index.index_of(root);
+        unvisited.reset(root_index);
+        reach(root_index);
+
+
+        while (!next.empty()) {
+            frontier.swap(next);
+            next.clear();
+
+
+            // Visit the vertices of the layer, and remove vertices for which the visitor stops the tree from the frontier.
+            std::size_t kept = 0, frontier_edges = 0;
+
+            for (std::size_t i : frontier) {
+                const auto vertex = index.vertex_at(i);
+                ++work;
+
+                switch (visitor.discover_vertex_base(vertex, graph)) {
+                    case VR::STOP_SEARCH: return util::run_status::STOPPED;
+                    case VR::STOP_TREE:   continue;
+                    case VR::CONTINUE:    break;
+                }
+
+                // Concepts 'branch' and 'leaf' don't make sense for a non-directed graph so ignore these visitor callbacks.
+                if constexpr (graph_is_directed<G>) {
+                    const auto result = degrees[i] > 0
+                        ? visitor.discover_branch_base(vertex, graph)
+                        : visitor.discover_leaf_base(vertex, graph);
+
+                    if (result == VR::STOP_SEARCH) return util::run_status::STOPPED;
+                    if (result == VR::STOP_TREE) continue;
+                }
+
+                frontier[kept++] = i;
+                frontier_edges += degrees[i];
+            }
+
+            frontier.resize(kept);
+
+
+            bottom_up = bottom_up
+                ? frontier.size() >= num_vertices / parameters.beta
+                : frontier_edges > unexplored_edges / parameters.alpha;
+
+
+            if (!bottom_up) {
+                for (std::size_t i : frontier) {
+                    const auto vertex = index.vertex_at(i);
+
+                    auto visit_edge = [&] (const edge_of<G>& edge) {
+                        const std::size_t target = index.index_of(edge.second);
+                        ++work;
+
+                        if (!unvisited.test(target)) {
+                            return visitor.discover_edge_to_known_vertex_base(edge, graph);
+                        }
+
+                        const auto result = visitor.discover_edge_to_new_vertex_base(edge, graph);
+
+                        if (result == VR::CONTINUE) {
+                            unvisited.reset(target);
+                            reach(target);
+                        }
+
+                        return result;
+                    };
+
+
+                    const bool continued = util::for_each_out_edge(graph, vertex, [&] (const edge_of<G>& edge) {
+                        return visit_edge(edge) != VR::STOP_SEARCH;
+                    });
+
+                    if (!continued) return util::run_status::STOPPED;
+                }
+            } else {
+                if constexpr (!has_native_in_edges) {
+                    if (!reverse) reverse.emplace(graph, index);
+                }
+
+                frontier_bits.clear();
+                for (std::size_t i : frontier) frontier_bits.set(i);
+
+
+                // Returns STOP_TREE if the source of the edge is not part of the frontier, so the search for a parent should continue.
+                auto find_parent = [&] (const edge_of<G>& edge, std::size_t source, std::size_t target) {
+                    ++work;
+                    if (!frontier_bits.test(source)) return VR::STOP_TREE;
+
+                    const auto result = visitor.discover_edge_to_new_vertex_base(edge, graph);
+                    if (result == VR::CONTINUE) reach(target);
+
+                    return result;
+                };
+
+
+                // Vertices reached in this layer are only removed from the unvisited set afterwards, since they cannot be parents of this layer anyway.
+                for (std::size_t i : unvisited.set_bits()) {
+                    VR result = VR::STOP_TREE;
+                    ++work;
+
+                    if constexpr (has_native_in_edges) {
+                        for (const auto& edge : util::in_edges(graph, index.vertex_at(i))) {
+                            result = find_parent(edge, index.index_of(edge.first), i);
+                            if (result != VR::STOP_TREE) break;
+                        }
+                    } else {
+                        const auto& in = *reverse;
+
+                        for (std::size_t position = in.offsets[i]; position < in.offsets[i + 1]; ++position) {
+                            result = find_parent(in.edges[position], in.sources[position], i);
+                            if (result != VR::STOP_TREE) break;
+                        }
+                    }
+
+                    if (result == VR::STOP_SEARCH) return util::run_status::STOPPED;
+                }
+
+                for (std::size_t i : next) unvisited.reset(i);
+            }
+
+
+            // The search is only cancelled if there is another layer left, so a budget exhausted by the last layer still finishes the search.
+            if (!budget.consume(std::exchange(work, 0)) && !next.empty()) return util::run_status::CANCELLED;
+        }
+
+
+        if (auto result = visitor.finish_search_base(graph); result == NVR::STOP_SEARCH) return util::run_status::STOPPED;
+        return util::run_status::FINISHED;
+    }
+
+
+    /**
+     * @ingroup Search
+     * Equivalent to the budget overload of @ref direction_optimizing_breadth_first_search, but without a budget.
+     *
+     * @param graph A graphle::graph to visit.
+     * @param root The root vertex to start the search from.
+     * @param visitor A visitor implementing the graphle::search_visitor interface.
+     * @param parameters The thresholds for switching between top-down and bottom-up expansion.
+     * @param map_provider An optional storage-provider which can provide a unordered-map-like type for the algorithm to use. Unused if the graph has vertex ids.
+     * @return True if the algorithm finished normally or false if the visitor caused the algorithm to return early.
+     *
+     * @graph_requires{
+     *  vertex_list_graph<G> &&
+     *  (
+     *      edge_list_graph<G> ||
+     *      out_edges_graph<G> ||
+     *      (non_directed_graph<G> && in_edges_graph<G>)
+     *  )
+     * }
+     */
+    template <
+        graph_ref G,
+        search_visitor_ref<G> V,
+        store::storage_provider_ref<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>> PM
+            = store::default_provided_t<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>
+    > requires (
+        vertex_list_graph<G> &&
+        (edge_list_graph<G> || out_edges_graph<G> || (non_directed_graph<G> && in_edges_graph<G>))
+    ) constexpr inline bool direction_optimizing_breadth_first_search(
+        G&& graph,
+        vertex_of<G> root,
+        V&& visitor,
+        direction_optimizing_parameters parameters = {},
+        PM&& map_provider = store::get_default_storage_provider<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>()
+    ) {
+        const auto status = direction_optimizing_breadth_first_search(graph, root, visitor, util::unlimited_budget {}, parameters, GRAPHLE_FWD(map_provider));
+        return status == util::run_status::FINISHED;
+    }
+}
@@ -0,0 +1,237 @@
+#pragma once
+
+#include <common.hpp>
+#include <graph/grid_graph.hpp>
+#include <utility/work_budget.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
+
+namespace graphle::search {
+    /**
+     * @ingroup Search
+     * Dense storage for searches on a @ref grid_graph. All per-cell data is stored in flat arrays indexed by cell,
+     * which are only reallocated if the state is reused for a larger grid, so repeated searches do not allocate.
+     *
+     * @tparam Distance The type used to store the distance to each cell.
+     */
+    template <typename Distance = float> struct grid_search_state {
+        /** Value of a distance for cells that have not been reached. */
+        constexpr static inline Distance unreached = std::numeric_limits<Distance>::max();
+        /** Value of a parent for cells without a parent (the source and unreached cells). */
+        constexpr static inline std::size_t no_parent = std::numeric_limits<std::size_t>::max();
+
+
+        /** The distance from the source to every cell, indexed by cell, or unreached. */
+        std::vector<Distance> distance;
+        /** The previous cell on the shortest path from the source to every cell, indexed by cell, or no_parent. */
+        std::vector<std::size_t> parent;
+
+        /** Pending cells of a breadth first search. */
+        std::vector<std::size_t> pending;
+        /** Binary min-heap of pending cells of an A* search, together with their estimated total distance. */
+        std::vector<std::pair<Distance, std::size_t>> heap;
+
+
+        /** Prepares the state for a new search on a grid with the given number of cells. */
+        constexpr void reset(std::size_t num_cells) {
+            distance.assign(num_cells, unreached);
+            parent.assign(num_cells, no_parent);
+            pending.clear();
+            heap.clear();
+        }
+
+
+        /** Returns true if the given cell was reached by the last search. */
+        [[nodiscard]] constexpr bool reached(std::size_t cell) const {
+            return distance[cell] != unreached;
+        }
+
+
+        /**
+         * Returns the cells on the path from the source of the last search to the given cell, including both.
+         * Returns an empty vector if the cell was not reached.
+         */
+        [[nodiscard]] constexpr std::vector<std::size_t> path_to(std::size_t cell) const {
+            std::vector<std::size_t> result;
+            if (!reached(cell)) return result;
+
+            for (std::size_t current = cell; current != no_parent; current = parent[current]) result.push_back(current);
+            std::ranges::reverse(result);
+
+            return result;
+        }
+    };
+
+
+    /**
+     * @ingroup Search
+     * Performs a breadth first search on the given grid from the given source cell, storing the number of steps to every reached cell
+     * and the parent of every reached cell in the provided state. Costs of the cells are ignored.
+     *
+     * @param grid The grid to search.
+     * @param source The index of the cell to start the search from.
+     * @param state Storage for the search. Contains the results of the search after it finishes.
+     * @param budget A @ref util::work_budget limiting the search. If an lvalue is passed, the work performed is consumed from it.
+     *  Every cell consumes one unit of work, plus one for every neighbour visited from it.
+     * @param target An optional cell at which the search stops once it has been reached.
+     * @return FINISHED if the target was reached or every cell reachable from the source was visited, or CANCELLED if the budget was exhausted first.
+     *  Whether the target was reached can be checked with state.reached(target).
+     */
+    template <grid_connectivity C, typename Cost, typename Distance, util::budget Budget>
+    constexpr inline util::run_status grid_breadth_first_search(
+        const grid_graph<C, Cost>& grid,
+        std::size_t source,
+        grid_search_state<Distance>& state,
+        Budget&& budget,
+        std::size_t target = std::numeric_limits<std::size_t>::max()
+    ) {
+        state.reset(grid.num_cells());
+        state.distance[source] = Distance { 0 };
+        state.pending.push_back(source);
+
+        // pending is used as a queue without ever removing elements from the front, since every cell is only added once.
+        for (std::size_t head = 0; head < state.pending.size(); ++head) {
+            const std::size_t cell = state.pending[head];
+            if (cell == target) return util::run_status::FINISHED;
+
+            std::size_t work = 1;
+
+            grid.for_each_neighbor(cell, [&] (std::size_t neighbor, Cost) {
+                ++work;
+                if (state.reached(neighbor)) return;
+
+                state.distance[neighbor] = state.distance[cell] + Distance { 1 };
+                state.parent[neighbor]   = cell;
+                state.pending.push_back(neighbor);
+            });
+
+            // Only cancel if there are cells left, so a budget exhausted by the last cell still finishes the search.
+            if (!budget.consume(work) && head + 1 < state.pending.size()) return util::run_status::CANCELLED;
+        }
+
+        return util::run_status::FINISHED;
+    }
+
+
+    /**
+     * @ingroup Search
+     * Equivalent to the budget overload of @ref grid_breadth_first_search, but without a budget.
+     *
+     * @param grid The grid to search.
+     * @param source The index of the cell to start the search from.
+     * @param state Storage for the search. Contains the results of the search after it finishes.
+     * @param target An optional cell at which the search stops once it has been reached.
+     * @return True if the target was reached, or if no target was given, true if every cell reachable from the source was visited.
+     */
+    template <grid_connectivity C, typename Cost, typename Distance>
+    constexpr inline bool grid_breadth_first_search(
+        const grid_graph<C, Cost>& grid,
+        std::size_t source,
+        grid_search_state<Distance>& state,
+        std::size_t target = std::numeric_limits<std::size_t>::max()
+    ) {
+        grid_breadth_first_search(grid, source, state, util::unlimited_budget {}, target);
+        return target == std::numeric_limits<std::size_t>::max() || state.reached(target);
+    }
+
+
+    /**
+     * @ingroup Search
+     * Finds the lowest-cost path from the source cell to the target cell using A*
+     * (Hart, P. E., Nilsson, N. J., Raphael, B. (1968). A Formal Basis for the Heuristic Determination of Minimum Cost Paths.
+     * IEEE Transactions on Systems Science and Cybernetics, 4(2), 100–107. doi:10.1109/TSSC.1968.300136),
+     * using @ref grid_graph::distance_lower_bound as the heuristic. The distances and parents of all settled cells are stored in the provided state,
+     * and the path can be retrieved with state.path_to(target).
+     *
+     * @param grid The grid to search.
+     * @param source The index of the cell to start the search from.
+     * @param target The index of the cell to find a path to.
+     * @param state Storage for the search. Contains the results of the search after it finishes.
+     * @param budget A @ref util::work_budget limiting the search. If an lvalue is passed, the work performed is consumed from it.
+     *  Every settled cell consumes one unit of work, plus one for every neighbour visited from it.
+     * @return FINISHED if a path to the target was found or every cell reachable from the source was settled, or CANCELLED if the budget was exhausted first.
+     *  Whether a path was found can be checked with state.reached(target).
+     */
+    template <grid_connectivity C, typename Cost, typename Distance, util::budget Budget>
+    constexpr inline util::run_status grid_shortest_path(
+        const grid_graph<C, Cost>& grid,
+        std::size_t source,
+        std::size_t target,
+        grid_search_state<Distance>& state,
+        Budget&& budget
+    ) {
+        state.reset(grid.num_cells());
+
+        const Cost min_cost = grid.min_cost();
+        auto heuristic = [&] (std::size_t cell) { return Distance(grid.distance_lower_bound(cell, target, min_cost)); };
+
+
+        auto compare = [] (const auto& a, const auto& b) { return a.first > b.first; };
+
+        auto push = [&] (std::size_t cell, Distance key) {
+            state.heap.emplace_back(key, cell);
+            std::ranges::push_heap(state.heap, compare);
+        };
+
+
+        state.distance[source] = Distance { 0 };
+        push(source, heuristic(source));
+
+        while (!state.heap.empty()) {
+            std::ranges::pop_heap(state.heap, compare);
+            const auto [key, cell] = state.heap.back();
+            state.heap.pop_back();
+
+            if (cell == target) return util::run_status::FINISHED;
+
+            // Skip outdated entries for cells whose distance was lowered after they were pushed.
+            if (key > state.distance[cell] + heuristic(cell)) continue;
+
+
+            std::size_t work = 1;
+
+            grid.for_each_neighbor(cell, [&] (std::size_t neighbor, Cost cost) {
+                ++work;
+                const Distance distance = state.distance[cell] + Distance(cost);
+
+                if (distance < state.distance[neighbor]) {
+                    state.distance[neighbor] = distance;
+                    state.parent[neighbor]   = cell;
+                    push(neighbor, distance + heuristic(neighbor));
+                }
+            });
+
+            // Only cancel if there are cells left, so a budget exhausted by the last cell still finishes the search.
+            if (!budget.consume(work) && !state.heap.empty()) return util::run_status::CANCELLED;
+        }
+
+        return util::run_status::FINISHED;
+    }
+
+
+    /**
+     * @ingroup Search
+     * Equivalent to the budget overload of @ref grid_shortest_path, but without a budget.
+     *
+     * @param grid The grid to search.
+     * @param source The index of the cell to start the search from.
+     * @param target The index of the cell to find a path to.
+     * @param state Storage for the search. Contains the results of the search after it finishes.
+     * @return True if a path to the target was found.
+     */
+    template <grid_connectivity C, typename Cost, typename Distance>
+    constexpr inline bool grid_shortest_path(
+        const grid_graph<C, Cost>& grid,
+        std::size_t source,
+        std::size_t target,
+        grid_search_state<Distance>& state
+    ) {
+        grid_shortest_path(grid, source, target, state, util::unlimited_budget {});
+        return state.reached(target);
+    }
+}
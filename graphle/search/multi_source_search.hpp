@@ -0,0 +1,380 @@
+#pragma once
+
+#include <common.hpp>
+#include <graph/graph.hpp>
+#include <storage/storage_provider.hpp>
+#include <storage/default_storage_provider.hpp>
+#include <utility/dynamic_bitset.hpp>
+#include <utility/edge_utils.hpp>
+#include <utility/vertex_index.hpp>
+#include <utility/work_budget.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+
+namespace graphle::detail {
+    /** The out-neighbours of every vertex of a graph as dense vertex indices, in CSR form. */
+    struct dense_adjacency {
+        std::vector<std::size_t> offsets;
+        std::vector<std::size_t> targets;
+
+
+        template <graph_ref G, typename Index> constexpr dense_adjacency(G& graph, const Index& index) : offsets(index.size() + 1, 0) {
+            util::for_each_edge(graph, [&] (const auto& edge) { ++offsets[index.index_of(edge.first) + 1]; });
+            for (std::size_t i = 1; i < offsets.size(); ++i) offsets[i] += offsets[i - 1];
+
+            targets.resize(offsets.back());
+            std::vector<std::size_t> cursor { offsets.begin(), offsets.end() - 1 };
+
+            util::for_each_edge(graph, [&] (const auto& edge) {
+                targets[cursor[index.index_of(edge.first)]++] = index.index_of(edge.second);
+            });
+        }
+
+
+        [[nodiscard]] constexpr std::span<const std::size_t> neighbors(std::size_t vertex) const {
+            return std::span { targets }.subspan(offsets[vertex], offsets[vertex + 1] - offsets[vertex]);
+        }
+
+        [[nodiscard]] constexpr std::size_t size(void) const {
+            return offsets.size() - 1;
+        }
+    };
+
+
+    /**
+     * Performs a multi-source BFS from the given roots (as dense vertex indices) in batches of 64 * BatchWords roots.
+     * Invokes visit(vertex, depth, sources, first_source) for every vertex reached by any root of a batch at some depth,
+     * where bit i of sources is set if root first_source + i reaches the vertex at that depth.
+     * Every layer consumes one unit of work for every vertex of the graph, plus one for every edge scanned.
+     * Returns false if the budget was exhausted while there were layers or batches left.
+     */
+    template <std::size_t BatchWords, util::budget Budget, typename F>
+    constexpr inline bool multi_source_bfs_batches(const dense_adjacency& adjacency, std::span<const std::size_t> roots, Budget&& budget, F&& visit) {
+        constexpr std::size_t batch_size = BatchWords * util::bits_per_word;
+        const std::size_t num_vertices   = adjacency.size();
+
+        // Per-vertex rows of BatchWords words, with bit i of a row corresponding to root i of the batch.
+        std::vector<util::bit_word> seen(num_vertices * BatchWords), current(num_vertices * BatchWords), next(num_vertices * BatchWords);
+
+        auto row = [] (auto& rows, std::size_t vertex) {
+            return std::span { rows }.subspan(vertex * BatchWords, BatchWords);
+        };
+
+
+        for (std::size_t first_source = 0; first_source < roots.size(); first_source += batch_size) {
+            const auto batch = roots.subspan(first_source, std::min(batch_size, roots.size() - first_source));
+
+            std::ranges::fill(seen, 0);
+            std::ranges::fill(current, 0);
+
+            for (std::size_t i = 0; i < batch.size(); ++i) {
+                row(seen, batch[i])[i / util::bits_per_word]    |= util::bit_word { 1 } << (i % util::bits_per_word);
+                row(current, batch[i])[i / util::bits_per_word] |= util::bit_word { 1 } << (i % util::bits_per_word);
+            }
+
+            for (std::size_t v = 0; v < num_vertices; ++v) {
+                if (util::words_any(row(current, v))) visit(v, std::size_t { 0 }, row(current, v), first_source);
+            }
+
+
+            for (std::size_t depth = 1; true; ++depth) {
+                std::ranges::fill(next, 0);
+                std::size_t work = num_vertices;
+
+                // Every edge is scanned once for all roots of the batch, merging the sources of a vertex into the next frontier of its neighbours.
+                for (std::size_t v = 0; v < num_vertices; ++v) {
+                    const auto sources = row(current, v);
+                    if (!util::words_any(sources)) continue;
+
+                    for (std::size_t target : adjacency.neighbors(v)) util::words_or(row(next, target), sources);
+                    work += adjacency.neighbors(v).size();
+                }
+
+
+                bool any_reached = false;
+
+                for (std::size_t v = 0; v < num_vertices; ++v) {
+                    auto reached = row(next, v);
+                    util::words_and_not(reached, row(seen, v));
+
+                    if (util::words_any(reached)) {
+                        util::words_or(row(seen, v), reached);
+                        visit(v, depth, reached, first_source);
+
+                        any_reached = true;
+                    }
+                }
+
+                // Only cancel if there is work left, so a budget exhausted by the last layer of the last batch still finishes the search.
+                const bool last = !any_reached && roots.size() - first_source <= batch_size;
+                if (!budget.consume(work) && !last) return false;
+
+                if (!any_reached) break;
+                std::swap(current, next);
+            }
+        }
+
+        return true;
+    }
+}
+
+
+namespace graphle::search {
+    /**
+     * @ingroup Search
+     * Distances from a number of sources to every vertex of a graph, as computed by @ref multi_source_distances.
+     * The distances from every source are stored in a row indexed by the dense vertex index of the graph (See @ref util::make_dense_vertex_index).
+     *
+     * @tparam Index The type of the dense vertex index of the graph.
+     */
+    template <typename Index> class distance_table {
+    public:
+        using vertex_type = decltype(std::declval<const Index&>().vertex_at(0));
+
+        /** The distance of a vertex that is not reachable from a source. */
+        constexpr static inline std::size_t unreached = std::numeric_limits<std::size_t>::max();
+
+
+        constexpr distance_table(Index index, std::size_t num_sources) :
+            index(std::move(index)),
+            sources(num_sources),
+            distances(num_sources * this->index.size(), unreached)
+        {}
+
+
+        /** Returns the number of edges on the shortest path from the given source to the given vertex, or unreached. */
+        [[nodiscard]] constexpr std::size_t distance(std::size_t source, vertex_type vertex) const {
+            return row(source)[index.index_of(vertex)];
+        }
+
+        /** Returns the distances from the given source to every vertex, indexed by dense vertex index. */
+        [[nodiscard]] constexpr std::span<const std::size_t> row(std::size_t source) const {
+            return std::span { distances }.subspan(source * index.size(), index.size());
+        }
+
+        /** @copydoc row */
+        [[nodiscard]] constexpr std::span<std::size_t> row(std::size_t source) {
+            return std::span { distances }.subspan(source * index.size(), index.size());
+        }
+
+
+        [[nodiscard]] constexpr std::size_t num_sources(void) const { return sources; }
+        [[nodiscard]] constexpr const Index& get_index(void) const { return index; }
+    private:
+        Index index;
+        std::size_t sources;
+        std::vector<std::size_t> distances;
+    };
+
+
+    /**
+     * @ingroup Search
+     * Performs a breadth first search from every vertex in the given range of roots at once, sharing the traversal of every edge between the roots
+     * (Then, M. et al. (2014). The More the Merrier: Efficient Multi-Source Graph Traversal. PVLDB 8(4), 449–460. doi:10.14778/2735496.2735507).
+     *
+     * Roots are processed in batches of 64 * BatchWords. Within a batch, every vertex stores which roots have reached it and which roots reached it in the current layer
+     * as a row of BatchWords words, and every layer merges the rows of the frontier into their neighbours using word-wise OR / AND-NOT operations,
+     * so every edge is scanned once per layer for all roots of the batch rather than once for every root.
+     * The graph is converted into an adjacency array over dense vertex indices once, which is shared by all batches.
+     *
+     * @tparam BatchWords The number of 64-bit words of roots processed at once.
+     * @param graph A graphle::graph to visit.
+     * @param roots A sized range of root vertices. The same vertex may appear multiple times.
+     * @param visit A function invoked as visit(vertex, depth, sources) for every vertex reached from at least one root at some depth,
+     *  where sources is a forward range of the positions in roots of every root reaching the vertex at that depth.
+     *  Every vertex is reported at most once per batch and depth, in order of increasing depth within a batch.
+     * @param budget A @ref util::work_budget limiting the search. If an lvalue is passed, the work performed is consumed from it.
+     *  Every layer consumes one unit of work for every vertex of the graph, plus one for every edge scanned, and the budget is only checked between layers.
+     * @param map_provider An optional storage-provider which can provide a unordered-map-like type for the algorithm to use. Unused if the graph has vertex ids.
+     * @return FINISHED if the search finished, or CANCELLED if the budget was exhausted first.
+     *
+     * @graph_requires{
+     *  vertex_list_graph<G> &&
+     *  (
+     *      edge_list_graph<G> ||
+     *      out_edges_graph<G> ||
+     *      (non_directed_graph<G> && in_edges_graph<G>)
+     *  )
+     * }
+     */
+    template <
+        std::size_t BatchWords = 4,
+        graph_ref G,
+        rng::forward_range R,
+        typename F,
+        util::budget Budget,
+        store::storage_provider_ref<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>> PM
+            = store::default_provided_t<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>
+    > requires (
+        BatchWords > 0 &&
+        vertex_list_graph<G> &&
+        (edge_list_graph<G> || out_edges_graph<G> || (non_directed_graph<G> && in_edges_graph<G>)) &&
+        std::convertible_to<rng::range_reference_t<R>, vertex_of<G>>
+    ) constexpr inline util::run_status multi_source_breadth_first_search(
+        G&& graph,
+        R&& roots,
+        F&& visit,
+        Budget&& budget,
+        PM&& map_provider = store::get_default_storage_provider<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>()
+    ) {
+        const auto index = util::make_dense_vertex_index(graph, GRAPHLE_FWD(map_provider));
+        const graphle::detail::dense_adjacency adjacency { graph, index };
+
+        std::vector<std::size_t> root_indices;
+        for (vertex_of<G> root : roots) root_indices.push_back(index.index_of(root));
+
+
+        const bool finished = graphle::detail::multi_source_bfs_batches<BatchWords>(adjacency, root_indices, budget, [&] (std::size_t v, std::size_t depth, std::span<const util::bit_word> sources, std::size_t first_source) {
+            visit(
+                index.vertex_at(v),
+                depth,
+                util::set_bit_range { sources } | views::transform([first_source] (std::size_t i) { return first_source + i; })
+            );
+        });
+
+        return finished ? util::run_status::FINISHED : util::run_status::CANCELLED;
+    }
+
+
+    /**
+     * @ingroup Search
+     * Equivalent to the budget overload of @ref multi_source_breadth_first_search, but without a budget.
+     *
+     * @tparam BatchWords The number of 64-bit words of roots processed at once.
+     * @param graph A graphle::graph to visit.
+     * @param roots A sized range of root vertices. The same vertex may appear multiple times.
+     * @param visit A function invoked as visit(vertex, depth, sources) for every vertex reached from at least one root at some depth.
+     * @param map_provider An optional storage-provider which can provide a unordered-map-like type for the algorithm to use. Unused if the graph has vertex ids.
+     *
+     * @graph_requires{
+     *  vertex_list_graph<G> &&
+     *  (
+     *      edge_list_graph<G> ||
+     *      out_edges_graph<G> ||
+     *      (non_directed_graph<G> && in_edges_graph<G>)
+     *  )
+     * }
+     */
+    template <
+        std::size_t BatchWords = 4,
+        graph_ref G,
+        rng::forward_range R,
+        typename F,
+        store::storage_provider_ref<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>> PM
+            = store::default_provided_t<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>
+    > requires (
+        BatchWords > 0 &&
+        vertex_list_graph<G> &&
+        (edge_list_graph<G> || out_edges_graph<G> || (non_directed_graph<G> && in_edges_graph<G>)) &&
+        std::convertible_to<rng::range_reference_t<R>, vertex_of<G>>
+    ) constexpr inline void multi_source_breadth_first_search(
+        G&& graph,
+        R&& roots,
+        F&& visit,
+        PM&& map_provider = store::get_default_storage_provider<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>()
+    ) {
+        multi_source_breadth_first_search<BatchWords>(graph, GRAPHLE_FWD(roots), GRAPHLE_FWD(visit), util::unlimited_budget {}, GRAPHLE_FWD(map_provider));
+    }
+
+
+    /**
+     * @ingroup Search
+     * Computes the distance from every vertex in the given range of sources to every vertex of the given graph using a multi-source breadth first search.
+     * See @ref multi_source_breadth_first_search.
+     *
+     * @tparam BatchWords The number of 64-bit words of sources processed at once.
+     * @param graph A graphle::graph to compute distances on.
+     * @param sources A sized range of source vertices.
+     * @param budget A @ref util::work_budget limiting the search. If an lvalue is passed, the work performed is consumed from it.
+     * @param map_provider An optional storage-provider which can provide a unordered-map-like type for the algorithm to use. Unused if the graph has vertex ids.
+     * @return A std::pair of the @ref util::run_status (FINISHED if all distances were computed, or CANCELLED if the budget was exhausted first)
+     *  and a @ref distance_table with a row of distances for every source, in the order of the given range.
+     *  If the search was cancelled, distances that were not computed yet are unreached.
+     *
+     * @graph_requires{
+     *  vertex_list_graph<G> &&
+     *  (
+     *      edge_list_graph<G> ||
+     *      out_edges_graph<G> ||
+     *      (non_directed_graph<G> && in_edges_graph<G>)
+     *  )
+     * }
+     */
+    template <
+        std::size_t BatchWords = 4,
+        graph_ref G,
+        rng::forward_range R,
+        util::budget Budget,
+        store::storage_provider_ref<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>> PM
+            = store::default_provided_t<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>
+    > requires (
+        BatchWords > 0 &&
+        vertex_list_graph<G> &&
+        (edge_list_graph<G> || out_edges_graph<G> || (non_directed_graph<G> && in_edges_graph<G>)) &&
+        std::convertible_to<rng::range_reference_t<R>, vertex_of<G>>
+    ) constexpr inline auto multi_source_distances(
+        G&& graph,
+        R&& sources,
+        Budget&& budget,
+        PM&& map_provider = store::get_default_storage_provider<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>()
+    ) {
+        auto index = util::make_dense_vertex_index(graph, GRAPHLE_FWD(map_provider));
+        const graphle::detail::dense_adjacency adjacency { graph, index };
+
+        std::vector<std::size_t> source_indices;
+        for (vertex_of<G> source : sources) source_indices.push_back(index.index_of(source));
+
+
+        distance_table result { std::move(index), source_indices.size() };
+
+        const bool finished = graphle::detail::multi_source_bfs_batches<BatchWords>(adjacency, source_indices, budget, [&] (std::size_t v, std::size_t depth, std::span<const util::bit_word> reached, std::size_t first_source) {
+            for (std::size_t i : util::set_bit_range { reached }) result.row(first_source + i)[v] = depth;
+        });
+
+        return std::pair { finished ? util::run_status::FINISHED : util::run_status::CANCELLED, std::move(result) };
+    }
+
+
+    /**
+     * @ingroup Search
+     * Equivalent to the budget overload of @ref multi_source_distances, but without a budget.
+     *
+     * @tparam BatchWords The number of 64-bit words of sources processed at once.
+     * @param graph A graphle::graph to compute distances on.
+     * @param sources A sized range of source vertices.
+     * @param map_provider An optional storage-provider which can provide a unordered-map-like type for the algorithm to use. Unused if the graph has vertex ids.
+     * @return A @ref distance_table with a row of distances for every source, in the order of the given range.
+     *
+     * @graph_requires{
+     *  vertex_list_graph<G> &&
+     *  (
+     *      edge_list_graph<G> ||
+     *      out_edges_graph<G> ||
+     *      (non_directed_graph<G> && in_edges_graph<G>)
+     *  )
+     * }
+     */
+    template <
+        std::size_t BatchWords = 4,
+        graph_ref G,
+        rng::forward_range R,
+        store::storage_provider_ref<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>> PM
+            = store::default_provided_t<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>
+    > requires (
+        BatchWords > 0 &&
+        vertex_list_graph<G> &&
+        (edge_list_graph<G> || out_edges_graph<G> || (non_directed_graph<G> && in_edges_graph<G>)) &&
+        std::convertible_to<rng::range_reference_t<R>, vertex_of<G>>
+    ) constexpr inline auto multi_source_distances(
+        G&& graph,
+        R&& sources,
+        PM&& map_provider = store::get_default_storage_provider<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>()
+    ) {
+        return multi_source_distances<BatchWords>(graph, GRAPHLE_FWD(sources), util::unlimited_budget {}, GRAPHLE_FWD(map_provider)).second;
+    }
+}
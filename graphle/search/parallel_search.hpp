@@ -0,0 +1,223 @@
+#pragma once
+
+#include <common.hpp>
+#include <graph/graph.hpp>
+#include <search/visitor.hpp>
+#include <storage/storage_provider.hpp>
+#include <storage/default_storage_provider.hpp>
+#include <utility/atomic_bitset.hpp>
+#include <utility/edge_utils.hpp>
+#include <utility/thread_pool.hpp>
+#include <utility/vertex_index.hpp>
+#include <utility/work_budget.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+
+namespace graphle::search {
+    /**
+     * @ingroup Search
+     * Performs a level-synchronous parallel breadth first search on the given graph, using the threads of the given pool,
+     * and cancels the search once the given budget is exhausted, e.g. when its deadline has passed or a stop is requested through its stop token.
+     * See @ref util::work_budget. Every vertex of a layer consumes one unit of work, plus one for every edge visited from it.
+     *
+     * Every layer of the search is expanded in parallel: the frontier is split into chunks containing roughly the same number of edges,
+     * which are taken by the threads of the pool, and every thread collects the vertices it reaches into its own next frontier.
+     * Vertices are claimed with an atomic bitmap over their dense indices (their ids if the graph has vertex ids, see @ref util::make_dense_vertex_index),
+     * so every vertex is reached through exactly one edge. Once all threads are done with a layer, their frontiers are concatenated into the next layer.
+     *
+     * The visitor is invoked as follows:
+     *  - begin_search and finish_search are invoked on the calling thread.
+     *  - All other methods are invoked concurrently from the threads of the pool, so they must be thread-safe.
+     *    A method invoked for a vertex of a layer always happens after all methods invoked for vertices of previous layers,
+     *    so a visitor can e.g. store the depth of every vertex in a plain array without synchronization.
+     *  - discover_vertex, discover_branch and discover_leaf are invoked for every vertex of a layer before its edges are visited.
+     *    The order of the vertices within a layer is unspecified.
+     *  - discover_edge_to_new_vertex is invoked for exactly one edge to every vertex, after that vertex has been claimed.
+     *    Returning STOP_TREE from it prevents the vertex from being visited at all, since it cannot be reached through another edge afterwards.
+     *  - discover_edge_to_known_vertex is invoked for all other edges.
+     *  - Returning STOP_SEARCH from any method stops the search once every thread has noticed it,
+     *    so other methods may still be invoked concurrently for a short time.
+     *
+     * @param graph A graphle::graph to visit. The graph must support concurrent calls to its getters.
+     * @param root The root vertex to start the search from.
+     * @param visitor A thread-safe visitor implementing the graphle::search_visitor interface.
+     * @param pool The thread pool to run the search on.
+     * @param budget A @ref util::work_budget limiting the search. If an lvalue is passed, the work performed is consumed from it.
+     *  The budget is only checked between layers, so the search may exceed it by the work of a single layer.
+     * @param map_provider An optional storage-provider which can provide a unordered-map-like type for the algorithm to use. Unused if the graph has vertex ids.
+     * @return FINISHED if the search finished normally, STOPPED if the visitor caused the algorithm to return early,
+     *  or CANCELLED if the budget was exhausted first.
+     *
+     * @graph_requires{
+     *  vertex_list_graph<G> &&
+     *  (
+     *      out_edges_graph<G> ||
+     *      (non_directed_graph<G> && in_edges_graph<G>)
+     *  )
+     * }
+     */
+    template <
+        graph_ref G,
+        search_visitor_ref<G> V,
+        util::budget Budget,
+        store::storage_provider_ref<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>> PM
+            = store::default_provided_t<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>
+    > requires (
+        vertex_list_graph<G> &&
+        (out_edges_graph<G> || (non_directed_graph<G> && in_edges_graph<G>))
+    ) inline util::run_status parallel_breadth_first_search(
+        G&& graph,
+        vertex_of<G> root,
+        V&& visitor,
+        util::thread_pool& pool,
+        Budget&& budget,
+        PM&& map_provider = store::get_default_storage_provider<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>()
+    ) {
+        using VR  = visitor_result;
+        using NVR = nonlocal_visitor_result;
+
+        // Splitting every layer into more chunks than there are threads lets threads that finish early take over the remaining work.
+        constexpr std::size_t chunks_per_worker = 4;
+
+
+        if (auto result = visitor.begin_search_base(graph); result == NVR::STOP_SEARCH) return util::run_status::STOPPED;
+
+
+        const auto index = util::make_dense_vertex_index(graph, GRAPHLE_FWD(map_provider));
+
+        std::vector<std::size_t> degrees(index.size(), 0);
+        for (auto vertex : graph.get_vertices()) degrees[index.index_of(vertex)] = util::out_degree(graph, vertex);
+
+        util::atomic_bitset visited { index.size() };
+        std::atomic<bool> stopped = false;
+
+        std::vector<std::size_t> frontier { index.index_of(root) };
+        std::vector<std::vector<std::size_t>> next_frontiers(pool.size());
+        std::vector<std::size_t> work, chunk_bounds;
+
+        visited.set(frontier.front());
+
+
+        auto visit_edge = [&] (const edge_of<G>& edge, std::vector<std::size_t>& next) {
+            const std::size_t target = index.index_of(edge.second);
+
+            if (!visited.test_and_set(target)) {
+                return visitor.discover_edge_to_known_vertex_base(edge, graph);
+            }
+
+            const auto result = visitor.discover_edge_to_new_vertex_base(edge, graph);
+            if (result == VR::CONTINUE) next.push_back(target);
+
+            return result;
+        };
+
+
+        auto expand = [&] (std::size_t i, std::vector<std::size_t>& next) {
+            const auto vertex = index.vertex_at(i);
+
+            auto stop = [&] (VR result) {
+                if (result == VR::STOP_SEARCH) stopped.store(true, std::memory_order_relaxed);
+                return result != VR::CONTINUE;
+            };
+
+
+            if (stop(visitor.discover_vertex_base(vertex, graph))) return;
+
+            // Concepts 'branch' and 'leaf' don't make sense for a non-directed graph so ignore these visitor callbacks.
+            if constexpr (graph_is_directed<G>) {
+                if (stop(degrees[i] > 0 ? visitor.discover_branch_base(vertex, graph) : visitor.discover_leaf_base(vertex, graph))) return;
+            }
+
+
+            const bool continued = util::for_each_out_edge(graph, vertex, [&] (const edge_of<G>& edge) {
+                return visit_edge(edge, next) != VR::STOP_SEARCH;
+            });
+
+            if (!continued) stop(VR::STOP_SEARCH);
+        };
+
+
+        while (!frontier.empty()) {
+            // Split the frontier into chunks with roughly the same number of edges, counting every vertex as an edge as well.
+            work.assign(1, 0);
+            for (std::size_t i : frontier) work.push_back(work.back() + degrees[i] + 1);
+
+            const std::size_t num_chunks = std::min(frontier.size(), pool.size() * chunks_per_worker);
+
+            chunk_bounds.clear();
+            for (std::size_t chunk = 0; chunk < num_chunks; ++chunk) {
+                const std::size_t target = work.back() * chunk / num_chunks;
+                chunk_bounds.push_back(std::size_t(std::ranges::lower_bound(work, target) - work.begin()));
+            }
+
+            chunk_bounds.push_back(frontier.size());
+
+
+            pool.run(num_chunks, [&] (std::size_t chunk, std::size_t worker) {
+                for (std::size_t k = chunk_bounds[chunk]; k < chunk_bounds[chunk + 1]; ++k) {
+                    if (stopped.load(std::memory_order_relaxed)) return;
+                    expand(frontier[k], next_frontiers[worker]);
+                }
+            });
+
+            if (stopped.load(std::memory_order_relaxed)) return util::run_status::STOPPED;
+
+
+            frontier.clear();
+
+            for (auto& next : next_frontiers) {
+                frontier.insert(frontier.end(), next.begin(), next.end());
+                next.clear();
+            }
+
+            // The budget is not thread-safe, so the work of a layer is consumed at once after all threads are done with it.
+            // The search is only cancelled if there is another layer left, so a budget exhausted by the last layer still finishes the search.
+            if (!budget.consume(work.back()) && !frontier.empty()) return util::run_status::CANCELLED;
+        }
+
+
+        if (auto result = visitor.finish_search_base(graph); result == NVR::STOP_SEARCH) return util::run_status::STOPPED;
+        return util::run_status::FINISHED;
+    }
+
+
+    /**
+     * @ingroup Search
+     * Equivalent to the budget overload of @ref parallel_breadth_first_search, but without a budget.
+     *
+     * @param graph A graphle::graph to visit. The graph must support concurrent calls to its getters.
+     * @param root The root vertex to start the search from.
+     * @param visitor A thread-safe visitor implementing the graphle::search_visitor interface.
+     * @param pool The thread pool to run the search on.
+     * @param map_provider An optional storage-provider which can provide a unordered-map-like type for the algorithm to use. Unused if the graph has vertex ids.
+     * @return True if the algorithm finished normally or false if the visitor caused the algorithm to return early.
+     *
+     * @graph_requires{
+     *  vertex_list_graph<G> &&
+     *  (
+     *      out_edges_graph<G> ||
+     *      (non_directed_graph<G> && in_edges_graph<G>)
+     *  )
+     * }
+     */
+    template <
+        graph_ref G,
+        search_visitor_ref<G> V,
+        store::storage_provider_ref<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>> PM
+            = store::default_provided_t<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>
+    > requires (
+        vertex_list_graph<G> &&
+        (out_edges_graph<G> || (non_directed_graph<G> && in_edges_graph<G>))
+    ) inline bool parallel_breadth_first_search(
+        G&& graph,
+        vertex_of<G> root,
+        V&& visitor,
+        util::thread_pool& pool,
+        PM&& map_provider = store::get_default_storage_provider<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>()
+    ) {
+        return parallel_breadth_first_search(graph, root, visitor, pool, util::unlimited_budget {}, GRAPHLE_FWD(map_provider)) == util::run_status::FINISHED;
+    }
+}
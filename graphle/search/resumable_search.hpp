@@ -0,0 +1,117 @@
+#pragma once
+
+#include <common.hpp>
+#include <graph/graph.hpp>
+#include <search/search_impl.hpp>
+#include <storage/storage_provider.hpp>
+#include <storage/default_storage_provider.hpp>
+#include <utility/storage_utils.hpp>
+#include <utility/work_budget.hpp>
+
+
+namespace graphle::search {
+    /**
+     * @ingroup Search
+     * Prepares a breadth first search (BFS) on the given graph, which can be run in steps limited by a @ref util::work_budget,
+     * e.g. to spread a search over multiple frames:
+     * ~~~
+     * auto bfs = search::resumable_breadth_first_search(graph, root, my_visitor {});
+     *
+     * // Every frame:
+     * if (bfs.run(util::work_budget::of_time(2ms)) != util::run_status::SUSPENDED) { ... }
+     * ~~~
+     * The search invokes the same visitor callbacks in the same order as @ref breadth_first_search.
+     * Between runs, all state is stored in the storage obtained from the given providers, and the visitor itself.
+     * The graph must outlive the returned search and must not be modified until the search has finished.
+     *
+     * @param graph A graphle::graph to visit.
+     * @param root The root vertex to start the search from.
+     * @param visitor A visitor implementing the graphle::search_visitor interface. If an lvalue is passed, it is stored by reference and must outlive the search.
+     * @param deque_provider An optional storage-provider which can provide a deque-like type for the algorithm to use.
+     * @param set_provider An optional storage-provider which can provide a unordered-set-like type for the algorithm to use.
+     * @return A search object with a method run(budget), returning a @ref util::run_status.
+     *
+     * @graph_requires{
+     *  edge_list_graph<G> ||
+     *  out_edges_graph<G> ||
+     *  (non_directed_graph<G> && in_edges_graph<G>)
+     * }
+     */
+    template <
+        graph_ref G,
+        search_visitor_ref<G> V,
+        store::storage_provider_ref<store::storage_type::DEQUE, vertex_of<G>> PQ
+            = store::default_provided_t<store::storage_type::DEQUE, vertex_of<G>>,
+        store::storage_provider_ref<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>> PS
+            = store::default_provided_t<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>
+    > requires (
+        edge_list_graph<G> ||
+        out_edges_graph<G> ||
+        (non_directed_graph<G> && in_edges_graph<G>)
+    ) constexpr inline auto resumable_breadth_first_search(
+        G& graph,
+        vertex_of<G> root,
+        V&& visitor,
+        PQ&& deque_provider = store::get_default_storage_provider<store::storage_type::DEQUE, vertex_of<G>>(),
+        PS&& set_provider   = store::get_default_storage_provider<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>()
+    ) {
+        return detail::make_search_state<store::storage_type::DEQUE>(
+            graph,
+            detail::single_root<vertex_of<G>> { root },
+            GRAPHLE_FWD(visitor),
+            [] (auto& queue, auto elem) { queue.push_back(elem); },
+            [] (auto& queue) { return util::take_front(queue); },
+            GRAPHLE_FWD(deque_provider),
+            GRAPHLE_FWD(set_provider)
+        );
+    }
+
+
+    /**
+     * @ingroup Search
+     * Prepares a depth first search (DFS) on the given graph, which can be run in steps limited by a @ref util::work_budget.
+     * The search invokes the same visitor callbacks in the same order as @ref depth_first_search.
+     * See @ref resumable_breadth_first_search for details.
+     *
+     * @param graph A graphle::graph to visit.
+     * @param root The root vertex to start the search from.
+     * @param visitor A visitor implementing the graphle::search_visitor interface. If an lvalue is passed, it is stored by reference and must outlive the search.
+     * @param stack_provider An optional storage-provider which can provide a vector-like type for the algorithm to use.
+     * @param set_provider An optional storage-provider which can provide a unordered-set-like type for the algorithm to use.
+     * @return A search object with a method run(budget), returning a @ref util::run_status.
+     *
+     * @graph_requires{
+     *  edge_list_graph<G> ||
+     *  out_edges_graph<G> ||
+     *  (non_directed_graph<G> && in_edges_graph<G>)
+     * }
+     */
+    template <
+        graph_ref G,
+        search_visitor_ref<G> V,
+        store::storage_provider_ref<store::storage_type::VECTOR, vertex_of<G>> PV
+            = store::default_provided_t<store::storage_type::VECTOR, vertex_of<G>>,
+        store::storage_provider_ref<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>> PS
+            = store::default_provided_t<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>
+    > requires (
+        edge_list_graph<G> ||
+        out_edges_graph<G> ||
+        (non_directed_graph<G> && in_edges_graph<G>)
+    ) constexpr inline auto resumable_depth_first_search(
+        G& graph,
+        vertex_of<G> root,
+        V&& visitor,
+        PV&& stack_provider = store::get_default_storage_provider<store::storage_type::VECTOR, vertex_of<G>>(),
+        PS&& set_provider   = store::get_default_storage_provider<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>()
+    ) {
+        return detail::make_search_state<store::storage_type::VECTOR>(
+            graph,
+            detail::single_root<vertex_of<G>> { root },
+            GRAPHLE_FWD(visitor),
+            [] (auto& stack, auto elem) { stack.push_back(elem); },
+            [] (auto& stack) { return util::take_back(stack); },
+            GRAPHLE_FWD(stack_provider),
+            GRAPHLE_FWD(set_provider)
+        );
+    }
+}
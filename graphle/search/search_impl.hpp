@@ -10,11 +10,337 @@
 #include <meta/if_constexpr.hpp>
 #include <views/edge_perspective.hpp>
 #include <search/visitor.hpp>
+#include <utility/prefetch.hpp>
+#include <utility/work_budget.hpp>
 
+#include <optional>
 #include <utility>
+#include <vector>
 
 
 namespace graphle::detail {
+    /** The roots of a search from a single vertex. */
+    template <typename Vertex> struct single_root {
+        std::optional<Vertex> root;
+
+        constexpr std::optional<Vertex> next(void) {
+            return std::exchange(root, std::nullopt);
+        }
+    };
+
+
+    /**
+     * The roots of a forest traversal: every vertex of the graph, in order. Vertices that have already been seen are skipped by the search.
+     * The iterator may refer to the vertex range stored in the same object, so copying recreates the iterator at the same position within the copy.
+     */
+    template <graph_ref G> class vertex_list_roots {
+    public:
+        using graph_type = std::remove_reference_t<G>;
+
+
+        constexpr explicit vertex_list_roots(graph_type& graph) : vertices(graph.get_vertices()), iterator(rng::begin(vertices)) {}
+
+        constexpr vertex_list_roots(const vertex_list_roots& other) :
+            vertices(other.vertices),
+            iterator(rng::next(rng::begin(vertices), other.position)),
+            position(other.position)
+        {}
+
+        vertex_list_roots& operator=(const vertex_list_roots&) = delete;
+
+
+        constexpr std::optional<vertex_of<G>> next(void) {
+            if (iterator == rng::end(vertices)) return std::nullopt;
+
+            vertex_of<G> result = *iterator;
+            ++iterator;
+            ++position;
+
+            return result;
+        }
+    private:
+        using vertex_range_t = decltype(std::declval<graph_type&>().get_vertices());
+
+        vertex_range_t vertices;
+        rng::iterator_t<vertex_range_t> iterator;
+        std::size_t position = 0;
+    };
+
+
+    /**
+     * Visits the out edges of the given vertex for a BFS or DFS search. Every edge to a vertex that has not been seen yet is marked as seen
+     * and passed to on_new_edge, unless the visitor's discover_edge_to_new_vertex method does not return CONTINUE for it.
+     * Hooks the visitor does not implement are skipped entirely.
+     * Adds the number of visited edges to work and returns false if the visitor stopped the search.
+     */
+    template <graph_ref G, typename V, typename Seen, typename OnNewEdge>
+    constexpr inline bool visit_out_edges(G& graph, V& visitor, Seen& seen, vertex_of<G> vertex, std::size_t& work, OnNewEdge&& on_new_edge) {
+        using VR   = search::visitor_result;
+        using Hook = search::visitor_hook;
+
+        constexpr bool visit_new_edges  = search::visitor_implements<V>(Hook::DISCOVER_EDGE_TO_NEW_VERTEX);
+        constexpr bool visit_seen_edges = search::visitor_implements<V>(Hook::DISCOVER_EDGE_TO_KNOWN_VERTEX);
+
+
+        return util::for_each_out_edge(graph, vertex, [&] (const edge_of<G>& edge) {
+            ++work;
+
+            // Without a callback for new vertices, every new vertex is accepted, so it can be marked as seen with a single lookup.
+            if constexpr (!visit_new_edges) {
+                if (seen.emplace(edge.second).second) {
+                    on_new_edge(edge);
+                    return true;
+                }
+            } else {
+                if (!seen.contains(edge.second)) {
+                    const auto result = visitor.discover_edge_to_new_vertex_base(edge, graph);
+
+                    if (result == VR::CONTINUE) {
+                        seen.emplace(edge.second);
+                        on_new_edge(edge);
+                    }
+
+                    return result != VR::STOP_SEARCH;
+                }
+            }
+
+            if constexpr (visit_seen_edges) return visitor.discover_edge_to_known_vertex_base(edge, graph) != VR::STOP_SEARCH;
+            else return true;
+        });
+    }
+
+
+    /**
+     * @ingroup Search
+     * State of a BFS or DFS search, which can be run in steps of a limited amount of work and continued later.
+     * The state is only suspended between the expansion of two vertices, so the pending vertices and the set of seen vertices are the entire state of the search.
+     * A new search tree is started from every root that has not been seen yet once the previous tree is finished, reusing the same storage.
+     *
+     * @tparam G The type of the graph to search.
+     * @tparam Roots The type of an object with a method next(), returning the next root of the search as a std::optional (See single_root and vertex_list_roots).
+     * @tparam V The type of the visitor. If this is a reference type, the visitor is stored by reference.
+     * @tparam Pending The type of the pending vertex list, as returned by its storage-provider.
+     * @tparam Seen The type of the set of seen vertices, as returned by its storage-provider.
+     * @tparam Emplace The type of an object invocable as emplace(pending, element) to emplace the given element into the pending vertex list.
+     * @tparam Take The type of an object invocable as take(pending) to take an element from the pending vertex list.
+     * @tparam TakesFront True if take removes the first element of the pending vertex list (a queue), or false if it removes the last one (a stack).
+     */
+    template <graph_ref G, typename Roots, typename V, typename Pending, typename Seen, typename Emplace, typename Take, bool TakesFront>
+    class search_state {
+    public:
+        using graph_type  = std::remove_reference_t<G>;
+        using vertex_type = vertex_of<G>;
+
+
+        constexpr search_state(graph_type& graph, Roots roots, V&& visitor, Pending&& pending, Seen&& seen, Emplace emplace, Take take) :
+            graph(&graph),
+            roots(std::move(roots)),
+            visitor(GRAPHLE_FWD(visitor)),
+            pending(GRAPHLE_FWD(pending)),
+            seen(GRAPHLE_FWD(seen)),
+            emplace(std::move(emplace)),
+            take(std::move(take))
+        {}
+
+
+        /**
+         * Continues the search until it finishes, the visitor stops it, or the given budget is exhausted.
+         * Every expanded vertex consumes one unit of work, plus one for every edge visited from it.
+         * At least one vertex is expanded on every call, even if the budget is already exhausted.
+         *
+         * @param budget A @ref util::work_budget or @ref util::unlimited_budget. If an lvalue is passed, the work performed is consumed from it,
+         *  so a single budget can be shared between multiple algorithms.
+         * @return The status of the search after the call: SUSPENDED if the budget was exhausted, or CANCELLED if that was because of a stop request.
+         *  Running a search that is not SUSPENDED has no effect.
+         */
+        template <util::budget Budget> constexpr util::run_status run(Budget&& budget) {
+            using RS   = util::run_status;
+            using NVR  = search::nonlocal_visitor_result;
+            using Hook = search::visitor_hook;
+
+            constexpr bool visit_tree_begin  = search::visitor_implements<V>(Hook::BEGIN_TREE);
+            constexpr bool visit_tree_finish = search::visitor_implements<V>(Hook::FINISH_TREE);
+
+
+            if (status != RS::SUSPENDED) return status;
+
+            if (!started) {
+                started = true;
+                if (visitor.begin_search_base(*graph) == NVR::STOP_SEARCH) return status = RS::STOPPED;
+            }
+
+
+            bool exhausted = false;
+
+            while (true) {
+                if (rng::empty(pending)) {
+                    if constexpr (visit_tree_finish) {
+                        if (tree_root && visitor.finish_tree_base(*tree_root, *graph) == NVR::STOP_SEARCH) return status = RS::STOPPED;
+                    }
+
+
+                    do tree_root = roots.next();
+                    while (tree_root && seen.contains(*tree_root));
+
+                    if (!tree_root) break;
+
+
+                    seen.emplace(*tree_root);
+                    emplace(pending, *tree_root);
+
+                    if constexpr (visit_tree_begin) {
+                        if (visitor.begin_tree_base(*tree_root, *graph) == NVR::STOP_SEARCH) return status = RS::STOPPED;
+                    }
+                }
+
+
+                if (exhausted) {
+                    if (budget.cancelled()) status = RS::CANCELLED;
+                    return status;
+                }
+
+
+                if constexpr (prefetch_adjacency) prefetch_ahead();
+
+                std::size_t work = 1;
+                if (!expand(take(pending), work)) return status = RS::STOPPED;
+
+                exhausted = !budget.consume(work);
+            }
+
+
+            if (visitor.finish_search_base(*graph) == NVR::STOP_SEARCH) return status = RS::STOPPED;
+            return status = RS::FINISHED;
+        }
+
+
+        [[nodiscard]] constexpr util::run_status get_status(void) const { return status; }
+        [[nodiscard]] constexpr bool finished(void) const { return status != util::run_status::SUSPENDED; }
+
+        [[nodiscard]] constexpr std::remove_reference_t<V>& get_visitor(void) { return visitor; }
+        [[nodiscard]] constexpr const std::remove_reference_t<V>& get_visitor(void) const { return visitor; }
+    private:
+        graph_type* graph;
+        Roots roots;
+        V visitor;
+
+        Pending pending;
+        Seen seen;
+        Emplace emplace;
+        Take take;
+
+        // Edges to new vertices from the current vertex, if they are passed to the visitor in a single batch.
+        std::vector<edge_of<G>> new_edges;
+
+        // The root of the current search tree.
+        std::optional<vertex_type> tree_root;
+
+        util::run_status status = util::run_status::SUSPENDED;
+        bool started = false;
+
+
+        // Prefetching is only compiled in if it is enabled through GRAPHLE_PREFETCH_DISTANCE.
+        constexpr static std::size_t prefetch_distance = util::default_prefetch_distance;
+        constexpr static bool prefetch_adjacency = prefetch_distance > 0 && contiguous_out_neighbors_graph<G> && rng::random_access_range<std::remove_reference_t<Pending>>;
+
+
+        /**
+         * Prefetches the neighbour list of the vertex prefetch_distance positions ahead in the pending vertex list, and the vertex twice as far ahead.
+         * Since the vertex was itself prefetched earlier, its neighbour list can be located without waiting for memory,
+         * and by the time the search reaches it, both the vertex and its neighbours are in the cache.
+         */
+        void prefetch_ahead(void) {
+            const std::size_t size = rng::size(pending);
+
+            auto ahead = [&] (std::size_t distance) -> vertex_type {
+                if constexpr (TakesFront) return pending[distance];
+                else return pending[size - 1 - distance];
+            };
+
+
+            if (size > 2 * prefetch_distance) util::prefetch(ahead(2 * prefetch_distance));
+            if (size > prefetch_distance) util::prefetch(rng::data(util::out_neighbors(*graph, ahead(prefetch_distance))));
+        }
+
+
+        /**
+         * Invokes the visitor for the given vertex and pushes its unseen neighbours.
+         * Adds the number of visited edges to work and returns false if the visitor stopped the search.
+         */
+        constexpr bool expand(vertex_type next, std::size_t& work) {
+            using VR   = search::visitor_result;
+            using NVR  = search::nonlocal_visitor_result;
+            using Hook = search::visitor_hook;
+
+            // Hooks the visitor does not implement are skipped entirely, together with any work needed only to invoke them.
+            constexpr bool visit_vertices   = search::visitor_implements<V>(Hook::DISCOVER_VERTEX);
+            constexpr bool visit_branches   = search::visitor_implements<V>(Hook::DISCOVER_BRANCH) && graph_is_directed<G>;
+            constexpr bool visit_leaves     = search::visitor_implements<V>(Hook::DISCOVER_LEAF)   && graph_is_directed<G>;
+            constexpr bool batch_new_edges  = search::visitor_implements<V>(Hook::DISCOVER_EDGES_TO_NEW_VERTICES);
+
+
+            if constexpr (visit_vertices) {
+                switch (visitor.discover_vertex_base(next, *graph)) {
+                    case VR::STOP_SEARCH: return false;
+                    case VR::STOP_TREE:   return true;
+                    case VR::CONTINUE:    break;
+                }
+            }
+
+            // Concepts 'branch' and 'leaf' don't make sense for a non-directed graph so ignore these visitor callbacks.
+            if constexpr (visit_branches || visit_leaves) {
+                const bool is_branch = util::is_branch(*graph, next);
+                VR result = VR::CONTINUE;
+
+                if constexpr (visit_branches) {
+                    if (is_branch) result = visitor.discover_branch_base(next, *graph);
+                }
+
+                if constexpr (visit_leaves) {
+                    if (!is_branch) result = visitor.discover_leaf_base(next, *graph);
+                }
+
+                if (result == VR::STOP_SEARCH) return false;
+                if (result == VR::STOP_TREE) return true;
+            }
+
+
+            const bool continued = visit_out_edges(*graph, visitor, seen, next, work, [&] (const edge_of<G>& edge) {
+                emplace(pending, edge.second);
+                if constexpr (batch_new_edges) new_edges.push_back(edge);
+            });
+
+            if (!continued) return false;
+
+
+            if constexpr (batch_new_edges) {
+                if (!new_edges.empty()) {
+                    if (visitor.discover_edges_to_new_vertices_base(new_edges, *graph) == NVR::STOP_SEARCH) return false;
+                    new_edges.clear();
+                }
+            }
+
+            return true;
+        }
+    };
+
+
+    /** Constructs the state of a search with the given pending vertex list type. See @ref search_state. */
+    template <store::storage_type ST, typename G, typename Roots, typename V, typename EmplacePP, typename TakePP, typename PP, typename PS>
+    constexpr inline auto make_search_state(G& graph, Roots roots, V&& visitor, EmplacePP&& emplace, TakePP&& take, PP&& pending_provider, PS&& set_provider) {
+        return search_state<
+            G&,
+            Roots,
+            V,
+            decltype(pending_provider()),
+            decltype(set_provider()),
+            std::remove_cvref_t<EmplacePP>,
+            std::remove_cvref_t<TakePP>,
+            (ST == store::storage_type::DEQUE)
+        > { graph, std::move(roots), GRAPHLE_FWD(visitor), pending_provider(), set_provider(), GRAPHLE_FWD(emplace), GRAPHLE_FWD(take) };
+    }
+
+
     /**
      * @ingroup Search
      * Common implementation for the BFS and DFS search algorithms, since their implementation is the same,
@@ -59,72 +385,54 @@ namespace graphle::detail {
         PP&& pending_provider = store::get_default_storage_provider<ST, vertex_of<G>>(),
         PS&& set_provider     = store::get_default_storage_provider<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>()
     ) {
-        using VR  = search::visitor_result;
-        using NVR = search::nonlocal_visitor_result;
-
-
-        if (auto result = visitor.begin_search_base(graph); result == NVR::STOP_SEARCH) return false;
-
-
-        decltype(auto) pending = pending_provider();
-        emplace(pending, root);
-
-        decltype(auto) seen = set_provider();
-        seen.emplace(root);
-
-
-        while (!rng::empty(pending)) {
-            vertex_of<G> next = take(pending);
-
-
-            switch (visitor.discover_vertex_base(next, graph)) {
-                case VR::STOP_SEARCH: return false;
-                case VR::STOP_TREE:   continue;
-                case VR::CONTINUE:    break;
-            }
-
-            // Concepts 'branch' and 'leaf' don't make sense for a non-directed graph so ignore these visitor callbacks.
-            if constexpr (graph_is_directed<G>) {
-                if (util::is_branch(graph, next)) {
-                    switch (visitor.discover_branch_base(next, graph)) {
-                        case VR::STOP_SEARCH: return false;
-                        case VR::STOP_TREE:   continue;
-                        case VR::CONTINUE:    break;
-                    }
-                }
-
-                if (util::is_leaf(graph, next)) {
-                    switch (visitor.discover_leaf_base(next, graph)) {
-                        case VR::STOP_SEARCH: return false;
-                        case VR::STOP_TREE:   continue;
-                        case VR::CONTINUE:    break;
-                    }
-                }
-            }
+        auto state = make_search_state<ST>(graph, single_root<vertex_of<G>> { root }, GRAPHLE_FWD(visitor), GRAPHLE_FWD(emplace), GRAPHLE_FWD(take), GRAPHLE_FWD(pending_provider), GRAPHLE_FWD(set_provider));
 
+        util::unlimited_budget budget;
+        return state.run(budget) == util::run_status::FINISHED;
+    }
 
-            for (auto edge : util::out_edges(graph, next)) {
-                if (seen.contains(edge.second)) {
-                    switch (visitor.discover_edge_to_known_vertex_base(edge, graph)) {
-                        case VR::STOP_SEARCH: return false;
-                        case VR::STOP_TREE:   continue;
-                        case VR::CONTINUE:    continue;
-                    }
-                } else {
-                    switch (visitor.discover_edge_to_new_vertex_base(edge, graph)) {
-                        case VR::STOP_SEARCH: return false;
-                        case VR::STOP_TREE:   continue;
-                        case VR::CONTINUE:
-                            seen.emplace(edge.second);
-                            emplace(pending, edge.second);
-                            break;
-                    }
-                }
-            }
-        }
 
+    /**
+     * @ingroup Search
+     * Common implementation for the BFS and DFS forest traversals. Equivalent to @ref search, but starts a new search tree
+     * from every vertex of the graph that has not been seen yet, sharing the pending vertex list and the set of seen vertices between all trees.
+     * The traversal is cancelled once the given budget is exhausted, like the budget overloads of the single-root searches.
+     *
+     * @graph_requires{
+     *  vertex_list_graph<G> &&
+     *  (
+     *      edge_list_graph<G> ||
+     *      out_edges_graph<G> ||
+     *      (non_directed_graph<G> && in_edges_graph<G>)
+     *  )
+     * }
+     */
+    template <
+        store::storage_type ST,
+        graph_ref G,
+        search::search_visitor_ref<G> V,
+        typename EmplacePP,
+        typename TakePP,
+        util::budget Budget,
+        store::storage_provider_ref<ST, vertex_of<G>> PP
+            = store::default_provided_t<ST, vertex_of<G>>,
+        store::storage_provider_ref<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>> PS
+            = store::default_provided_t<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>
+    > requires (
+        vertex_list_graph<G> &&
+        (edge_list_graph<G> || out_edges_graph<G> || (non_directed_graph<G> && in_edges_graph<G>))
+    ) constexpr inline util::run_status search_forest(
+        G&& graph,
+        V&& visitor,
+        EmplacePP&& emplace,
+        TakePP&& take,
+        Budget&& budget,
+        PP&& pending_provider = store::get_default_storage_provider<ST, vertex_of<G>>(),
+        PS&& set_provider     = store::get_default_storage_provider<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>()
+    ) {
+        auto state = make_search_state<ST>(graph, vertex_list_roots<G> { graph }, GRAPHLE_FWD(visitor), GRAPHLE_FWD(emplace), GRAPHLE_FWD(take), GRAPHLE_FWD(pending_provider), GRAPHLE_FWD(set_provider));
 
-        if (auto result = visitor.finish_search_base(graph); result == NVR::STOP_SEARCH) return false;
-        return true;
+        const auto status = state.run(budget);
+        return status == util::run_status::SUSPENDED ? util::run_status::CANCELLED : status;
     }
 }
\ No newline at end of file
@@ -4,7 +4,9 @@
 #include <graph/graph.hpp>
 #include <utility/functional.hpp>
 
+#include <cstdint>
 #include <functional>
+#include <span>
 
 
 #define GRAPHLE_VISIT_DERIVED(F, D, ...)                            \
@@ -27,6 +29,15 @@
 }()
 
 
+#define GRAPHLE_DERIVED_IMPLEMENTS(F, ...)                                                              \
+(                                                                                                       \
+    requires (Derived& d, vertex v, edge e, vertex_span vs, edge_span es, std::size_t depth, graph& g) {  \
+        d.F(__VA_ARGS__);                                                                               \
+    } &&                                                                                                \
+    !requires { requires std::is_same_v<std::remove_cvref_t<decltype(Derived::F)>, util::no_op_t>; }    \
+)
+
+
 namespace graphle::search {
     /**
      * @ingroup Search
@@ -54,6 +65,43 @@ namespace graphle::search {
     };
 
 
+    /**
+     * @ingroup Search
+     * Flags for the methods of a @ref search_visitor, used to indicate which methods a visitor implements.
+     */
+    enum class visitor_hook : std::uint32_t {
+        NONE                           = 0,
+        DISCOVER_VERTEX                = 1 << 0,
+        DISCOVER_BRANCH                = 1 << 1,
+        DISCOVER_LEAF                  = 1 << 2,
+        DISCOVER_EDGE_TO_NEW_VERTEX    = 1 << 3,
+        DISCOVER_EDGE_TO_KNOWN_VERTEX  = 1 << 4,
+        BEGIN_SEARCH                   = 1 << 5,
+        FINISH_SEARCH                  = 1 << 6,
+        DISCOVER_VERTICES              = 1 << 7,
+        DISCOVER_EDGES_TO_NEW_VERTICES = 1 << 8,
+        BEGIN_LAYER                    = 1 << 9,
+        FINISH_LAYER                   = 1 << 10,
+        BEGIN_TREE                     = 1 << 11,
+        FINISH_TREE                    = 1 << 12,
+        FINISH_VERTEX                  = 1 << 13,
+        DISCOVER_BACK_EDGE             = 1 << 14,
+        DISCOVER_FORWARD_EDGE          = 1 << 15,
+        DISCOVER_CROSS_EDGE            = 1 << 16
+    };
+
+
+    /** @ingroup Search */
+    constexpr inline visitor_hook operator|(visitor_hook a, visitor_hook b) {
+        return visitor_hook(std::uint32_t(a) | std::uint32_t(b));
+    }
+
+    /** @ingroup Search */
+    constexpr inline visitor_hook operator&(visitor_hook a, visitor_hook b) {
+        return visitor_hook(std::uint32_t(a) & std::uint32_t(b));
+    }
+
+
 
 
     /**
@@ -63,6 +111,10 @@ namespace graphle::search {
      *  (i.e. your derived method should be called discover_vertex not discover_vertex_base).
      * Derived methods may return either void or a visitor_result.
      *
+     * Which methods the derived class implements is known at compile time through @ref implements,
+     * so search algorithms can skip the work needed to invoke methods that are not implemented (e.g. computing the degree of every vertex for discover_branch).
+     * A data member of type util::no_op_t does not count as an implementation.
+     *
      * @tparam Derived The CRTP-derived type.
      * @tparam Graph The associated graph type.
      */
@@ -72,6 +124,39 @@ namespace graphle::search {
         using vertex = vertex_of<Graph>;
         using edge   = edge_of<Graph>;
 
+        using vertex_span = std::span<const vertex>;
+        using edge_span   = std::span<const edge>;
+
+
+        /** Returns the set of methods implemented by the derived class. */
+        [[nodiscard]] constexpr static visitor_hook implemented_hooks(void) {
+            using enum visitor_hook;
+
+            return
+                (GRAPHLE_DERIVED_IMPLEMENTS(discover_vertex, v, g)                 ? DISCOVER_VERTEX                : NONE) |
+                (GRAPHLE_DERIVED_IMPLEMENTS(discover_branch, v, g)                 ? DISCOVER_BRANCH                : NONE) |
+                (GRAPHLE_DERIVED_IMPLEMENTS(discover_leaf, v, g)                   ? DISCOVER_LEAF                  : NONE) |
+                (GRAPHLE_DERIVED_IMPLEMENTS(discover_edge_to_new_vertex, e, g)     ? DISCOVER_EDGE_TO_NEW_VERTEX    : NONE) |
+                (GRAPHLE_DERIVED_IMPLEMENTS(discover_edge_to_known_vertex, e, g)   ? DISCOVER_EDGE_TO_KNOWN_VERTEX  : NONE) |
+                (GRAPHLE_DERIVED_IMPLEMENTS(begin_search, g)                       ? BEGIN_SEARCH                   : NONE) |
+                (GRAPHLE_DERIVED_IMPLEMENTS(finish_search, g)                      ? FINISH_SEARCH                  : NONE) |
+                (GRAPHLE_DERIVED_IMPLEMENTS(discover_vertices, vs, g)              ? DISCOVER_VERTICES              : NONE) |
+                (GRAPHLE_DERIVED_IMPLEMENTS(discover_edges_to_new_vertices, es, g) ? DISCOVER_EDGES_TO_NEW_VERTICES : NONE) |
+                (GRAPHLE_DERIVED_IMPLEMENTS(begin_layer, depth, g)                 ? BEGIN_LAYER                    : NONE) |
+                (GRAPHLE_DERIVED_IMPLEMENTS(finish_layer, depth, g)                ? FINISH_LAYER                   : NONE) |
+                (GRAPHLE_DERIVED_IMPLEMENTS(begin_tree, v, g)                      ? BEGIN_TREE                     : NONE) |
+                (GRAPHLE_DERIVED_IMPLEMENTS(finish_tree, v, g)                     ? FINISH_TREE                    : NONE) |
+                (GRAPHLE_DERIVED_IMPLEMENTS(finish_vertex, v, g)                   ? FINISH_VERTEX                  : NONE) |
+                (GRAPHLE_DERIVED_IMPLEMENTS(discover_back_edge, e, g)              ? DISCOVER_BACK_EDGE             : NONE) |
+                (GRAPHLE_DERIVED_IMPLEMENTS(discover_forward_edge, e, g)           ? DISCOVER_FORWARD_EDGE          : NONE) |
+                (GRAPHLE_DERIVED_IMPLEMENTS(discover_cross_edge, e, g)             ? DISCOVER_CROSS_EDGE            : NONE);
+        }
+
+        /** Returns true if the derived class implements all of the given methods. */
+        [[nodiscard]] constexpr static bool implements(visitor_hook hooks) {
+            return (implemented_hooks() & hooks) == hooks;
+        }
+
 
         /** Called when a vertex is first visited during search. */
         visitor_result discover_vertex_base(vertex v, graph& g) {
@@ -119,6 +204,97 @@ namespace graphle::search {
         nonlocal_visitor_result finish_search_base(graph& g) {
             return GRAPHLE_VISIT_DERIVED(finish_search, nonlocal_visitor_result::CONTINUE, g);
         }
+
+
+        /**
+         * Called with a batch of vertices which are visited during search, after discover_vertex has been called for each of them.
+         * Only called by searches that support batched callbacks (See @ref batched_breadth_first_search).
+         */
+        nonlocal_visitor_result discover_vertices_base(vertex_span vs, graph& g) {
+            return GRAPHLE_VISIT_DERIVED(discover_vertices, nonlocal_visitor_result::CONTINUE, vs, g);
+        }
+
+
+        /**
+         * Called with a batch of edges which lead to unvisited vertices, after discover_edge_to_new_vertex has been called for each of them.
+         * Edges for which discover_edge_to_new_vertex returned STOP_TREE are not part of the batch.
+         * @ref breadth_first_search and @ref depth_first_search call this once for the edges of every visited vertex.
+         */
+        nonlocal_visitor_result discover_edges_to_new_vertices_base(edge_span es, graph& g) {
+            return GRAPHLE_VISIT_DERIVED(discover_edges_to_new_vertices, nonlocal_visitor_result::CONTINUE, es, g);
+        }
+
+
+        /**
+         * Called before the vertices at the given distance from the root are visited.
+         * Only called by searches that visit the graph one layer at a time (See @ref batched_breadth_first_search).
+         */
+        nonlocal_visitor_result begin_layer_base(std::size_t depth, graph& g) {
+            return GRAPHLE_VISIT_DERIVED(begin_layer, nonlocal_visitor_result::CONTINUE, depth, g);
+        }
+
+
+        /**
+         * Called after the vertices at the given distance from the root and their edges have been visited.
+         * Only called by searches that visit the graph one layer at a time (See @ref batched_breadth_first_search).
+         */
+        nonlocal_visitor_result finish_layer_base(std::size_t depth, graph& g) {
+            return GRAPHLE_VISIT_DERIVED(finish_layer, nonlocal_visitor_result::CONTINUE, depth, g);
+        }
+
+
+        /**
+         * Called before the given vertex is visited as the root of a new search tree.
+         * Only called by @ref breadth_first_search, @ref depth_first_search, their forest traversals (See @ref depth_first_search_forest)
+         * and the depth-limited searches (See @ref depth_limited_search).
+         * A search from a single root has a single tree, while forest traversals start a tree from every undiscovered vertex.
+         */
+        nonlocal_visitor_result begin_tree_base(vertex v, graph& g) {
+            return GRAPHLE_VISIT_DERIVED(begin_tree, nonlocal_visitor_result::CONTINUE, v, g);
+        }
+
+
+        /** Called after the last vertex reachable from the given root of a search tree has been visited. */
+        nonlocal_visitor_result finish_tree_base(vertex v, graph& g) {
+            return GRAPHLE_VISIT_DERIVED(finish_tree, nonlocal_visitor_result::CONTINUE, v, g);
+        }
+
+
+        /**
+         * Called after all out edges of the given vertex, and all vertices discovered through them, have been visited (I.e. in post-order).
+         * Only called by @ref classified_depth_first_search and @ref classified_depth_first_search_forest.
+         */
+        nonlocal_visitor_result finish_vertex_base(vertex v, graph& g) {
+            return GRAPHLE_VISIT_DERIVED(finish_vertex, nonlocal_visitor_result::CONTINUE, v, g);
+        }
+
+
+        /**
+         * Called after discover_edge_to_known_vertex if the edge leads to a vertex on the current path of a depth first search, I.e. it closes a cycle.
+         * Only called by @ref classified_depth_first_search and @ref classified_depth_first_search_forest.
+         */
+        visitor_result discover_back_edge_base(edge e, graph& g) {
+            return GRAPHLE_VISIT_DERIVED(discover_back_edge, visitor_result::CONTINUE, e, g);
+        }
+
+
+        /**
+         * Called after discover_edge_to_known_vertex if the edge leads to a finished descendant of its source in the depth first search tree.
+         * Only called by @ref classified_depth_first_search and @ref classified_depth_first_search_forest.
+         */
+        visitor_result discover_forward_edge_base(edge e, graph& g) {
+            return GRAPHLE_VISIT_DERIVED(discover_forward_edge, visitor_result::CONTINUE, e, g);
+        }
+
+
+        /**
+         * Called after discover_edge_to_known_vertex if the edge leads to a finished vertex which is not a descendant of its source,
+         * I.e. a vertex in an earlier subtree or an earlier search tree.
+         * Only called by @ref classified_depth_first_search and @ref classified_depth_first_search_forest.
+         */
+        visitor_result discover_cross_edge_base(edge e, graph& g) {
+            return GRAPHLE_VISIT_DERIVED(discover_cross_edge, visitor_result::CONTINUE, e, g);
+        }
     private:
         template <typename F, typename D, typename... Args> requires std::is_invocable_v<F, Args...>
         D call_derived_method(F method, D default_value, Args&&... args) {
@@ -143,10 +319,13 @@ namespace graphle::search {
         typename DiscoverNewEdge  = util::no_op_t,
         typename DiscoverSeenEdge = util::no_op_t,
         typename BeginSearch      = util::no_op_t,
-        typename FinishSearch     = util::no_op_t
+        typename FinishSearch     = util::no_op_t,
+        typename BeginTree        = util::no_op_t,
+        typename FinishTree       = util::no_op_t,
+        typename FinishVertex     = util::no_op_t
     > struct visitor_from_arguments :
         search_visitor<
-            visitor_from_arguments<Graph, DiscoverVertex, DiscoverLeaf, DiscoverBranch, DiscoverNewEdge, DiscoverSeenEdge, BeginSearch, FinishSearch>,
+            visitor_from_arguments<Graph, DiscoverVertex, DiscoverLeaf, DiscoverBranch, DiscoverNewEdge, DiscoverSeenEdge, BeginSearch, FinishSearch, BeginTree, FinishTree, FinishVertex>,
             Graph
         >
     {
@@ -161,6 +340,21 @@ namespace graphle::search {
         DiscoverSeenEdge discover_seen_edge;
         BeginSearch begin_search;
         FinishSearch finish_search;
+        BeginTree begin_tree;
+        FinishTree finish_tree;
+        FinishVertex finish_vertex;
+
+
+        // The edge methods have different names than the search_visitor methods they implement, so forward them if they are provided.
+        template <typename E, typename G> requires (!std::is_same_v<DiscoverNewEdge, util::no_op_t>)
+        constexpr decltype(auto) discover_edge_to_new_vertex(E&& e, G& g) {
+            return discover_new_edge(GRAPHLE_FWD(e), g);
+        }
+
+        template <typename E, typename G> requires (!std::is_same_v<DiscoverSeenEdge, util::no_op_t>)
+        constexpr decltype(auto) discover_edge_to_known_vertex(E&& e, G& g) {
+            return discover_seen_edge(GRAPHLE_FWD(e), g);
+        }
     };
 
 
@@ -170,4 +364,10 @@ namespace graphle::search {
     template <typename T, typename G> concept search_visitor_type = std::is_base_of_v<search_visitor<T, std::remove_cvref_t<G>>, T>;
     /** Equivalent to search_visitor_type but with universal-reference-like behaviour. */
     template <typename T, typename G> concept search_visitor_ref = search_visitor_type<std::remove_cvref_t<T>, G>;
+
+
+    /** Returns true if the given visitor type implements all of the given methods. See @ref search_visitor::implements. */
+    template <typename V> constexpr inline bool visitor_implements(visitor_hook hooks) {
+        return std::remove_cvref_t<V>::implements(hooks);
+    }
 }
\ No newline at end of file
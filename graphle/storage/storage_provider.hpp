@@ -168,6 +168,11 @@ namespace graphle::store {
 
     /** Type trait to check if the type P is a storage provider (See default_storage_provider.hpp) of storage type ST. @ingroup Store */
     template <typename P, storage_type ST, typename... Args> struct is_storage_provider {
+        constexpr static inline bool value = false;
+    };
+
+    /** @copydoc is_storage_provider */
+    template <typename P, storage_type ST, typename... Args> requires std::is_invocable_v<P> struct is_storage_provider<P, ST, Args...> {
         constexpr static inline bool value = is_storage_type_v<
             std::remove_reference_t<std::invoke_result_t<P>>,
             ST,
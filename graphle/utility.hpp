@@ -4,9 +4,20 @@
 
 #pragma once
 
+#include <utility/atomic_bitset.hpp>
+#include <utility/dynamic_bitset.hpp>
 #include <utility/edge_utils.hpp>
+#include <utility/epoch_reclaimer.hpp>
+#include <utility/flat_slot_map.hpp>
 #include <utility/functional.hpp>
+#include <utility/jagged_array.hpp>
+#include <utility/jagged_array_output_iterator.hpp>
+#include <utility/prefetch.hpp>
+#include <utility/property_columns.hpp>
 #include <utility/range_utils.hpp>
 #include <utility/storage_utils.hpp>
+#include <utility/thread_pool.hpp>
 #include <utility/vec_of_vecs_output_iterator.hpp>
+#include <utility/vertex_index.hpp>
 #include <utility/vertex_utils.hpp>
+#include <utility/work_budget.hpp>
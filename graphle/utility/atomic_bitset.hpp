@@ -0,0 +1,71 @@
+#pragma once
+
+#include <common.hpp>
+#include <utility/dynamic_bitset.hpp>
+
+#include <atomic>
+#include <memory>
+
+
+namespace graphle::util {
+    /**
+     * @ingroup Utils
+     * A bitset with a size determined at runtime whose bits can be set by multiple threads at the same time.
+     * All operations use relaxed memory ordering: the bitset only guarantees that exactly one thread succeeds in setting every bit with test_and_set.
+     * Any ordering of other memory operations must be established by the user (e.g. by joining the threads that set the bits).
+     */
+    class atomic_bitset {
+    public:
+        atomic_bitset(void) = default;
+
+        explicit atomic_bitset(std::size_t num_bits) :
+            data(std::make_unique<std::atomic<bit_word>[]>(words_for_bits(num_bits))),
+            num_bits(num_bits)
+        {}
+
+
+        [[nodiscard]] bool test(std::size_t i) const {
+            return (word(i).load(std::memory_order_relaxed) >> (i % bits_per_word)) & 1;
+        }
+
+        void set(std::size_t i) {
+            word(i).fetch_or(mask(i), std::memory_order_relaxed);
+        }
+
+        /**
+         * Sets the given bit and returns whether it was previously unset.
+         * If multiple threads set the same bit at the same time, this returns true for exactly one of them.
+         */
+        bool test_and_set(std::size_t i) {
+            // Most bits are tested after they are set, so avoid the read-modify-write if possible.
+            if (test(i)) return false;
+            return !(word(i).fetch_or(mask(i), std::memory_order_relaxed) & mask(i));
+        }
+
+
+        /** Unsets all bits. Must not be called while other threads are accessing the bitset. */
+        void clear(void) {
+            for (std::size_t i = 0; i < words_for_bits(num_bits); ++i) data[i].store(0, std::memory_order_relaxed);
+        }
+
+        /** Returns a copy of the bitset. Must not be called while other threads are modifying the bitset. */
+        [[nodiscard]] dynamic_bitset to_dynamic_bitset(void) const {
+            dynamic_bitset result { num_bits };
+
+            auto words = result.words();
+            for (std::size_t i = 0; i < words.size(); ++i) words[i] = data[i].load(std::memory_order_relaxed);
+
+            return result;
+        }
+
+
+        [[nodiscard]] std::size_t size(void) const { return num_bits; }
+    private:
+        std::unique_ptr<std::atomic<bit_word>[]> data;
+        std::size_t num_bits = 0;
+
+
+        [[nodiscard]] std::atomic<bit_word>& word(std::size_t i) const { return data[i / bits_per_word]; }
+        [[nodiscard]] static bit_word mask(std::size_t i) { return bit_word { 1 } << (i % bits_per_word); }
+    };
+}
@@ -0,0 +1,207 @@
+#pragma once
+
+#include <common.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <vector>
+
+
+namespace graphle::util {
+    /** The word type used to store bitsets. @ingroup Utils */
+    using bit_word = std::uint64_t;
+
+    /** The number of bits in a @ref bit_word. @ingroup Utils */
+    constexpr inline std::size_t bits_per_word = 64;
+
+    /** Returns the number of words required to store the given number of bits. @ingroup Utils */
+    constexpr inline std::size_t words_for_bits(std::size_t num_bits) {
+        return (num_bits + bits_per_word - 1) / bits_per_word;
+    }
+
+
+    // Word-parallel operations on spans of words.
+    // These are written as plain loops over contiguous memory without early exits so the compiler can vectorize them.
+
+    /** Sets dst to dst | src. Both spans must be of the same size. @ingroup Utils */
+    constexpr inline void words_or(std::span<bit_word> dst, std::span<const bit_word> src) {
+        for (std::size_t i = 0; i < dst.size(); ++i) dst[i] |= src[i];
+    }
+
+    /** Sets dst to dst & src. Both spans must be of the same size. @ingroup Utils */
+    constexpr inline void words_and(std::span<bit_word> dst, std::span<const bit_word> src) {
+        for (std::size_t i = 0; i < dst.size(); ++i) dst[i] &= src[i];
+    }
+
+    /** Sets dst to dst & ~src. Both spans must be of the same size. @ingroup Utils */
+    constexpr inline void words_and_not(std::span<bit_word> dst, std::span<const bit_word> src) {
+        for (std::size_t i = 0; i < dst.size(); ++i) dst[i] &= ~src[i];
+    }
+
+    /** Returns true if any bit in the given span is set. @ingroup Utils */
+    constexpr inline bool words_any(std::span<const bit_word> words) {
+        bit_word result = 0;
+        for (auto word : words) result |= word;
+
+        return result != 0;
+    }
+
+    /** Returns the number of set bits in the given span. @ingroup Utils */
+    constexpr inline std::size_t words_count(std::span<const bit_word> words) {
+        std::size_t result = 0;
+        for (auto word : words) result += std::size_t(std::popcount(word));
+
+        return result;
+    }
+
+
+    /**
+     * @ingroup Utils
+     * Sized forward range over the indices of the set bits in a span of words.
+     */
+    class set_bit_range : public rng::view_interface<set_bit_range> {
+    public:
+        class iterator {
+        public:
+            using value_type        = std::size_t;
+            using difference_type   = std::ptrdiff_t;
+            using iterator_category = std::forward_iterator_tag;
+
+
+            constexpr iterator(void) = default;
+
+            constexpr iterator(std::span<const bit_word> words, std::size_t word_index) : words(words), word_index(word_index) {
+                if (word_index < words.size()) current = words[word_index];
+                skip_empty();
+            }
+
+
+            [[nodiscard]] constexpr std::size_t operator*(void) const {
+                return word_index * bits_per_word + std::size_t(std::countr_zero(current));
+            }
+
+            constexpr iterator& operator++(void) {
+                current &= current - 1;
+                skip_empty();
+                return *this;
+            }
+
+            constexpr iterator operator++(int) {
+                auto copy = *this;
+                ++(*this);
+                return copy;
+            }
+
+            [[nodiscard]] constexpr bool operator==(const iterator& other) const {
+                return word_index == other.word_index && current == other.current;
+            }
+        private:
+            std::span<const bit_word> words;
+            std::size_t word_index = 0;
+            bit_word current = 0;
+
+
+            constexpr void skip_empty(void) {
+                while (current == 0 && word_index < words.size()) {
+                    if (++word_index < words.size()) current = words[word_index];
+                }
+            }
+        };
+
+
+        constexpr set_bit_range(void) = default;
+        constexpr explicit set_bit_range(std::span<const bit_word> words) : words(words) {}
+
+        [[nodiscard]] constexpr iterator begin(void) const { return iterator { words, 0 }; }
+        [[nodiscard]] constexpr iterator end(void) const { return iterator { words, words.size() }; }
+
+        /** @note This is O(N) with N the number of words in the range. */
+        [[nodiscard]] constexpr std::size_t size(void) const { return words_count(words); }
+        [[nodiscard]] constexpr bool empty(void) const { return !words_any(words); }
+    private:
+        std::span<const bit_word> words;
+    };
+
+
+    /**
+     * @ingroup Utils
+     * A bitset with a size determined at runtime. Unlike std::vector<bool>, this provides direct access to the underlying words,
+     * so operations on entire sets can be performed a word at a time.
+     */
+    class dynamic_bitset {
+    public:
+        constexpr dynamic_bitset(void) = default;
+        constexpr explicit dynamic_bitset(std::size_t num_bits) : data(words_for_bits(num_bits), 0), num_bits(num_bits) {}
+
+
+        constexpr void set(std::size_t i)   { data[i / bits_per_word] |=  (bit_word { 1 } << (i % bits_per_word)); }
+        constexpr void reset(std::size_t i) { data[i / bits_per_word] &= ~(bit_word { 1 } << (i % bits_per_word)); }
+
+        [[nodiscard]] constexpr bool test(std::size_t i) const {
+            return (data[i / bits_per_word] >> (i % bits_per_word)) & 1;
+        }
+
+        /** Sets the given bit and returns whether it was previously unset. */
+        constexpr bool test_and_set(std::size_t i) {
+            const bool was_set = test(i);
+            set(i);
+            return !was_set;
+        }
+
+
+        /** Unsets all bits. */
+        constexpr void clear(void) {
+            std::fill(data.begin(), data.end(), 0);
+        }
+
+        /** Sets all bits. */
+        constexpr void set_all(void) {
+            std::fill(data.begin(), data.end(), ~bit_word { 0 });
+
+            // Keep the padding bits of the last word unset, so they do not affect count() and set_bits().
+            if (num_bits % bits_per_word != 0) data.back() &= (bit_word { 1 } << (num_bits % bits_per_word)) - 1;
+        }
+
+        /** Resizes the bitset, unsetting all bits. */
+        constexpr void assign(std::size_t num_bits) {
+            data.assign(words_for_bits(num_bits), 0);
+            this->num_bits = num_bits;
+        }
+
+
+        constexpr dynamic_bitset& operator|=(std::span<const bit_word> other) { words_or(data, other); return *this; }
+        constexpr dynamic_bitset& operator&=(std::span<const bit_word> other) { words_and(data, other); return *this; }
+        constexpr dynamic_bitset& operator|=(const dynamic_bitset& other) { return *this |= other.words(); }
+        constexpr dynamic_bitset& operator&=(const dynamic_bitset& other) { return *this &= other.words(); }
+
+        /** Unsets all bits that are set in other. */
+        constexpr dynamic_bitset& and_not(std::span<const bit_word> other) { words_and_not(data, other); return *this; }
+        /** @copydoc and_not */
+        constexpr dynamic_bitset& and_not(const dynamic_bitset& other) { return and_not(other.words()); }
+
+
+        [[nodiscard]] constexpr bool any(void) const { return words_any(data); }
+        [[nodiscard]] constexpr bool none(void) const { return !any(); }
+        [[nodiscard]] constexpr std::size_t count(void) const { return words_count(data); }
+        [[nodiscard]] constexpr std::size_t size(void) const { return num_bits; }
+
+        /** Returns a range of the indices of all set bits in ascending order. */
+        [[nodiscard]] constexpr set_bit_range set_bits(void) const { return set_bit_range { data }; }
+
+        [[nodiscard]] constexpr std::span<bit_word> words(void) { return data; }
+        [[nodiscard]] constexpr std::span<const bit_word> words(void) const { return data; }
+
+        [[nodiscard]] constexpr bool operator==(const dynamic_bitset& other) const = default;
+    private:
+        std::vector<bit_word> data;
+        std::size_t num_bits = 0;
+    };
+}
+
+
+/** The set_bit_range does not own its words, so its iterators remain valid after it is destroyed. */
+template <> constexpr inline bool std::ranges::enable_borrowed_range<graphle::util::set_bit_range> = true;
@@ -4,8 +4,23 @@
 #include <graph/graph.hpp>
 #include <meta/concepts.hpp>
 #include <utility/functional.hpp>
+#include <views/edge_from_vertex.hpp>
 
 #include <algorithm>
+#include <span>
+#include <type_traits>
+
+
+namespace graphle {
+    /**
+     * @ingroup Graph
+     * Checks whether the out edges of a vertex are a @ref views::edge_from view of a contiguous range of vertices
+     * (e.g. std::vector<Vertex*> | views::edge_from(vertex)), so that @ref util::out_neighbors can return the neighbours of a vertex as a std::span.
+     */
+    template <typename G> concept contiguous_out_neighbors_graph = out_edges_graph<G> && detail::is_contiguous_edge_from_view<
+        std::remove_cvref_t<decltype(std::declval<G&>().get_out_edges(std::declval<vertex_of<G>>()))>
+    >;
+}
 
 
 namespace graphle::util {
@@ -90,6 +105,79 @@ namespace graphle::util {
     }
 
 
+    /**
+     * @ingroup Utils
+     * Returns a range of the vertices that the out edges of the given vertex go to.
+     * For a @ref contiguous_out_neighbors_graph, this is a std::span of the graph's own storage,
+     * so algorithms can iterate over the neighbours of a vertex without constructing an edge for every one of them.
+     *
+     * @graph_requires{
+     *  edge_list_graph<G> ||
+     *  out_edges_graph<G> ||
+     *  (non_directed_graph<G> && in_edges_graph<G>)
+     * }
+     */
+    template <graph_ref G> requires (
+        edge_list_graph<G> ||
+        out_edges_graph<G> ||
+        (non_directed_graph<G> && in_edges_graph<G>)
+    ) constexpr inline auto out_neighbors(G&& graph, vertex_of<G> vertex) {
+        if constexpr (contiguous_out_neighbors_graph<G>) {
+            // The viewed range is borrowed, so the span outlives the view it is taken from.
+            const auto edges = graph.get_out_edges(vertex);
+            return std::span { rng::data(edges.base()), rng::size(edges.base()) };
+        }
+
+        else {
+            return out_edges(graph, vertex) | views::transform(util::edge_target);
+        }
+    }
+
+
+    /**
+     * @ingroup Utils
+     * Invokes the given function for every out edge of the given vertex, i.e. for every edge as returned by @ref out_edges.
+     * For a @ref contiguous_out_neighbors_graph, the neighbours are iterated as returned by @ref out_neighbors,
+     * and every edge is constructed from the vertex and the neighbour just before it is passed to the function.
+     *
+     * If the function returns a bool, iteration stops as soon as it returns false.
+     * @return False if the function stopped the iteration, or true otherwise.
+     *
+     * @graph_requires{
+     *  edge_list_graph<G> ||
+     *  out_edges_graph<G> ||
+     *  (non_directed_graph<G> && in_edges_graph<G>)
+     * }
+     */
+    template <graph_ref G, typename F> requires (
+        edge_list_graph<G> ||
+        out_edges_graph<G> ||
+        (non_directed_graph<G> && in_edges_graph<G>)
+    ) constexpr inline bool for_each_out_edge(G&& graph, vertex_of<G> vertex, F&& function) {
+        auto invoke = [&] (const auto& edge) -> bool {
+            if constexpr (std::is_void_v<decltype(function(edge))>) {
+                function(edge);
+                return true;
+            } else {
+                return bool(function(edge));
+            }
+        };
+
+
+        if constexpr (contiguous_out_neighbors_graph<G>) {
+            for (auto target : out_neighbors(graph, vertex)) {
+                if (!invoke(edge_of<G> { vertex, target })) return false;
+            }
+        } else {
+            for (const auto& edge : out_edges(graph, vertex)) {
+                if (!invoke(edge)) return false;
+            }
+        }
+
+        return true;
+    }
+
+
     /**
      * @ingroup Utils
      * Returns the in-degree of the given vertex (i.e. the number of edges going into the vertex).
@@ -142,7 +230,11 @@ namespace graphle::util {
         using GL   = std::remove_cvref_t<G>;
         using edge = edge_of<G>;
 
-        if constexpr (GL::has_out_edges) {
+        if constexpr (contiguous_out_neighbors_graph<G>) {
+            return out_neighbors(graph, vertex).size();
+        }
+
+        else if constexpr (GL::has_out_edges) {
             return rng::size(graph.get_out_edges(vertex));
         }
 
@@ -205,4 +297,32 @@ namespace graphle::util {
     constexpr inline bool is_leaf(G&& graph, vertex_of<G> vertex) {
         return out_degree(graph, vertex) == 0;
     }
-}
\ No newline at end of file
+
+
+    /**
+     * @ingroup Utils
+     * Invokes the given function for the out edges of every vertex of the given graph, i.e. for every edge as returned by @ref out_edges.
+     * If the graph only has an edge list, the edge list is traversed once rather than once for every vertex.
+     *
+     * @graph_requires{
+     *  vertex_list_graph<G> &&
+     *  (
+     *      edge_list_graph<G> ||
+     *      out_edges_graph<G> ||
+     *      (non_directed_graph<G> && in_edges_graph<G>)
+     *  )
+     * }
+     */
+    template <graph_ref G, typename F> requires (
+        vertex_list_graph<G> &&
+        (edge_list_graph<G> || out_edges_graph<G> || (non_directed_graph<G> && in_edges_graph<G>))
+    ) constexpr inline void for_each_edge(G&& graph, F&& function) {
+        if constexpr (graph_has_out_edges<G> || (!graph_is_directed<G> && graph_has_in_edges<G>)) {
+            for (auto vertex : graph.get_vertices()) {
+                for (const auto& edge : out_edges(graph, vertex)) function(edge);
+            }
+        } else {
+            for (const auto& edge : graph.get_edges()) function(edge);
+        }
+    }
+}
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <common.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+
+namespace graphle::util {
+    /**
+     * @ingroup Utils
+     * Epoch-based reclamation for objects which are replaced by a single writer while any number of readers may still be using them.
+     *
+     * Readers pin the reclaimer before loading a shared pointer and unpin it once they are done with the object it points to.
+     * The writer retires objects after unlinking them, and they are only destroyed once every reader that could still have observed them has unpinned.
+     * Pinning and unpinning are lock-free as long as there is a free reader slot (readers spin if all slots are taken).
+     *
+     * @note retire and collect must only be called from the writer thread. pin may be called from any thread.
+     */
+    class epoch_reclaimer {
+    private:
+        // Separate cache lines per slot, so readers pinning on different threads do not contend with each other.
+        struct alignas(64) reader_slot {
+            std::atomic<std::uint64_t> epoch  = 0;
+            std::atomic<bool>          in_use = false;
+        };
+
+    public:
+        /** RAII handle for a pinned reader slot. The slot is unpinned when the guard is destroyed. */
+        class guard {
+        public:
+            constexpr guard(void) = default;
+
+            guard(guard&& other) noexcept : slot(std::exchange(other.slot, nullptr)) {}
+            guard& operator=(guard&& other) noexcept { reset(); slot = std::exchange(other.slot, nullptr); return *this; }
+
+            guard(const guard&) = delete;
+            guard& operator=(const guard&) = delete;
+
+            ~guard(void) { reset(); }
+
+
+            /** Unpins the slot held by this guard, if any. */
+            void reset(void) {
+                if (slot) {
+                    slot->epoch.store(0, std::memory_order_release);
+                    slot->in_use.store(false, std::memory_order_release);
+                    slot = nullptr;
+                }
+            }
+
+
+            [[nodiscard]] explicit operator bool(void) const { return slot != nullptr; }
+        private:
+            friend class epoch_reclaimer;
+            explicit guard(reader_slot* slot) : slot(slot) {}
+
+            reader_slot* slot = nullptr;
+        };
+
+
+        /** @param max_readers The maximum number of readers that can be pinned at the same time before pin starts spinning. */
+        explicit epoch_reclaimer(std::size_t max_readers = 64) :
+            slots(std::make_unique<reader_slot[]>(max_readers)),
+            num_slots(max_readers)
+        {}
+
+        epoch_reclaimer(const epoch_reclaimer&) = delete;
+        epoch_reclaimer& operator=(const epoch_reclaimer&) = delete;
+
+        /** Destroys all retired objects. No readers may be pinned when the reclaimer is destroyed. */
+        ~epoch_reclaimer(void) {
+            for (auto& [epoch, deleter] : retired) deleter();
+        }
+
+
+        /**
+         * Pins the current epoch. Any object retired after this call will remain alive until the returned guard is destroyed.
+         * The shared pointer to the protected object should be loaded after calling this method.
+         */
+        [[nodiscard]] guard pin(void) {
+            reader_slot& slot = acquire_slot();
+            slot.epoch.store(global_epoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+
+            return guard { std::addressof(slot) };
+        }
+
+
+        /**
+         * Retires an object that has already been unlinked by the writer. The provided deleter is invoked once no reader can observe the object anymore.
+         * @param deleter A function object destroying the retired object. Invoked on the writer thread during a later call to collect.
+         */
+        void retire(std::function<void(void)> deleter) {
+            retired.emplace_back(global_epoch.fetch_add(1, std::memory_order_seq_cst), std::move(deleter));
+        }
+
+
+        /**
+         * Destroys all retired objects that can no longer be observed by any pinned reader.
+         * @return The number of objects that were destroyed.
+         */
+        std::size_t collect(void) {
+            std::uint64_t min_epoch = std::numeric_limits<std::uint64_t>::max();
+
+            for (std::size_t i = 0; i < num_slots; ++i) {
+                // A slot with epoch 0 is either unused or has not yet published its epoch, in which case it will observe the newest object.
+                if (auto epoch = slots[i].epoch.load(std::memory_order_seq_cst); epoch != 0) {
+                    min_epoch = std::min(min_epoch, epoch);
+                }
+            }
+
+
+            // Objects are retired in epoch order, so everything reclaimable is at the front of the list.
+            std::size_t count = 0;
+            while (count < retired.size() && retired[count].first < min_epoch) {
+                retired[count].second();
+                ++count;
+            }
+
+            retired.erase(retired.begin(), retired.begin() + std::ptrdiff_t(count));
+            return count;
+        }
+
+
+        /** Returns the number of objects that have been retired but not yet destroyed. */
+        [[nodiscard]] std::size_t num_retired(void) const {
+            return retired.size();
+        }
+    private:
+        std::atomic<std::uint64_t> global_epoch = 1;
+        std::unique_ptr<reader_slot[]> slots;
+        std::size_t num_slots;
+
+        // Only accessed by the writer thread.
+        std::vector<std::pair<std::uint64_t, std::function<void(void)>>> retired;
+
+
+        reader_slot& acquire_slot(void) {
+            // Start probing at a thread-dependent position so concurrent readers are unlikely to contend for the same slot.
+            const std::size_t start = std::hash<std::thread::id>{}(std::this_thread::get_id()) % num_slots;
+
+            while (true) {
+                for (std::size_t i = 0; i < num_slots; ++i) {
+                    auto& slot    = slots[(start + i) % num_slots];
+                    bool expected = false;
+
+                    if (slot.in_use.compare_exchange_strong(expected, true, std::memory_order_acquire)) return slot;
+                }
+
+                std::this_thread::yield();
+            }
+        }
+    };
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <common.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
+
+namespace graphle::util {
+    /**
+     * @ingroup Utils
+     * Open-addressing hash table that assigns every inserted key a slot, numbered consecutively from 0 in order of insertion.
+     * Keys are never removed, so the slots can be used to index flat arrays of data for each key.
+     *
+     * The table itself only stores slot numbers and is probed linearly, so unlike a node-based map like std::unordered_map,
+     * a lookup touches a single contiguous region of memory plus the key it finds.
+     *
+     * @tparam Key The type of the keys.
+     * @tparam Hash A hasher for keys.
+     * @tparam Eq An equality comparator for keys.
+     */
+    template <typename Key, typename Hash = std::hash<Key>, typename Eq = std::equal_to<Key>> class flat_slot_map {
+    public:
+        /** Returned by @ref find for keys that are not in the map. */
+        constexpr static inline std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+
+        constexpr flat_slot_map(void) = default;
+        constexpr explicit flat_slot_map(Hash hash, Eq eq = Eq {}) : hash(std::move(hash)), eq(std::move(eq)) {}
+
+
+        /** Returns the slot of the given key, or npos if the key is not in the map. */
+        [[nodiscard]] constexpr std::size_t find(const Key& key) const {
+            if (table.empty()) return npos;
+
+            for (std::size_t i = bucket_of(key);; i = (i + 1) & (table.size() - 1)) {
+                if (table[i] == empty) return npos;
+                if (eq(keys[table[i]], key)) return table[i];
+            }
+        }
+
+
+        /**
+         * Inserts the given key if it is not in the map yet.
+         * @return A pair of the slot of the key and a boolean that is true if the key was inserted.
+         */
+        constexpr std::pair<std::size_t, bool> insert(const Key& key) {
+            // Keep the load factor at or below 1/2.
+            if (2 * (keys.size() + 1) > table.size()) rehash(std::max<std::size_t>(16, 2 * table.size()));
+
+            for (std::size_t i = bucket_of(key);; i = (i + 1) & (table.size() - 1)) {
+                if (table[i] == empty) {
+                    table[i] = keys.size();
+                    keys.push_back(key);
+
+                    return { table[i], true };
+                }
+
+                if (eq(keys[table[i]], key)) return { table[i], false };
+            }
+        }
+
+
+        /** Makes sure the given number of keys can be inserted without rehashing. */
+        constexpr void reserve(std::size_t count) {
+            if (2 * count > table.size()) rehash(std::bit_ceil(2 * count));
+            keys.reserve(count);
+        }
+
+        /** Removes all keys from the map. */
+        constexpr void clear(void) {
+            std::fill(table.begin(), table.end(), empty);
+            keys.clear();
+        }
+
+
+        [[nodiscard]] constexpr bool contains(const Key& key) const { return find(key) != npos; }
+        [[nodiscard]] constexpr const Key& key_at(std::size_t slot) const { return keys[slot]; }
+        [[nodiscard]] constexpr std::size_t size(void) const { return keys.size(); }
+        [[nodiscard]] constexpr const std::vector<Key>& get_keys(void) const { return keys; }
+    private:
+        constexpr static inline std::size_t empty = npos;
+
+        // Maps buckets to slots. Size is always zero or a power of two.
+        std::vector<std::size_t> table;
+        // Maps slots to keys.
+        std::vector<Key> keys;
+
+        [[no_unique_address]] Hash hash;
+        [[no_unique_address]] Eq eq;
+
+
+        constexpr std::size_t bucket_of(const Key& key) const {
+            // Fibonacci hashing: spread the bits of the hash across the table, since e.g. pointer hashes have their low bits set to zero.
+            const auto mixed = std::uint64_t(hash(key)) * 0x9E3779B97F4A7C15ull;
+            return std::size_t(mixed >> (64 - std::countr_zero(table.size())));
+        }
+
+
+        constexpr void rehash(std::size_t new_size) {
+            table.assign(new_size, empty);
+
+            for (std::size_t slot = 0; slot < keys.size(); ++slot) {
+                std::size_t i = bucket_of(keys[slot]);
+                while (table[i] != empty) i = (i + 1) & (table.size() - 1);
+
+                table[i] = slot;
+            }
+        }
+    };
+}
@@ -86,6 +86,12 @@ namespace graphle::util {
      */
     GRAPHLE_MAKE_NIEBLOID_IMPL(transpose_edge, [] (auto edge) { std::swap(edge.first, edge.second); return edge; });
 
+    /**
+     * @ingroup Utils
+     * A function object that returns the vertex an edge [A, B] goes to (B).
+     */
+    GRAPHLE_MAKE_NIEBLOID_IMPL(edge_target, [] (const auto& edge) { return edge.second; });
+
 
     /**
      * @ingroup Utils
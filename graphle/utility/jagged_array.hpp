@@ -0,0 +1,169 @@
+#pragma once
+
+#include <common.hpp>
+
+#include <compare>
+#include <iterator>
+#include <span>
+#include <vector>
+
+
+namespace graphle::util {
+    /**
+     * @ingroup Utils
+     * A sequence of variable-length groups of values (e.g. the vertices of every strongly connected component of a graph),
+     * stored as a single contiguous array of values and an array of offsets: group i consists of the values in [offsets[i], offsets[i + 1]).
+     * Compared to a vector of vectors, this requires two allocations in total rather than one per group,
+     * and the values of consecutive groups are adjacent in memory.
+     *
+     * Iterating the array yields a std::span for every group.
+     *
+     * @tparam T The type of the values in the array.
+     * @tparam Data A contiguous vector-like type of T used to store the values.
+     * @tparam Offsets A random-access vector-like type of std::size_t used to store the offsets.
+     */
+    template <typename T, typename Data = std::vector<T>, typename Offsets = std::vector<std::size_t>>
+    requires (rng::contiguous_range<Data> && rng::random_access_range<Offsets>)
+    class jagged_array {
+    public:
+        using value_type = std::span<const T>;
+
+
+        /** Random-access iterator over the groups of the array. */
+        class iterator {
+        public:
+            using value_type        = std::span<const T>;
+            using difference_type   = std::ptrdiff_t;
+            using iterator_category = std::random_access_iterator_tag;
+
+
+            constexpr iterator(void) = default;
+            constexpr iterator(const jagged_array* parent, std::size_t group) : parent(parent), group(group) {}
+
+
+            [[nodiscard]] constexpr value_type operator*(void) const { return (*parent)[group]; }
+            [[nodiscard]] constexpr value_type operator[](difference_type n) const { return (*parent)[std::size_t(difference_type(group) + n)]; }
+
+            constexpr iterator& operator++(void) { ++group; return *this; }
+            constexpr iterator& operator--(void) { --group; return *this; }
+            constexpr iterator operator++(int) { auto old = *this; ++group; return old; }
+            constexpr iterator operator--(int) { auto old = *this; --group; return old; }
+
+            constexpr iterator& operator+=(difference_type n) { group = std::size_t(difference_type(group) + n); return *this; }
+            constexpr iterator& operator-=(difference_type n) { group = std::size_t(difference_type(group) - n); return *this; }
+
+            [[nodiscard]] constexpr friend iterator operator+(iterator it, difference_type n) { return it += n; }
+            [[nodiscard]] constexpr friend iterator operator+(difference_type n, iterator it) { return it += n; }
+            [[nodiscard]] constexpr friend iterator operator-(iterator it, difference_type n) { return it -= n; }
+
+            [[nodiscard]] constexpr friend difference_type operator-(const iterator& a, const iterator& b) {
+                return difference_type(a.group) - difference_type(b.group);
+            }
+
+            [[nodiscard]] constexpr bool operator==(const iterator& other) const { return group == other.group; }
+            [[nodiscard]] constexpr auto operator<=>(const iterator& other) const { return group <=> other.group; }
+        private:
+            const jagged_array* parent = nullptr;
+            std::size_t group = 0;
+        };
+
+
+        /** Output iterator which appends every value written to it to the last group of the array. */
+        class last_group_inserter {
+        public:
+            using difference_type = std::ptrdiff_t;
+
+
+            constexpr explicit last_group_inserter(jagged_array& target) : target(std::addressof(target)) {}
+
+
+            constexpr last_group_inserter& operator=(const T& value) {
+                target->push_to_last(value);
+                return *this;
+            }
+
+            constexpr last_group_inserter& operator*(void) { return *this; }
+            constexpr last_group_inserter& operator++(void) { return *this; }
+            constexpr last_group_inserter& operator++(int) { return *this; }
+        private:
+            jagged_array* target;
+        };
+
+
+        constexpr jagged_array(void) : jagged_array(Data {}, Offsets {}) {}
+
+        /** Constructs an empty array using the given storage. Any existing contents of the storage are discarded. */
+        constexpr jagged_array(Data data, Offsets offsets) : data(std::move(data)), offsets(std::move(offsets)) {
+            clear();
+        }
+
+
+        /** Appends a new, empty group to the array. */
+        constexpr void add_group(void) {
+            offsets.push_back(offsets.back());
+        }
+
+        /** Appends a value to the last group of the array. The array must contain at least one group. */
+        constexpr void push_to_last(const T& value) {
+            data.push_back(value);
+            ++offsets.back();
+        }
+
+        /** Appends a new group containing the values in the given range. */
+        template <rng::input_range R> requires std::convertible_to<rng::range_reference_t<R>, const T&>
+        constexpr void push_group(R&& values) {
+            add_group();
+            for (const T& value : values) push_to_last(value);
+        }
+
+
+        /** Removes all groups from the array. */
+        constexpr void clear(void) {
+            data.clear();
+            offsets.clear();
+            offsets.push_back(0);
+        }
+
+        /** Reserves storage for the given number of groups and total number of values, if the storage types support it. */
+        constexpr void reserve(std::size_t num_groups, std::size_t num_values) {
+            if constexpr (requires { offsets.reserve(num_groups); }) offsets.reserve(num_groups + 1);
+            if constexpr (requires { data.reserve(num_values); }) data.reserve(num_values);
+        }
+
+
+        [[nodiscard]] constexpr std::span<const T> operator[](std::size_t group) const {
+            return values().subspan(offsets[group], offsets[group + 1] - offsets[group]);
+        }
+
+        [[nodiscard]] constexpr std::span<T> operator[](std::size_t group) {
+            return values().subspan(offsets[group], offsets[group + 1] - offsets[group]);
+        }
+
+
+        [[nodiscard]] constexpr iterator begin(void) const { return iterator { this, 0 }; }
+        [[nodiscard]] constexpr iterator end(void) const { return iterator { this, size() }; }
+
+        /** Returns the number of groups in the array. */
+        [[nodiscard]] constexpr std::size_t size(void) const { return std::size_t(rng::size(offsets)) - 1; }
+        [[nodiscard]] constexpr bool empty(void) const { return size() == 0; }
+
+        /** Returns the number of values in all groups combined. */
+        [[nodiscard]] constexpr std::size_t num_values(void) const { return std::size_t(rng::size(data)); }
+
+
+        /** Returns the values of all groups, in order of their groups. */
+        [[nodiscard]] constexpr std::span<const T> values(void) const { return { rng::data(data), num_values() }; }
+        /** @copydoc values */
+        [[nodiscard]] constexpr std::span<T> values(void) { return { rng::data(data), num_values() }; }
+
+        /** Returns the offsets of the groups into @ref values. This contains one more element than there are groups. */
+        [[nodiscard]] constexpr const Offsets& get_offsets(void) const { return offsets; }
+    private:
+        Data data;
+        Offsets offsets;
+    };
+
+
+    template <typename Data, typename Offsets>
+    jagged_array(Data, Offsets) -> jagged_array<rng::range_value_t<Data>, Data, Offsets>;
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <common.hpp>
+#include <utility/jagged_array.hpp>
+
+#include <iterator>
+
+
+namespace graphle::util {
+    /**
+     * @ingroup Utils
+     * An output iterator for writing groups of values to a @ref jagged_array.
+     * Incrementing the iterator appends a new group, and dereferencing it returns an output iterator which appends to the last group.
+     * This is the flat equivalent of @ref vec_of_vecs_output_iterator.
+     */
+    template <typename JA> class jagged_array_output_iterator {
+    public:
+        using value_type        = typename JA::last_group_inserter;
+        using reference         = value_type;
+        using difference_type   = std::ptrdiff_t;
+        using iterator_category = std::output_iterator_tag;
+
+
+        constexpr explicit jagged_array_output_iterator(JA& target) : target(std::addressof(target)) {}
+
+
+        constexpr value_type operator*(void) const {
+            return value_type { *target };
+        }
+
+
+        constexpr jagged_array_output_iterator& operator++(void) {
+            target->add_group();
+            return *this;
+        }
+
+
+        constexpr jagged_array_output_iterator operator++(int) {
+            auto old = *this;
+            target->add_group();
+            return old;
+        }
+    private:
+        JA* target;
+    };
+}
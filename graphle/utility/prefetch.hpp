@@ -0,0 +1,47 @@
+#pragma once
+
+#include <common.hpp>
+
+#include <cstddef>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <xmmintrin.h>
+#endif
+
+
+/**
+ * @ingroup Config
+ * @def GRAPHLE_PREFETCH_DISTANCE
+ * The default number of elements search algorithms look ahead when prefetching the adjacency of upcoming vertices (See @ref util::prefetch).
+ * Defaults to 0, which disables prefetching and removes it from the search loops entirely.
+ * On random graphs of up to 2^20 vertices (See benchmark_prefetch), enabling it made no difference beyond run-to-run noise for large graphs
+ * and slowed down searches of graphs that fit in the cache, so only enable it after measuring a gain for the graphs at hand.
+ */
+#ifndef GRAPHLE_PREFETCH_DISTANCE
+    #define GRAPHLE_PREFETCH_DISTANCE 0
+#endif
+
+
+namespace graphle::util {
+    /**
+     * @ingroup Utils
+     * The default prefetch distance of search algorithms. See @ref GRAPHLE_PREFETCH_DISTANCE.
+     */
+    constexpr inline std::size_t default_prefetch_distance = GRAPHLE_PREFETCH_DISTANCE;
+
+
+    /**
+     * @ingroup Utils
+     * Hints the processor to load the cache line containing the given address, so a later access to it does not have to wait for memory.
+     * The address does not have to be valid. Does nothing on compilers without a prefetch intrinsic.
+     */
+    inline void prefetch(const void* address) {
+        #if defined(__GNUC__) || defined(__clang__)
+            __builtin_prefetch(address);
+        #elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+            _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+        #else
+            (void) address;
+        #endif
+    }
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <common.hpp>
+
+#include <algorithm>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace graphle::util {
+    /**
+     * @ingroup Utils
+     * A set of properties stored in a structure-of-arrays layout: each property is stored in its own contiguous column,
+     * and the properties of a single element are found at the same index (its slot) in every column.
+     * New slots are initialized with a default value for every property.
+     *
+     * This is the shared storage of @ref vertex_property_map and @ref edge_property_map, which map vertices and edges to slots.
+     *
+     * @tparam Ts The types of the properties. bool is not supported since std::vector<bool> is not contiguous (use e.g. std::uint8_t instead).
+     */
+    template <typename... Ts> requires (sizeof...(Ts) > 0 && (!std::is_same_v<Ts, bool> && ...))
+    class property_columns {
+    public:
+        template <std::size_t I> using property_type = std::tuple_element_t<I, std::tuple<Ts...>>;
+
+
+        constexpr explicit property_columns(Ts... defaults) : defaults(std::move(defaults)...) {}
+
+
+        /** Returns a reference to property I of the given slot. The slot must exist. */
+        template <std::size_t I = 0> [[nodiscard]] constexpr property_type<I>& at(std::size_t slot) {
+            return std::get<I>(columns)[slot];
+        }
+
+        /** Returns the value of property I of the given slot, or its default value if the slot does not exist. */
+        template <std::size_t I = 0> [[nodiscard]] constexpr property_type<I> value(std::size_t slot) const {
+            return slot < num_slots() ? std::get<I>(columns)[slot] : std::get<I>(defaults);
+        }
+
+        /** Returns the default value of property I. */
+        template <std::size_t I = 0> [[nodiscard]] constexpr const property_type<I>& default_value(void) const {
+            return std::get<I>(defaults);
+        }
+
+
+        /** Returns the column for property I, indexed by slot. */
+        template <std::size_t I = 0> [[nodiscard]] constexpr std::span<property_type<I>> column(void) {
+            return std::get<I>(columns);
+        }
+
+        /** @copydoc column */
+        template <std::size_t I = 0> [[nodiscard]] constexpr std::span<const property_type<I>> column(void) const {
+            return std::get<I>(columns);
+        }
+
+
+        /** Changes the number of slots. New slots have the default value for every property. */
+        constexpr void resize(std::size_t count) {
+            [&] <std::size_t... Is> (std::index_sequence<Is...>) {
+                (std::get<Is>(columns).resize(count, std::get<Is>(defaults)), ...);
+            } (std::index_sequence_for<Ts...> {});
+        }
+
+        /** Makes sure the given number of slots can be used without reallocating the columns. */
+        constexpr void reserve(std::size_t count) {
+            std::apply([&] (auto&... column) { (column.reserve(count), ...); }, columns);
+        }
+
+        /** Resets every property of every slot to its default value, without releasing any storage. */
+        constexpr void reset(void) {
+            [&] <std::size_t... Is> (std::index_sequence<Is...>) {
+                (std::ranges::fill(std::get<Is>(columns), std::get<Is>(defaults)), ...);
+            } (std::index_sequence_for<Ts...> {});
+        }
+
+
+        [[nodiscard]] constexpr std::size_t num_slots(void) const { return std::get<0>(columns).size(); }
+    private:
+        std::tuple<Ts...> defaults;
+        std::tuple<std::vector<Ts>...> columns;
+    };
+}
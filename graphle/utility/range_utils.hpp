@@ -145,12 +145,12 @@ namespace graphle::detail {
 
         Derived& operator++(void) requires is_forward       { derived().next(); return derived(); }
         Derived& operator--(void) requires is_bidirectional { derived().prev(); return derived(); }
-        Derived  operator++(int)  requires is_forward       { auto old = derived(); derived().next(); return old(); }
-        Derived  operator--(int)  requires is_bidirectional { auto old = derived(); derived().prev(); return old(); }
+        Derived  operator++(int)  requires is_forward       { auto old = derived(); derived().next(); return old; }
+        Derived  operator--(int)  requires is_bidirectional { auto old = derived(); derived().prev(); return old; }
 
 
-        friend Derived& operator+=(Derived& self, difference_type d) requires is_random_access { self.advance(+d); return self(); }
-        friend Derived& operator-=(Derived& self, difference_type d) requires is_random_access { self.advance(-d); return self(); }
+        friend Derived& operator+=(Derived& self, difference_type d) requires is_random_access { self.advance(+d); return self; }
+        friend Derived& operator-=(Derived& self, difference_type d) requires is_random_access { self.advance(-d); return self; }
         [[nodiscard]] friend Derived operator+(const Derived& self, difference_type d) requires is_random_access { auto temp = self; temp.advance(+d); return temp; }
         [[nodiscard]] friend Derived operator-(const Derived& self, difference_type d) requires is_random_access { auto temp = self; temp.advance(-d); return temp; }
     private:
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <common.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+
+namespace graphle::util {
+    /**
+     * @ingroup Utils
+     * Fixed-size pool of threads for fork-join parallelism, as used by the parallel graph algorithms.
+     * A call to @ref run splits a job into a number of tasks, which are taken by the threads of the pool and the calling thread
+     * from a shared counter until none remain, so threads which finish their tasks early take over remaining tasks.
+     * run returns once all tasks have finished, which also makes all writes performed by the tasks visible to the caller.
+     *
+     * @note run must only be called by one thread at a time, and must not be called from within a task.
+     */
+    class thread_pool {
+    public:
+        /**
+         * @param num_workers The number of threads running tasks, including the thread calling @ref run.
+         *  The pool creates num_workers - 1 threads. Defaults to the number of hardware threads.
+         */
+        explicit thread_pool(std::size_t num_workers = std::max(std::thread::hardware_concurrency(), 1u)) {
+            for (std::size_t i = 1; i < std::max(num_workers, std::size_t { 1 }); ++i) {
+                threads.emplace_back([this, i] { work(i); });
+            }
+        }
+
+        thread_pool(const thread_pool&) = delete;
+        thread_pool& operator=(const thread_pool&) = delete;
+
+        ~thread_pool(void) {
+            {
+                std::lock_guard lock { mutex };
+                stopping = true;
+            }
+
+            wake.notify_all();
+            for (auto& thread : threads) thread.join();
+        }
+
+
+        /**
+         * Invokes task(i, worker) for every i in [0, num_tasks) and waits for all invocations to finish.
+         * worker is the index of the thread running the task in [0, @ref size()), where 0 is the calling thread.
+         * Tasks running on the same worker never run concurrently, so worker can be used to index per-thread storage.
+         */
+        template <typename F> void run(std::size_t num_tasks, F&& task) {
+            if (threads.empty() || num_tasks <= 1) {
+                for (std::size_t i = 0; i < num_tasks; ++i) task(i, std::size_t { 0 });
+                return;
+            }
+
+
+            {
+                std::lock_guard lock { mutex };
+
+                job        = const_cast<void*>(static_cast<const void*>(std::addressof(task)));
+                invoke_job = [] (void* job, std::size_t i, std::size_t worker) { (*static_cast<std::remove_reference_t<F>*>(job))(i, worker); };
+                job_size   = num_tasks;
+                next_task.store(0, std::memory_order_relaxed);
+
+                busy_threads = threads.size();
+                ++generation;
+            }
+
+            wake.notify_all();
+            run_tasks(0);
+
+
+            std::unique_lock lock { mutex };
+            done.wait(lock, [&] { return busy_threads == 0; });
+        }
+
+
+        /** Returns the number of threads running tasks, including the thread calling @ref run. */
+        [[nodiscard]] std::size_t size(void) const {
+            return threads.size() + 1;
+        }
+    private:
+        std::vector<std::thread> threads;
+
+        std::mutex mutex;
+        std::condition_variable wake, done;
+        std::uint64_t generation   = 0;
+        std::size_t   busy_threads = 0;
+        bool          stopping     = false;
+
+        // The current job. These are only written while no thread is running tasks.
+        void* job = nullptr;
+        void (*invoke_job)(void*, std::size_t, std::size_t) = nullptr;
+        std::size_t job_size = 0;
+        std::atomic<std::size_t> next_task = 0;
+
+
+        void run_tasks(std::size_t worker) {
+            for (std::size_t i = next_task.fetch_add(1, std::memory_order_relaxed); i < job_size; i = next_task.fetch_add(1, std::memory_order_relaxed)) {
+                invoke_job(job, i, worker);
+            }
+        }
+
+
+        void work(std::size_t worker) {
+            std::uint64_t seen_generation = 0;
+
+            while (true) {
+                {
+                    std::unique_lock lock { mutex };
+                    wake.wait(lock, [&] { return stopping || generation != seen_generation; });
+
+                    if (stopping) return;
+                    seen_generation = generation;
+                }
+
+                run_tasks(worker);
+
+                {
+                    std::lock_guard lock { mutex };
+                    if (--busy_threads == 0) done.notify_one();
+                }
+            }
+        }
+    };
+}
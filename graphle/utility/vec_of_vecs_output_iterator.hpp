@@ -10,15 +10,16 @@
 
 namespace graphle::util {
     /**
-     * @ingruop Utils
+     * @ingroup Utils
      * An output iterator for writing to a vector-like (back-insertable) type of vector-like (back-insertable) values.
+     * Incrementing the iterator appends a new inner vector, and dereferencing it returns a back-inserter for the last inner vector.
      */
     template <
         typename VV,
-        store::storage_provider_ref<store::storage_type::VECTOR, typename VV::value_type> PV
+        store::storage_provider_ref<store::storage_type::VECTOR, typename VV::value_type::value_type> PV
     > class vec_of_vecs_output_iterator {
         public:
-            using value_type        = typename std::back_insert_iterator<VV>;
+            using value_type        = std::back_insert_iterator<typename VV::value_type>;
             using reference         = value_type&;
             using pointer           = value_type*;
             using difference_type   = std::ptrdiff_t;
@@ -0,0 +1,197 @@
+#pragma once
+
+#include <common.hpp>
+#include <graph/graph.hpp>
+#include <storage/storage_provider.hpp>
+#include <storage/default_storage_provider.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+#include <limits>
+
+
+namespace graphle::util {
+    /**
+     * @ingroup Utils
+     * Bijective mapping between the vertices of a graph and the integers [0, N), where N is the number of vertices in the graph.
+     * Indices are assigned in the order in which the vertices are returned by graph.get_vertices().
+     * This allows algorithms to store per-vertex data in flat arrays instead of in hash maps.
+     *
+     * @tparam Vertex The vertex type of the graph.
+     * @tparam Map An unordered-map-like type mapping vertices to indices.
+     */
+    template <typename Vertex, typename Map> class vertex_index {
+    public:
+        /** Returned by @ref find for vertices that are not part of the index. */
+        constexpr static inline std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+
+        constexpr vertex_index(void) = default;
+        constexpr explicit vertex_index(Map map) : indices(std::move(map)) {}
+
+
+        /** Adds a vertex to the index if it is not already present and returns its index. */
+        constexpr std::size_t insert(Vertex vertex) {
+            auto [it, inserted] = indices.emplace(vertex, vertices.size());
+            if (inserted) vertices.push_back(vertex);
+
+            return it->second;
+        }
+
+
+        /** Returns the index of the given vertex. The vertex must be part of the index. */
+        [[nodiscard]] constexpr std::size_t index_of(Vertex vertex) const {
+            return indices.at(vertex);
+        }
+
+        /** Returns the index of the given vertex, or npos if the vertex is not part of the index. */
+        [[nodiscard]] constexpr std::size_t find(Vertex vertex) const {
+            auto it = indices.find(vertex);
+            return it == indices.end() ? npos : it->second;
+        }
+
+        /** Returns the vertex with the given index. */
+        [[nodiscard]] constexpr Vertex vertex_at(std::size_t index) const {
+            return vertices[index];
+        }
+
+        [[nodiscard]] constexpr bool contains(Vertex vertex) const {
+            return indices.contains(vertex);
+        }
+
+        [[nodiscard]] constexpr std::size_t size(void) const {
+            return vertices.size();
+        }
+
+        /** Returns all vertices in the index, ordered by their index. */
+        [[nodiscard]] constexpr const std::vector<Vertex>& get_vertices(void) const {
+            return vertices;
+        }
+    private:
+        Map indices;
+        std::vector<Vertex> vertices;
+    };
+
+
+    /**
+     * @ingroup Utils
+     * Mapping between the vertices of a graph with vertex ids (See @ref vertex_id_graph) and the integers [0, N),
+     * where N is one more than the largest vertex id. The index of every vertex is its id, so no hashing is required to find it.
+     * If the ids of the graph are not contiguous, some indices do not correspond to a vertex, and vertex_at returns a value-initialized vertex for them.
+     *
+     * This class has the same interface as @ref vertex_index, so algorithms can use either.
+     *
+     * @tparam Vertex The vertex type of the graph.
+     * @tparam GetId The type of the vertex id getter of the graph.
+     */
+    template <typename Vertex, typename GetId> class id_vertex_index {
+    public:
+        /** Returned by @ref find for vertices that are not part of the index. */
+        constexpr static inline std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+
+        constexpr explicit id_vertex_index(GetId get_id) : get_id(std::move(get_id)) {}
+
+
+        /** Adds a vertex to the index if it is not already present and returns its index. */
+        constexpr std::size_t insert(Vertex vertex) {
+            const std::size_t index = index_of(vertex);
+            if (index >= vertices.size()) vertices.resize(index + 1, Vertex {});
+
+            vertices[index] = vertex;
+            return index;
+        }
+
+
+        /** Returns the index of the given vertex, i.e. its id. */
+        [[nodiscard]] constexpr std::size_t index_of(Vertex vertex) const {
+            return std::size_t(std::invoke(get_id, vertex));
+        }
+
+        /** Returns the index of the given vertex, or npos if the vertex is not part of the index. */
+        [[nodiscard]] constexpr std::size_t find(Vertex vertex) const {
+            return contains(vertex) ? index_of(vertex) : npos;
+        }
+
+        /** Returns the vertex with the given index, or a value-initialized vertex if there is no vertex with that index. */
+        [[nodiscard]] constexpr Vertex vertex_at(std::size_t index) const {
+            return vertices[index];
+        }
+
+        [[nodiscard]] constexpr bool contains(Vertex vertex) const {
+            const std::size_t index = index_of(vertex);
+            return index < vertices.size() && vertices[index] == vertex;
+        }
+
+        /** Returns the number of indices, i.e. one more than the largest id of any vertex in the index. */
+        [[nodiscard]] constexpr std::size_t size(void) const {
+            return vertices.size();
+        }
+
+        /** Returns all vertices in the index, ordered by their index. */
+        [[nodiscard]] constexpr const std::vector<Vertex>& get_vertices(void) const {
+            return vertices;
+        }
+    private:
+        GetId get_id;
+        std::vector<Vertex> vertices;
+    };
+
+
+    /**
+     * @ingroup Utils
+     * Constructs a @ref vertex_index for all vertices of the given graph.
+     *
+     * @param graph The graph to index the vertices of.
+     * @param map_provider An optional storage-provider which can provide a unordered-map-like type for the index to use.
+     * @return A vertex_index containing every vertex of the graph.
+     *
+     * @graph_requires{vertex_list_graph<G>}
+     */
+    template <
+        graph_ref G,
+        store::storage_provider_ref<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>> PM
+            = store::default_provided_t<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>
+    > requires vertex_list_graph<G>
+    constexpr inline auto make_vertex_index(
+        G&& graph,
+        PM&& map_provider = store::get_default_storage_provider<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>()
+    ) {
+        vertex_index<vertex_of<G>, std::remove_cvref_t<store::provided_storage_type<PM>>> result { map_provider() };
+        for (auto vertex : graph.get_vertices()) result.insert(vertex);
+
+        return result;
+    }
+
+
+    /**
+     * @ingroup Utils
+     * Constructs a dense index for all vertices of the given graph.
+     * If the graph has vertex ids, this is an @ref id_vertex_index using those ids, otherwise it is a @ref vertex_index.
+     *
+     * @param graph The graph to index the vertices of.
+     * @param map_provider An optional storage-provider which can provide a unordered-map-like type for the index to use. Unused if the graph has vertex ids.
+     * @return An index containing every vertex of the graph.
+     *
+     * @graph_requires{vertex_list_graph<G>}
+     */
+    template <
+        graph_ref G,
+        store::storage_provider_ref<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>> PM
+            = store::default_provided_t<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>
+    > requires vertex_list_graph<G>
+    constexpr inline auto make_dense_vertex_index(
+        G&& graph,
+        PM&& map_provider = store::get_default_storage_provider<store::storage_type::UNORDERED_MAP, vertex_of<G>, std::size_t, vertex_hash_of<G>, vertex_compare_of<G>>()
+    ) {
+        if constexpr (vertex_id_graph<G>) {
+            id_vertex_index<vertex_of<G>, typename std::remove_cvref_t<G>::get_vertex_id_t> result { graph.get_vertex_id };
+            for (auto vertex : graph.get_vertices()) result.insert(vertex);
+
+            return result;
+        } else {
+            return make_vertex_index(graph, GRAPHLE_FWD(map_provider));
+        }
+    }
+}
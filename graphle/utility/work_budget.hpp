@@ -0,0 +1,155 @@
+#pragma once
+
+#include <common.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <concepts>
+#include <limits>
+#include <stop_token>
+
+
+namespace graphle::util {
+    /**
+     * @ingroup Utils
+     * The result of running a resumable algorithm with a @ref work_budget.
+     */
+    enum class run_status {
+        /** The budget was exhausted before the algorithm finished. Running it again continues where it left off. */
+        SUSPENDED,
+        /** The algorithm finished. */
+        FINISHED,
+        /** The algorithm was stopped early, e.g. by a visitor returning STOP_SEARCH. */
+        STOPPED,
+        /**
+         * The algorithm was cancelled through the stop token of its budget, or its budget was exhausted by an algorithm that cannot be resumed.
+         * Running a cancelled algorithm again has no effect.
+         */
+        CANCELLED
+    };
+
+
+    /**
+     * @ingroup Utils
+     * Limits the amount of work a resumable algorithm performs before it suspends, as a number of units of work (e.g. edges visited),
+     * as a point in time, or both. Algorithms consume work after every step, so they may exceed the budget by the work of a single step
+     * (e.g. the out edges of a single vertex). A budget can additionally be given a std::stop_token, to cancel an algorithm from another thread:
+     * ~~~
+     * auto budget = util::work_budget::of_time(50ms).with_stop_token(request.get_stop_token());
+     * if (search::breadth_first_search(graph, root, visitor, budget) == util::run_status::CANCELLED) { ... }
+     * ~~~
+     *
+     * The clock and the stop token are only checked once every check_interval units of work, so that they do not dominate cheap steps.
+     */
+    class work_budget {
+    public:
+        using clock = std::chrono::steady_clock;
+
+        /** The number of units of work between two checks of the deadline and the stop token. */
+        constexpr static inline std::size_t check_interval = 64;
+
+
+        /** Constructs an unlimited budget. */
+        work_budget(void) = default;
+
+
+        /** Returns a budget of the given number of units of work. */
+        [[nodiscard]] static work_budget of_work(std::size_t units) {
+            work_budget result;
+            result.remaining = units;
+
+            return result;
+        }
+
+        /** Returns a budget that is exhausted once the given deadline has passed. */
+        [[nodiscard]] static work_budget until(clock::time_point deadline) {
+            work_budget result;
+            result.deadline     = deadline;
+            result.has_deadline = true;
+
+            return result;
+        }
+
+        /** Returns a budget that is exhausted once the given duration has passed from now. */
+        template <typename Rep, typename Period> [[nodiscard]] static work_budget of_time(std::chrono::duration<Rep, Period> duration) {
+            return until(clock::now() + std::chrono::duration_cast<clock::duration>(duration));
+        }
+
+
+        /** Returns a copy of this budget that is also exhausted once the given deadline has passed. */
+        [[nodiscard]] work_budget with_deadline(clock::time_point deadline) const {
+            work_budget result = *this;
+            result.deadline     = has_deadline ? std::min(this->deadline, deadline) : deadline;
+            result.has_deadline = true;
+
+            return result;
+        }
+
+        /** Returns a copy of this budget that is also exhausted, and marked as cancelled, once a stop is requested through the given token. */
+        [[nodiscard]] work_budget with_stop_token(std::stop_token token) const {
+            work_budget result = *this;
+            result.token = std::move(token);
+
+            return result;
+        }
+
+
+        /** Consumes the given number of units of work. Returns false if the budget is exhausted afterwards. */
+        bool consume(std::size_t units = 1) {
+            remaining -= std::min(units, remaining);
+
+            if ((has_deadline || token.stop_possible()) && remaining > 0) {
+                since_check += units;
+
+                if (since_check >= check_interval) {
+                    since_check = 0;
+
+                    if (token.stop_requested()) {
+                        remaining = 0;
+                        stop_requested = true;
+                    } else if (has_deadline && clock::now() >= deadline) {
+                        remaining = 0;
+                    }
+                }
+            }
+
+            return remaining > 0;
+        }
+
+
+        [[nodiscard]] bool exhausted(void) const { return remaining == 0; }
+        /** Returns true if the budget was exhausted because a stop was requested through its stop token. */
+        [[nodiscard]] bool cancelled(void) const { return stop_requested; }
+        [[nodiscard]] std::size_t get_remaining_work(void) const { return remaining; }
+    private:
+        std::size_t remaining = std::numeric_limits<std::size_t>::max();
+
+        clock::time_point deadline {};
+        bool has_deadline = false;
+
+        std::stop_token token;
+        bool stop_requested = false;
+
+        std::size_t since_check = 0;
+    };
+
+
+    /**
+     * @ingroup Utils
+     * A budget that is never exhausted. Used to run resumable algorithms to completion without the overhead of tracking a budget.
+     */
+    struct unlimited_budget {
+        constexpr bool consume(std::size_t = 1) const { return true; }
+        constexpr bool cancelled(void) const { return false; }
+    };
+
+
+    /**
+     * @ingroup Utils
+     * A budget for a resumable algorithm, e.g. @ref work_budget or @ref unlimited_budget.
+     */
+    template <typename T> concept budget = requires (T& budget, std::size_t units) {
+        { budget.consume(units) } -> std::same_as<bool>;
+        { budget.cancelled()    } -> std::same_as<bool>;
+    };
+}
@@ -8,3 +8,4 @@
 #include <views/edge_from_vertex.hpp>
 #include <views/edge_perspective.hpp>
 #include <views/maybe_exists.hpp>
+#include <views/search_view.hpp>
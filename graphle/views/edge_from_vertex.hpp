@@ -37,6 +37,11 @@ namespace graphle {
             [[nodiscard]] constexpr auto size(void) const requires rng::sized_range<const R> {
                 return rng::size(base_range);
             }
+
+            /** Returns the viewed range of vertices. */
+            [[nodiscard]] constexpr const R& base(void) const { return base_range; }
+            /** Returns the vertex that is bound to every edge of this view. */
+            [[nodiscard]] constexpr vertex_type bound_vertex(void) const { return bind_vertex; }
         private:
             R base_range;
             vertex_type bind_vertex;
@@ -69,6 +74,19 @@ namespace graphle {
     }
 
 
+    namespace detail {
+        /**
+         * True if R is a @ref views::edge_from view of a contiguous range of vertices, i.e. if the vertices the edges of R go to
+         * can be accessed directly as a span without constructing every edge.
+         * The viewed range must be borrowed, so the span remains valid after the view itself is destroyed.
+         */
+        template <typename R> constexpr inline bool is_contiguous_edge_from_view = false;
+
+        template <typename R> constexpr inline bool is_contiguous_edge_from_view<edge_from_vertex_view<R, project_nth<0>, project_nth<1>>> =
+            rng::contiguous_range<const R> && rng::sized_range<const R> && rng::borrowed_range<R>;
+    }
+
+
     namespace views {
         /**
          * @ingroup Views
@@ -86,8 +104,8 @@ namespace graphle {
          */
         constexpr inline auto edge_to = detail::range_adaptor<
             detail::edge_from_vertex_view,
-            detail::project_nth<0>,
-            detail::project_nth<1>
+            detail::project_nth<1>,
+            detail::project_nth<0>
         > {};
     }
 }
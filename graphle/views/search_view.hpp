@@ -0,0 +1,263 @@
+#pragma once
+
+#include <common.hpp>
+#include <graph/graph.hpp>
+#include <storage/storage_provider.hpp>
+#include <storage/default_storage_provider.hpp>
+#include <utility/edge_utils.hpp>
+
+#include <deque>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+
+namespace graphle {
+    namespace views {
+        /**
+         * @ingroup Views
+         * A vertex reached by a search, as yielded by @ref bfs_steps and @ref dfs_steps.
+         */
+        template <typename Vertex> struct search_step {
+            /** The reached vertex. */
+            Vertex vertex;
+            /** The number of edges between the root and the vertex in the search tree. */
+            std::size_t depth;
+            /** The vertex through which the vertex was reached, or std::nullopt for the root. */
+            std::optional<Vertex> parent;
+        };
+    }
+
+
+    namespace detail {
+        /**
+         * Input range which lazily searches a graph, expanding a vertex only once the vertex after it is requested.
+         * The traversal state is stored in the view, so the view can only be iterated once.
+         *
+         * @tparam G The type of the graph to search.
+         * @tparam DepthFirst Whether pending vertices are taken from a stack (DFS) or from a queue (BFS).
+         * @tparam YieldSteps Whether the range yields search_steps or only vertices.
+         * @tparam Set The unordered-set-like type used to store seen vertices.
+         */
+        template <graph_ref G, bool DepthFirst, bool YieldSteps, typename Set>
+        class search_view : public rng::view_interface<search_view<G, DepthFirst, YieldSteps, Set>> {
+        public:
+            using graph_type  = std::remove_reference_t<G>;
+            using vertex_type = vertex_of<G>;
+            using step_type   = views::search_step<vertex_type>;
+
+
+            constexpr search_view(graph_type& graph, vertex_type root, Set seen) : graph(&graph), seen(std::move(seen)) {
+                pending.push_back(step_type { root, 0, std::nullopt });
+                this->seen.emplace(root);
+            }
+
+
+            [[nodiscard]] constexpr auto begin(void) {
+                if (!started) {
+                    started = true;
+                    advance();
+                }
+
+                return iterator { this };
+            }
+
+            [[nodiscard]] constexpr std::default_sentinel_t end(void) const {
+                return std::default_sentinel;
+            }
+        private:
+            graph_type* graph;
+            std::conditional_t<DepthFirst, std::vector<step_type>, std::deque<step_type>> pending;
+            Set seen;
+
+            std::optional<step_type> current;
+            bool started = false;
+
+
+            /** Expands the current vertex and takes the next vertex from the pending vertices. */
+            constexpr void advance(void) {
+                if (current) {
+                    const step_type& step = *current;
+
+                    auto push = [&] (vertex_type target) {
+                        if (seen.emplace(target).second) pending.push_back(step_type { target, step.depth + 1, step.vertex });
+                    };
+
+                    util::for_each_out_edge(*graph, step.vertex, [&] (const edge_of<G>& edge) { push(edge.second); });
+                }
+
+
+                if (pending.empty()) {
+                    current.reset();
+                } else if constexpr (DepthFirst) {
+                    current.emplace(std::move(pending.back()));
+                    pending.pop_back();
+                } else {
+                    current.emplace(std::move(pending.front()));
+                    pending.pop_front();
+                }
+            }
+
+
+            class iterator {
+            public:
+                using value_type      = std::conditional_t<YieldSteps, step_type, vertex_type>;
+                using difference_type = std::ptrdiff_t;
+
+
+                constexpr iterator(void) = default;
+                constexpr explicit iterator(search_view* view) : view(view) {}
+
+
+                [[nodiscard]] constexpr const value_type& operator*(void) const {
+                    if constexpr (YieldSteps) return *view->current;
+                    else return view->current->vertex;
+                }
+
+                constexpr iterator& operator++(void) {
+                    view->advance();
+                    return *this;
+                }
+
+                constexpr void operator++(int) {
+                    ++(*this);
+                }
+
+
+                [[nodiscard]] constexpr bool operator==(std::default_sentinel_t) const {
+                    return !view->current;
+                }
+            private:
+                search_view* view = nullptr;
+            };
+        };
+
+
+        template <bool DepthFirst, bool YieldSteps, typename G, typename PS>
+        constexpr inline auto make_search_view(G& graph, vertex_of<G> root, PS&& set_provider) {
+            using set_type = std::remove_cvref_t<decltype(set_provider())>;
+            return search_view<G, DepthFirst, YieldSteps, set_type> { graph, root, set_provider() };
+        }
+    }
+
+
+    namespace views {
+        /**
+         * @ingroup Views
+         * Returns an input range of the vertices of the given graph reachable from the given root, in the order in which @ref search::breadth_first_search visits them.
+         * The search is performed lazily: the out edges of a vertex are only visited once the range is advanced past it,
+         * so only the part of the graph that is consumed is searched, e.g.:
+         * ~~~
+         * // Visits the out edges of at most 10 vertices.
+         * for (auto vertex : views::bfs(graph, root) | views::take(10)) { ... }
+         * ~~~
+         *
+         * @param graph A graphle::graph to search. The graph must outlive the returned range.
+         * @param root The vertex to start the search from.
+         * @param set_provider An optional storage-provider which can provide a unordered-set-like type for the algorithm to use.
+         *
+         * @graph_requires{
+         *  edge_list_graph<G> ||
+         *  out_edges_graph<G> ||
+         *  (non_directed_graph<G> && in_edges_graph<G>)
+         * }
+         */
+        template <
+            graph_ref G,
+            store::storage_provider_ref<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>> PS
+                = store::default_provided_t<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>
+        > requires (
+            edge_list_graph<G> ||
+            out_edges_graph<G> ||
+            (non_directed_graph<G> && in_edges_graph<G>)
+        ) constexpr inline auto bfs(
+            G& graph,
+            vertex_of<G> root,
+            PS&& set_provider = store::get_default_storage_provider<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>()
+        ) {
+            return detail::make_search_view<false, false>(graph, root, GRAPHLE_FWD(set_provider));
+        }
+
+
+        /**
+         * @ingroup Views
+         * Equivalent to @ref bfs, but yields the vertices in the order in which @ref search::depth_first_search visits them.
+         *
+         * @graph_requires{
+         *  edge_list_graph<G> ||
+         *  out_edges_graph<G> ||
+         *  (non_directed_graph<G> && in_edges_graph<G>)
+         * }
+         */
+        template <
+            graph_ref G,
+            store::storage_provider_ref<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>> PS
+                = store::default_provided_t<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>
+        > requires (
+            edge_list_graph<G> ||
+            out_edges_graph<G> ||
+            (non_directed_graph<G> && in_edges_graph<G>)
+        ) constexpr inline auto dfs(
+            G& graph,
+            vertex_of<G> root,
+            PS&& set_provider = store::get_default_storage_provider<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>()
+        ) {
+            return detail::make_search_view<true, false>(graph, root, GRAPHLE_FWD(set_provider));
+        }
+
+
+        /**
+         * @ingroup Views
+         * Equivalent to @ref bfs, but yields a @ref search_step for every vertex, containing its depth and parent in the search tree.
+         *
+         * @graph_requires{
+         *  edge_list_graph<G> ||
+         *  out_edges_graph<G> ||
+         *  (non_directed_graph<G> && in_edges_graph<G>)
+         * }
+         */
+        template <
+            graph_ref G,
+            store::storage_provider_ref<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>> PS
+                = store::default_provided_t<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>
+        > requires (
+            edge_list_graph<G> ||
+            out_edges_graph<G> ||
+            (non_directed_graph<G> && in_edges_graph<G>)
+        ) constexpr inline auto bfs_steps(
+            G& graph,
+            vertex_of<G> root,
+            PS&& set_provider = store::get_default_storage_provider<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>()
+        ) {
+            return detail::make_search_view<false, true>(graph, root, GRAPHLE_FWD(set_provider));
+        }
+
+
+        /**
+         * @ingroup Views
+         * Equivalent to @ref dfs, but yields a @ref search_step for every vertex, containing its depth and parent in the search tree.
+         *
+         * @graph_requires{
+         *  edge_list_graph<G> ||
+         *  out_edges_graph<G> ||
+         *  (non_directed_graph<G> && in_edges_graph<G>)
+         * }
+         */
+        template <
+            graph_ref G,
+            store::storage_provider_ref<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>> PS
+                = store::default_provided_t<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>
+        > requires (
+            edge_list_graph<G> ||
+            out_edges_graph<G> ||
+            (non_directed_graph<G> && in_edges_graph<G>)
+        ) constexpr inline auto dfs_steps(
+            G& graph,
+            vertex_of<G> root,
+            PS&& set_provider = store::get_default_storage_provider<store::storage_type::UNORDERED_SET, vertex_of<G>, vertex_hash_of<G>, vertex_compare_of<G>>()
+        ) {
+            return detail::make_search_view<true, true>(graph, root, GRAPHLE_FWD(set_provider));
+        }
+    }
+}
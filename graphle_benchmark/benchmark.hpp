@@ -0,0 +1,59 @@
+#pragma once
+
+#include <graphle.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+
+namespace graphle::benchmark {
+    /**
+     * A directed graph with uniformly random edges, storing the out neighbours of every vertex in a contiguous vector,
+     * so that searching it accesses memory at random like a large real-world graph would.
+     */
+    struct random_graph {
+        struct vertex { std::vector<vertex*> out; };
+        std::vector<vertex> vertices;
+
+
+        random_graph(std::size_t num_vertices, std::size_t out_degree, std::uint32_t seed = 0) : vertices(num_vertices) {
+            std::mt19937 random { seed };
+            std::uniform_int_distribution<std::size_t> target { 0, num_vertices - 1 };
+
+            for (auto& v : vertices) {
+                v.out.reserve(out_degree);
+                for (std::size_t i = 0; i < out_degree; ++i) v.out.push_back(&vertices[target(random)]);
+            }
+        }
+
+
+        auto view_as_graph(void) {
+            return graph {
+                .deduce_vertex_type = meta::deduce_as<vertex>,
+                .get_vertices       = [this] { return views::all(vertices) | views::transform(util::addressof); },
+                .get_out_edges      = [] (vertex* v) { return views::all(v->out) | views::edge_from(v); }
+            };
+        }
+    };
+
+
+    /** Returns the shortest time in milliseconds out of the given number of invocations of the given function. */
+    template <typename F> inline double measure_ms(F&& function, std::size_t repetitions = 3) {
+        double best = std::numeric_limits<double>::max();
+
+        for (std::size_t i = 0; i < repetitions; ++i) {
+            const auto start = std::chrono::steady_clock::now();
+            function();
+            const auto end = std::chrono::steady_clock::now();
+
+            best = std::min(best, std::chrono::duration<double, std::milli>(end - start).count());
+        }
+
+        return best;
+    }
+}
@@ -0,0 +1,44 @@
+#include <benchmark.hpp>
+
+#include <iomanip>
+#include <iostream>
+
+
+/**
+ * Measures the time taken by a breadth first search, a depth first search and Tarjan's algorithm on random graphs of increasing size.
+ * Compare the output of benchmark_prefetch and benchmark_prefetch_with_prefetch to measure the effect of prefetching
+ * (See @ref GRAPHLE_PREFETCH_DISTANCE).
+ */
+int main(void) {
+    constexpr std::size_t out_degree = 8;
+
+    std::cout << "Prefetch distance: " << graphle::util::default_prefetch_distance << "\n\n";
+    std::cout << std::setw(10) << "vertices" << std::setw(12) << "bfs (ms)" << std::setw(12) << "dfs (ms)" << std::setw(12) << "scc (ms)" << '\n';
+
+
+    for (std::size_t num_vertices = std::size_t { 1 } << 12; num_vertices <= std::size_t { 1 } << 20; num_vertices <<= 2) {
+        graphle::benchmark::random_graph structure { num_vertices, out_degree };
+        auto graph = structure.view_as_graph();
+        auto root  = &structure.vertices[0];
+
+        std::size_t checksum = 0;
+        auto visitor = graphle::search::visitor_from_arguments {
+            .deduce_graph_type = graphle::meta::deduce_as<decltype(graph)>,
+            .discover_vertex   = [&] (auto v, auto& g) { ++checksum; }
+        };
+
+
+        const double bfs = graphle::benchmark::measure_ms([&] { graphle::search::breadth_first_search(graph, root, visitor); });
+        const double dfs = graphle::benchmark::measure_ms([&] { graphle::search::depth_first_search(graph, root, visitor); });
+        const double scc = graphle::benchmark::measure_ms([&] { checksum += graphle::alg::strongly_connected_components(graph).size(); });
+
+
+        std::cout
+            << std::setw(10) << num_vertices
+            << std::fixed << std::setprecision(2)
+            << std::setw(12) << bfs
+            << std::setw(12) << dfs
+            << std::setw(12) << scc
+            << "    (checksum " << checksum << ")\n";
+    }
+}
@@ -0,0 +1,156 @@
+#include <test_framework.hpp>
+#include <test_data.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+
+/** Returns the vertex ids of the given vertices in ascending order. */
+template <typename Vertices> static std::vector<std::size_t> ids_of(const Vertices& vertices) {
+    std::vector<std::size_t> result;
+    for (const auto* v : vertices) result.push_back(v->vertex_id);
+
+    std::ranges::sort(result);
+    return result;
+}
+
+
+/**
+ * @test bit_matrix::construct
+ * Checks that a bit matrix graph constructed from another graph contains the same edges and can itself be used as a graphle::graph.
+ */
+TEST(bit_matrix, construct) {
+    auto source = graphle::test::v_list_out_edge_graph::from_ve_list(graphle::test::make_dag_graph());
+    auto matrix = graphle::make_bit_matrix_graph(source.view_as_graph());
+
+
+    std::size_t num_edges = 0;
+
+    for (auto& v : source.vertices) {
+        for (auto& w : source.vertices) {
+            const bool expected = std::ranges::find(v.out, &w) != v.out.end();
+            ASSERT_TRUE(matrix.has_edge(&v, &w) == expected);
+        }
+
+        num_edges += v.out.size();
+    }
+
+
+    auto view = matrix.view_as_graph();
+    std::size_t num_view_edges = 0;
+
+    for (auto v : view.get_vertices()) num_view_edges += graphle::util::out_degree(view, v);
+    ASSERT_TRUE(num_view_edges == num_edges);
+}
+
+
+/**
+ * @test bit_matrix::breadth_first_search
+ * Checks the levels found by the bit-parallel BFS.
+ */
+TEST(bit_matrix, breadth_first_search) {
+    auto source = graphle::test::v_list_out_edge_graph::from_ve_list(graphle::test::make_dag_graph());
+    auto matrix = graphle::make_bit_matrix_graph(source.view_as_graph());
+
+    const auto distances = graphle::alg::breadth_first_distances(matrix, matrix.index_of(&source.vertices[0]));
+    const auto expected  = std::vector<std::size_t> { 0, std::numeric_limits<std::size_t>::max(), 1, 2, 3, 4, 2, 3, 5 };
+
+    for (std::size_t i = 0; i < source.vertices.size(); ++i) {
+        ASSERT_TRUE(distances[matrix.index_of(&source.vertices[i])] == expected[i]);
+    }
+
+
+    const auto reachable = graphle::alg::reachable_vertices(matrix, matrix.index_of(&source.vertices[1]));
+    std::vector<std::size_t> reachable_ids;
+
+    for (auto i : reachable.set_bits()) reachable_ids.push_back(matrix.vertex_at(i)->vertex_id);
+    std::ranges::sort(reachable_ids);
+
+    ASSERT_TRUE(reachable_ids == (std::vector<std::size_t> { 1, 3, 4, 5, 6, 7, 8 }));
+}
+
+
+/**
+ * @test bit_matrix::transitive_closure
+ * Checks that the transitive closure contains an edge between every pair of vertices connected by a path.
+ */
+TEST(bit_matrix, transitive_closure) {
+    auto source  = graphle::test::v_list_out_edge_graph::from_ve_list(graphle::test::make_linear_graph());
+    auto matrix  = graphle::make_bit_matrix_graph(source.view_as_graph());
+    auto closure = graphle::alg::transitive_closure(matrix);
+
+    for (std::size_t i = 0; i < source.vertices.size(); ++i) {
+        for (std::size_t j = 0; j < source.vertices.size(); ++j) {
+            ASSERT_TRUE(closure.has_edge(&source.vertices[i], &source.vertices[j]) == (i < j));
+        }
+    }
+}
+
+
+/**
+ * @test bit_matrix::strongly_connected_components
+ * Checks the strongly connected components found for a graph with two overlapping cycles.
+ */
+TEST(bit_matrix, strongly_connected_components) {
+    auto source = graphle::test::v_list_out_edge_graph::from_ve_list(graphle::test::make_cyclic_graph());
+    auto matrix = graphle::make_bit_matrix_graph(source.view_as_graph());
+
+
+    auto all = graphle::alg::strongly_connected_components(matrix);
+    std::vector<std::vector<std::size_t>> all_ids;
+
+    for (const auto& scc : all) all_ids.push_back(ids_of(scc));
+    std::ranges::sort(all_ids);
+
+    ASSERT_TRUE(all_ids == (std::vector<std::vector<std::size_t>> { { 0 }, { 1 }, { 2, 3, 4, 5, 6, 7, 8 } }));
+
+
+    auto cycles = graphle::alg::strongly_connected_components(matrix, 2);
+
+    ASSERT_TRUE(cycles.size() == 1);
+    ASSERT_TRUE(ids_of(cycles[0]) == (std::vector<std::size_t> { 2, 3, 4, 5, 6, 7, 8 }));
+}
+
+
+/**
+ * @test bit_matrix::budget
+ * Checks that the bit matrix algorithms are cancelled once their budget is exhausted, and give the same results as without a budget if it is not.
+ */
+TEST(bit_matrix, budget) {
+    auto source = graphle::test::v_list_out_edge_graph::from_ve_list(graphle::test::make_linear_graph());
+    auto matrix = graphle::make_bit_matrix_graph(source.view_as_graph());
+
+    const std::size_t root = matrix.index_of(&source.vertices[0]);
+    const std::size_t last = matrix.index_of(&source.vertices.back());
+
+    using graphle::util::run_status;
+    using graphle::util::work_budget;
+    using graphle::util::unlimited_budget;
+
+
+    auto [distances_cancelled, partial_distances] = graphle::alg::breadth_first_distances(matrix, root, work_budget::of_work(1));
+    ASSERT_TRUE(distances_cancelled == run_status::CANCELLED);
+    ASSERT_TRUE(partial_distances[last] == std::numeric_limits<std::size_t>::max());
+    ASSERT_TRUE(graphle::alg::breadth_first_distances(matrix, root, unlimited_budget {}) == std::pair { run_status::FINISHED, graphle::alg::breadth_first_distances(matrix, root) });
+
+
+    auto [reachable_cancelled, partial_reachable] = graphle::alg::reachable_vertices(matrix, root, work_budget::of_work(1));
+    ASSERT_TRUE(reachable_cancelled == run_status::CANCELLED);
+    ASSERT_FALSE(partial_reachable.test(last));
+    ASSERT_TRUE(graphle::alg::reachable_vertices(matrix, root, unlimited_budget {}).second.test(last));
+
+
+    auto [closure_cancelled, partial_closure] = graphle::alg::transitive_closure(matrix, work_budget::of_work(1));
+    ASSERT_TRUE(closure_cancelled == run_status::CANCELLED);
+    ASSERT_FALSE(partial_closure.has_edge(&source.vertices[0], &source.vertices.back()));
+
+
+    auto [scc_cancelled, partial_components] = graphle::alg::strongly_connected_components(matrix, work_budget::of_work(1));
+    ASSERT_TRUE(scc_cancelled == run_status::CANCELLED);
+    ASSERT_TRUE(partial_components.size() == 0);
+
+    auto [scc_finished, components] = graphle::alg::strongly_connected_components(matrix, unlimited_budget {});
+    ASSERT_TRUE(scc_finished == run_status::FINISHED);
+    ASSERT_TRUE(components.size() == source.vertices.size());
+}
@@ -0,0 +1,143 @@
+#include <test_framework.hpp>
+#include <test_data.hpp>
+
+#include <vector>
+
+
+using V = typename graphle::test::ve_list_graph::vertex;
+
+
+/** Two fully connected clusters of four vertices, with a single edge from the first cluster to the second. */
+static graphle::test::ve_list_graph make_two_cluster_graph(void) {
+    graphle::test::ve_list_graph result;
+    for (std::size_t i = 0; i < 8; ++i) result.vertices.push_back(V { i });
+
+    for (std::size_t cluster : { 0, 4 }) {
+        for (std::size_t i = cluster; i < cluster + 4; ++i) {
+            for (std::size_t j = cluster; j < cluster + 4; ++j) {
+                if (i != j) result.edges.emplace_back(V { i }, V { j });
+            }
+        }
+    }
+
+    result.edges.emplace_back(V { 3 }, V { 4 });
+    return result;
+}
+
+
+/**
+ * @test graph_partition::two_clusters
+ * Partitions a graph consisting of two clusters using LDG, and checks that each cluster ends up in its own part.
+ * (Fennel's balance penalty is too strong for a graph this small to reliably give the same result.)
+ */
+TEST(graph_partition, two_clusters) {
+    auto source = graphle::test::v_list_out_edge_graph::from_ve_list(make_two_cluster_graph());
+    auto graph  = source.view_as_graph();
+
+    for (std::size_t num_passes : { 1, 2 }) {
+        auto partition = graphle::alg::partition_graph(graph, 2, {
+            .heuristic     = graphle::alg::partition_heuristic::LINEAR_DETERMINISTIC_GREEDY,
+            .num_passes    = num_passes,
+            .max_imbalance = 1.0
+        });
+
+
+        ASSERT_TRUE(partition.edge_cut == 1);
+        ASSERT_TRUE(partition.parts[0].num_owned == 4 && partition.parts[1].num_owned == 4);
+
+        for (std::size_t i = 0; i < 8; ++i) {
+            ASSERT_TRUE(partition.part_of(&source.vertices[i]) == partition.part_of(&source.vertices[i < 4 ? 0 : 4]));
+        }
+
+
+        const auto& from = partition.parts[partition.part_of(&source.vertices[3])];
+        const auto& to   = partition.parts[partition.part_of(&source.vertices[4])];
+
+        ASSERT_TRUE(from.num_ghosts() == 1);
+        ASSERT_TRUE(from.vertices[from.num_owned] == &source.vertices[4]);
+        ASSERT_TRUE(from.ghost_remote_ids[0] == partition.local_id_of(&source.vertices[4]));
+        ASSERT_TRUE(from.boundary == std::vector<std::size_t> { partition.local_id_of(&source.vertices[3]) });
+
+        ASSERT_TRUE(to.num_ghosts() == 0);
+        ASSERT_TRUE(to.boundary.empty());
+    }
+}
+
+
+/**
+ * @test graph_partition::csr_matches_graph
+ * Checks that the per-part CSR subgraphs contain exactly the edges of the original graph and that no part exceeds its capacity.
+ */
+TEST(graph_partition, csr_matches_graph) {
+    for (const auto& g : graphle::test::make_graphs()) {
+        auto source = graphle::test::v_list_out_edge_graph::from_ve_list(g);
+        auto graph  = source.view_as_graph();
+
+        for (std::size_t k : { 1, 2, 3 }) {
+            auto partition = graphle::alg::partition_graph(graph, k, { .heuristic = graphle::alg::partition_heuristic::FENNEL, .num_passes = 2 });
+            const std::size_t capacity = (source.vertices.size() * 11 + 10 * k - 1) / (10 * k);
+
+
+            std::size_t num_owned = 0, num_edges = 0, num_cut = 0;
+
+            for (std::size_t p = 0; p < k; ++p) {
+                const auto& part = partition.parts[p];
+
+                ASSERT_TRUE(part.num_owned <= std::max<std::size_t>(capacity, 1));
+                num_owned += part.num_owned;
+
+                for (std::size_t local = 0; local < part.num_owned; ++local) {
+                    auto* vertex = part.vertices[local];
+                    ASSERT_TRUE(partition.part_of(vertex) == p);
+                    ASSERT_TRUE(part.out_neighbors(local).size() == vertex->out.size());
+
+                    for (std::size_t i = 0; i < vertex->out.size(); ++i) {
+                        const auto target = part.out_neighbors(local)[i];
+                        ASSERT_TRUE(part.vertices[target] == vertex->out[i]);
+
+                        if (part.is_ghost(target)) {
+                            ++num_cut;
+                            ASSERT_TRUE(part.ghost_owners[target - part.num_owned] == partition.part_of(vertex->out[i]));
+                        }
+                    }
+
+                    num_edges += vertex->out.size();
+                }
+            }
+
+
+            ASSERT_TRUE(num_owned == g.vertices.size());
+            ASSERT_TRUE(num_edges == g.edges.size());
+            ASSERT_TRUE(num_cut == partition.edge_cut);
+        }
+    }
+}
+
+
+/**
+ * @test graph_partition::budget
+ * Checks that the refinement passes are skipped once the budget is exhausted, still returning a partition of every vertex,
+ * and that the partition is the same as without a budget if the budget suffices for every pass.
+ */
+TEST(graph_partition, budget) {
+    auto source = graphle::test::v_list_out_edge_graph::from_ve_list(make_two_cluster_graph());
+    auto graph  = source.view_as_graph();
+
+    const graphle::alg::partition_options options {
+        .heuristic     = graphle::alg::partition_heuristic::LINEAR_DETERMINISTIC_GREEDY,
+        .num_passes    = 3,
+        .max_imbalance = 1.0
+    };
+
+
+    auto [cancelled_status, cancelled] = graphle::alg::partition_graph(graph, 2, graphle::util::work_budget::of_work(1), options);
+    ASSERT_TRUE(cancelled_status == graphle::util::run_status::CANCELLED);
+    ASSERT_TRUE(cancelled.parts[0].num_owned + cancelled.parts[1].num_owned == 8);
+
+
+    const auto expected = graphle::alg::partition_graph(graph, 2, options);
+    auto [finished_status, finished] = graphle::alg::partition_graph(graph, 2, graphle::util::unlimited_budget {}, options);
+
+    ASSERT_TRUE(finished_status == graphle::util::run_status::FINISHED);
+    ASSERT_TRUE(finished.labels == expected.labels);
+}
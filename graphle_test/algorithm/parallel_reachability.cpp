@@ -0,0 +1,120 @@
+#include <test_framework.hpp>
+#include <test_datastructures.hpp>
+#include <graphle.hpp>
+
+#include <vector>
+
+
+/**
+ * Returns a graph of num_vertices vertices in which every vertex i < num_vertices / 2 has edges to 2i + 1 and 2i + 2 (if those are in the first half),
+ * and every vertex in the second half has an edge to the next vertex. Vertices in the first half can therefore not reach the second half.
+ */
+static graphle::test::v_list_out_edge_graph make_test_graph(std::size_t num_vertices) {
+    graphle::test::ve_list_graph src;
+    for (std::size_t i = 0; i < num_vertices; ++i) src.vertices.push_back({ i });
+
+    const std::size_t half = num_vertices / 2;
+
+    for (std::size_t i = 0; i < half; ++i) {
+        for (std::size_t j : { 2 * i + 1, 2 * i + 2 }) {
+            if (j < half) src.edges.emplace_back(src.vertices[i], src.vertices[j]);
+        }
+    }
+
+    for (std::size_t i = half; i + 1 < num_vertices; ++i) src.edges.emplace_back(src.vertices[i], src.vertices[i + 1]);
+
+    return graphle::test::v_list_out_edge_graph::from_ve_list(src);
+}
+
+
+/**
+ * @test parallel_reachability::reachable_vertices
+ * Checks that exactly the vertices reachable from the roots are found, for different numbers of workers and chunk sizes.
+ */
+TEST(parallel_reachability, reachable_vertices) {
+    constexpr std::size_t num_vertices = 4000;
+
+    auto structure = make_test_graph(num_vertices);
+    auto graph     = structure.view_as_graph();
+
+
+    for (std::size_t num_workers : { 1, 4 }) {
+        graphle::util::thread_pool pool { num_workers };
+
+        for (std::size_t chunk_size : { 1, 8, 256 }) {
+            SUBTEST_SCOPE("from_root") {
+                std::vector roots { &structure.vertices[0] };
+                auto reachable = graphle::alg::parallel_reachable_vertices(graph, roots, pool, chunk_size);
+
+                ASSERT_TRUE(reachable.size() == num_vertices / 2);
+                ASSERT_TRUE(reachable.contains(&structure.vertices[num_vertices / 2 - 1]));
+                ASSERT_FALSE(reachable.contains(&structure.vertices[num_vertices / 2]));
+            }
+
+
+            SUBTEST_SCOPE("from_multiple_roots") {
+                std::vector roots { &structure.vertices[num_vertices - 10], &structure.vertices[num_vertices / 4], &structure.vertices[num_vertices - 10] };
+                auto reachable = graphle::alg::parallel_reachable_vertices(graph, roots, pool, chunk_size);
+
+                std::vector<std::size_t> ids;
+                for (auto* v : reachable.vertices()) ids.push_back(v->vertex_id);
+
+                ASSERT_TRUE(ids.size() == 11);
+                ASSERT_TRUE(ids.front() == num_vertices / 4);
+                ASSERT_TRUE(ids[1] == num_vertices - 10);
+                ASSERT_TRUE(ids.back() == num_vertices - 1);
+            }
+        }
+    }
+}
+
+
+/**
+ * @test parallel_reachability::budget
+ * Checks that the search is cancelled once its budget is exhausted, and finds every reachable vertex with an unlimited budget.
+ */
+TEST(parallel_reachability, budget) {
+    constexpr std::size_t num_vertices = 4000;
+
+    auto structure = make_test_graph(num_vertices);
+    auto graph     = structure.view_as_graph();
+
+    std::vector roots { &structure.vertices[0] };
+
+
+    for (std::size_t num_workers : { 1, 4 }) {
+        graphle::util::thread_pool pool { num_workers };
+
+        auto [cancelled_status, cancelled] = graphle::alg::parallel_reachable_vertices(graph, roots, pool, graphle::util::work_budget::of_work(1), 8);
+        ASSERT_TRUE(cancelled_status == graphle::util::run_status::CANCELLED);
+        ASSERT_TRUE(cancelled.size() < num_vertices / 2);
+
+        auto [finished_status, finished] = graphle::alg::parallel_reachable_vertices(graph, roots, pool, graphle::util::unlimited_budget {}, 8);
+        ASSERT_TRUE(finished_status == graphle::util::run_status::FINISHED);
+        ASSERT_TRUE(finished.size() == num_vertices / 2);
+    }
+}
+
+
+/**
+ * @test parallel_reachability::many_small_chunks
+ * Repeatedly searches with single-vertex chunks and more workers than chunks at the start, so workers constantly go idle and steal,
+ * and checks that no worker ends the search while work is left, I.e. that every search finishes with all reachable vertices.
+ */
+TEST(parallel_reachability, many_small_chunks) {
+    constexpr std::size_t num_vertices = 2000;
+
+    auto structure = make_test_graph(num_vertices);
+    auto graph     = structure.view_as_graph();
+
+    std::vector roots { &structure.vertices[0], &structure.vertices[num_vertices / 2] };
+    graphle::util::thread_pool pool { 8 };
+
+
+    for (std::size_t run = 0; run < 50; ++run) {
+        auto [status, reachable] = graphle::alg::parallel_reachable_vertices(graph, roots, pool, graphle::util::unlimited_budget {}, 1);
+
+        ASSERT_TRUE(status == graphle::util::run_status::FINISHED);
+        ASSERT_TRUE(reachable.size() == num_vertices);
+    }
+}
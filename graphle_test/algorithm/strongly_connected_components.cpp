@@ -0,0 +1,165 @@
+#include <test_framework.hpp>
+#include <test_data.hpp>
+
+#include <algorithm>
+#include <typeinfo>
+#include <vector>
+
+
+static_assert(graphle::contiguous_out_neighbors_graph<decltype(std::declval<graphle::test::v_list_out_edge_graph&>().view_as_graph())>);
+static_assert(!graphle::contiguous_out_neighbors_graph<decltype(std::declval<graphle::test::out_edge_graph&>().view_as_graph())>);
+
+
+/** Returns the sorted sizes of the SCCs of the given graph data with at least min_size vertices, for every datastructure. */
+template <typename DS> static std::vector<std::size_t> component_sizes(const graphle::test::ve_list_graph& src, std::size_t min_size) {
+    auto structure = DS::from_ve_list(src);
+    auto graph     = structure.view_as_graph();
+
+    std::vector<std::size_t> result;
+    for (const auto& scc : graphle::alg::strongly_connected_components(graph, min_size)) result.push_back(scc.size());
+
+    std::ranges::sort(result);
+    return result;
+}
+
+
+/**
+ * @test scc::component_sizes
+ * Checks that the strongly connected components of graphs with and without cycles are found for every datastructure with a vertex list.
+ */
+TEST(scc, component_sizes) {
+    graphle::test::vertex_list_datastructure_list::foreach([&] <typename DS> {
+        SUBTEST_SCOPE(typeid(DS).name()) {
+            ASSERT_TRUE(component_sizes<DS>(graphle::test::make_cyclic_graph(), 0) == (std::vector<std::size_t> { 1, 1, 7 }));
+            ASSERT_TRUE(component_sizes<DS>(graphle::test::make_cyclic_graph(), 2) == (std::vector<std::size_t> { 7 }));
+            ASSERT_TRUE(component_sizes<DS>(graphle::test::make_bidirectional_edge_graph(), 0) == (std::vector<std::size_t> { 1, 5 }));
+            ASSERT_TRUE(component_sizes<DS>(graphle::test::make_dag_graph(), 2).empty());
+            ASSERT_TRUE(component_sizes<DS>(graphle::test::make_dag_graph(), 0).size() == 9);
+            ASSERT_TRUE(component_sizes<DS>(graphle::test::make_empty_graph(), 0).empty());
+        }
+    });
+}
+
+
+/**
+ * @test scc::jagged_result
+ * Checks that the strongly connected components are stored contiguously in the returned jagged array,
+ * and that the same components can still be written into a vector of vectors.
+ */
+TEST(scc, jagged_result) {
+    auto structure = graphle::test::v_list_out_edge_graph::from_ve_list(graphle::test::make_bidirectional_edge_graph());
+    auto graph     = structure.view_as_graph();
+
+    auto components = graphle::alg::strongly_connected_components(graph);
+
+    ASSERT_TRUE(components.size() == 2);
+    ASSERT_TRUE(components.num_values() == structure.vertices.size());
+    ASSERT_TRUE(components[0].data() + components[0].size() == components[1].data());
+
+
+    std::vector<std::vector<graphle::vertex_of<decltype(graph)>>> nested;
+    auto provider = graphle::store::get_default_storage_provider<graphle::store::storage_type::VECTOR, graphle::vertex_of<decltype(graph)>>();
+    graphle::alg::strongly_connected_components(graph, graphle::util::vec_of_vecs_output_iterator { nested, provider });
+
+    ASSERT_TRUE(nested.size() == components.size());
+    for (std::size_t i = 0; i < nested.size(); ++i) ASSERT_TRUE(std::ranges::equal(nested[i], components[i]));
+}
+
+
+/**
+ * @test scc::resumable
+ * Checks that running the resumable algorithm with a budget of a single unit of work finds the same components as the regular algorithm.
+ */
+TEST(scc, resumable) {
+    graphle::test::vertex_list_datastructure_list::foreach([&] <typename DS> {
+        SUBTEST_SCOPE(typeid(DS).name()) {
+            for (const auto& src : graphle::test::make_graphs()) {
+                auto structure = DS::from_ve_list(src);
+                auto graph     = structure.view_as_graph();
+
+                using vertex = graphle::vertex_of<decltype(graph)>;
+                auto provider = graphle::store::get_default_storage_provider<graphle::store::storage_type::VECTOR, vertex>();
+
+
+                std::vector<std::vector<vertex>> expected, result;
+                graphle::alg::strongly_connected_components(graph, graphle::util::vec_of_vecs_output_iterator { expected, provider });
+
+                auto scc = graphle::alg::resumable_strongly_connected_components(graph, graphle::util::vec_of_vecs_output_iterator { result, provider });
+
+                std::size_t runs = 0;
+                while (scc.run(graphle::util::work_budget::of_work(1)) == graphle::util::run_status::SUSPENDED) ++runs;
+
+                ASSERT_TRUE(scc.finished());
+                ASSERT_TRUE(result == expected);
+                ASSERT_TRUE(runs + 1 >= structure.vertices.size());
+            }
+        }
+    });
+}
+
+
+/**
+ * @test scc::exact_budget
+ * Checks that the algorithm finishes, rather than being cancelled, when its budget is exhausted by the step that completes the last component.
+ */
+TEST(scc, exact_budget) {
+    graphle::test::vertex_list_datastructure_list::foreach([&] <typename DS> {
+        SUBTEST_SCOPE(typeid(DS).name()) {
+            for (const auto& src : graphle::test::make_graphs()) {
+                auto structure = DS::from_ve_list(src);
+                auto graph     = structure.view_as_graph();
+
+                using vertex = graphle::vertex_of<decltype(graph)>;
+                auto provider = graphle::store::get_default_storage_provider<graphle::store::storage_type::VECTOR, vertex>();
+
+
+                std::vector<std::vector<vertex>> expected, result;
+                graphle::util::work_budget measure;
+
+                ASSERT_TRUE(graphle::alg::strongly_connected_components(graph, graphle::util::vec_of_vecs_output_iterator { expected, provider }, measure) == graphle::util::run_status::FINISHED);
+                const std::size_t total = graphle::util::work_budget {}.get_remaining_work() - measure.get_remaining_work();
+
+                ASSERT_TRUE(graphle::alg::strongly_connected_components(graph, graphle::util::vec_of_vecs_output_iterator { result, provider }, graphle::util::work_budget::of_work(total)) == graphle::util::run_status::FINISHED);
+                ASSERT_TRUE(result == expected);
+            }
+        }
+    });
+}
+
+
+/**
+ * @test scc::deadline
+ * Checks that the algorithm is cancelled once the deadline of its budget has passed, and finishes normally with an unlimited budget,
+ * both when writing into an output iterator and when returning a jagged array.
+ */
+TEST(scc, deadline) {
+    graphle::test::ve_list_graph src;
+    for (std::size_t i = 0; i < 1000; ++i) src.vertices.push_back({ i });
+    for (std::size_t i = 0; i + 1 < 1000; ++i) src.edges.emplace_back(src.vertices[i], src.vertices[i + 1]);
+
+    auto structure = graphle::test::v_list_out_edge_graph::from_ve_list(src);
+    auto graph     = structure.view_as_graph();
+
+    using vertex  = graphle::vertex_of<decltype(graph)>;
+    auto provider = graphle::store::get_default_storage_provider<graphle::store::storage_type::VECTOR, vertex>();
+
+
+    std::vector<std::vector<vertex>> result;
+    auto expired = graphle::util::work_budget::until(graphle::util::work_budget::clock::now());
+
+    ASSERT_TRUE(graphle::alg::strongly_connected_components(graph, graphle::util::vec_of_vecs_output_iterator { result, provider }, expired) == graphle::util::run_status::CANCELLED);
+    ASSERT_TRUE(result.size() < 1000);
+
+    result.clear();
+    ASSERT_TRUE(graphle::alg::strongly_connected_components(graph, graphle::util::vec_of_vecs_output_iterator { result, provider }, graphle::util::unlimited_budget {}) == graphle::util::run_status::FINISHED);
+    ASSERT_TRUE(result.size() == 1000);
+
+
+    auto [cancelled_status, cancelled_components] = graphle::alg::strongly_connected_components(graph, expired);
+    ASSERT_TRUE(cancelled_status == graphle::util::run_status::CANCELLED);
+    ASSERT_TRUE(cancelled_components.size() < 1000);
+
+    auto [finished_status, finished_components] = graphle::alg::strongly_connected_components(graph, graphle::util::unlimited_budget {});
+    ASSERT_TRUE(finished_status == graphle::util::run_status::FINISHED);
+    ASSERT_TRUE(finished_components.size() == 1000);
+}
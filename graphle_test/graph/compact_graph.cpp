@@ -0,0 +1,91 @@
+#include <test_framework.hpp>
+#include <test_datastructures.hpp>
+#include <graphle.hpp>
+
+#include <vector>
+
+
+/** Returns a graph 0 -> 1 (twice), 0 -> 2, 1 -> 2, 2 -> 0. */
+static auto make_test_graph(void) {
+    return graphle::test::v_list_out_edge_graph::from_ve_list(graphle::test::ve_list_graph {
+        .vertices = { { 0 }, { 1 }, { 2 } },
+        .edges    = { { { 0 }, { 1 } }, { { 0 }, { 1 } }, { { 0 }, { 2 } }, { { 1 }, { 2 } }, { { 2 }, { 0 } } }
+    });
+}
+
+
+/**
+ * @test compact_graph::edge_ids
+ * Checks that every edge of a compact graph, including parallel edges, has a distinct id, and that the out edges of every vertex have consecutive ids.
+ */
+TEST(compact_graph, edge_ids) {
+    auto storage = make_test_graph();
+    auto compact = graphle::make_compact_graph(storage.view_as_graph());
+    auto g       = compact.view_as_graph();
+
+    static_assert(graphle::edge_id_graph<decltype(g)>);
+    ASSERT_TRUE(compact.num_edges() == 5);
+
+
+    std::vector<bool> seen(compact.num_edges(), false);
+
+    for (std::size_t v = 0; v < compact.num_vertices(); ++v) {
+        std::size_t expected = compact.out_edge_ids(v).empty() ? 0 : compact.out_edge_ids(v).front();
+
+        for (auto edge : g.get_out_edges(compact.vertex_at(v))) {
+            const auto id = g.get_edge_id(edge);
+
+            ASSERT_TRUE(id == expected++);
+            ASSERT_FALSE(seen[id]);
+            seen[id] = true;
+
+            ASSERT_TRUE(compact.source_of(id) == v);
+            ASSERT_TRUE(compact.vertex_at(compact.target_of(id)) == edge.second);
+        }
+    }
+
+
+    // Edges from the edge list carry the same ids as the out edges.
+    for (auto edge : g.get_edges()) {
+        ASSERT_TRUE(compact.edge_at(edge.edge_id).first == edge.first);
+        ASSERT_TRUE(compact.edge_at(edge.edge_id).second == edge.second);
+    }
+}
+
+
+/**
+ * @test compact_graph::edge_property_map
+ * Checks that an edge property map stores separate values for parallel edges and can be used as an edge value getter.
+ */
+TEST(compact_graph, edge_property_map) {
+    auto storage = make_test_graph();
+    auto compact = graphle::make_compact_graph(storage.view_as_graph());
+    auto g       = compact.view_as_graph();
+
+    auto weights = graphle::make_edge_property_map(g, 0.0f);
+    static_assert(graphle::edge_value_getter<decltype(weights), graphle::test::v_list_out_edge_graph::vertex, float>);
+
+    ASSERT_TRUE(weights.num_slots() == compact.num_edges());
+
+
+    auto* v0 = compact.vertex_at(0);
+    float weight = 1.0f;
+
+    for (auto edge : g.get_out_edges(v0)) {
+        weights.set(edge, weight);
+        weight *= 2.0f;
+    }
+
+    // Both parallel edges 0 -> 1 keep their own weight.
+    float sum = 0.0f;
+    for (auto edge : g.get_out_edges(v0)) sum += weights(edge);
+    ASSERT_TRUE(sum == 7.0f);
+
+    // The weights of the out edges of a vertex are contiguous in the column.
+    const auto ids = compact.out_edge_ids(0);
+    ASSERT_TRUE(weights.column()[ids.front()] == 1.0f);
+    ASSERT_TRUE(weights.column()[ids.back()] == 4.0f);
+
+    // Edges without an id have the default value.
+    ASSERT_TRUE(weights(std::pair { v0, compact.vertex_at(1) }) == 0.0f);
+}
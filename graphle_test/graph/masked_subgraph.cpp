@@ -0,0 +1,136 @@
+#include <test_framework.hpp>
+#include <test_datastructures.hpp>
+#include <graphle.hpp>
+
+#include <algorithm>
+#include <vector>
+
+
+/** Returns a graph 0 -> 1, 0 -> 2, 1 -> 3, 2 -> 3, 3 -> 4, 4 -> 0. */
+static auto make_test_graph(void) {
+    return graphle::test::v_list_out_edge_graph::from_ve_list(graphle::test::ve_list_graph {
+        .vertices = { { 0 }, { 1 }, { 2 }, { 3 }, { 4 } },
+        .edges    = { { { 0 }, { 1 } }, { { 0 }, { 2 } }, { { 1 }, { 3 } }, { { 2 }, { 3 } }, { { 3 }, { 4 } }, { { 4 }, { 0 } } }
+    });
+}
+
+
+/** Returns a mask with the given bits set. */
+static graphle::util::dynamic_bitset make_mask(std::size_t size, std::initializer_list<std::size_t> bits) {
+    graphle::util::dynamic_bitset result { size };
+    for (auto bit : bits) result.set(bit);
+
+    return result;
+}
+
+
+/**
+ * @test masked_subgraph::induced
+ * Checks that an induced subgraph only contains the masked vertices and the edges between them, and can be searched like any other graph.
+ */
+TEST(masked_subgraph, induced) {
+    using vertex = graphle::test::v_list_out_edge_graph::vertex;
+
+    auto storage = make_test_graph();
+    graphle::graph base {
+        .deduce_vertex_type = graphle::meta::deduce_as<vertex>,
+        .get_vertices       = [&] { return graphle::views::all(storage.vertices) | graphle::views::transform(graphle::util::addressof); },
+        .get_out_edges      = [] (vertex* v) { return graphle::views::all(v->out) | graphle::views::edge_from(v); },
+        .get_vertex_id      = [] (vertex* v) { return v->vertex_id; }
+    };
+
+    static_assert(graphle::contiguous_out_neighbors_graph<decltype(base)>);
+
+
+    // Remove vertex 1.
+    auto subgraph = graphle::make_induced_subgraph(base, make_mask(5, { 0, 2, 3, 4 }));
+    auto g        = subgraph.view_as_graph();
+
+    ASSERT_TRUE(subgraph.num_vertices() == 4);
+    ASSERT_TRUE(std::ranges::size(g.get_vertices()) == 4);
+    ASSERT_TRUE(subgraph.out_degree(&storage.vertices[0]) == 1);
+    ASSERT_TRUE(graphle::util::out_degree(g, &storage.vertices[0]) == 1);
+    ASSERT_TRUE(std::ranges::distance(g.get_out_edges(&storage.vertices[0])) == 1);
+    ASSERT_TRUE((*g.get_out_edges(&storage.vertices[0]).begin()).second == &storage.vertices[2]);
+
+
+    std::vector<std::size_t> visited;
+    graphle::search::breadth_first_search(g, &storage.vertices[0], graphle::search::visitor_from_arguments {
+        .deduce_graph_type = graphle::meta::deduce_as<decltype(g)>,
+        .discover_vertex   = [&] (vertex* v, auto& g) { visited.push_back(v->vertex_id); }
+    });
+
+    ASSERT_TRUE(visited == (std::vector<std::size_t> { 0, 2, 3, 4 }));
+
+
+    // Removing vertex 3 disconnects vertex 4.
+    auto disconnected = graphle::make_induced_subgraph(base, make_mask(5, { 0, 1, 2, 4 }));
+    auto h            = disconnected.view_as_graph();
+
+    visited.clear();
+    graphle::search::breadth_first_search(h, &storage.vertices[0], graphle::search::visitor_from_arguments {
+        .deduce_graph_type = graphle::meta::deduce_as<decltype(h)>,
+        .discover_vertex   = [&] (vertex* v, auto& g) { visited.push_back(v->vertex_id); }
+    });
+
+    ASSERT_TRUE(visited == (std::vector<std::size_t> { 0, 1, 2 }));
+}
+
+
+/**
+ * @test masked_subgraph::filtered
+ * Checks that a subgraph with an edge mask only contains the masked edges between masked vertices.
+ */
+TEST(masked_subgraph, filtered) {
+    auto storage = make_test_graph();
+    auto compact = graphle::make_compact_graph(storage.view_as_graph());
+    auto base    = compact.view_as_graph();
+
+    static_assert(graphle::vertex_id_graph<decltype(base)>);
+
+
+    // Keep every edge except the edges from vertex 0.
+    graphle::util::dynamic_bitset edges { compact.num_edges() };
+    edges.set_all();
+    for (auto id : compact.out_edge_ids(0)) edges.reset(id);
+
+    auto subgraph = graphle::make_filtered_subgraph(base, make_mask(5, { 0, 1, 2, 3, 4 }), std::move(edges));
+    auto g        = subgraph.view_as_graph();
+
+    static_assert(graphle::edge_id_graph<decltype(g)>);
+
+    ASSERT_TRUE(subgraph.out_degree(compact.vertex_at(0)) == 0);
+    ASSERT_TRUE(std::ranges::empty(g.get_out_edges(compact.vertex_at(0))));
+    ASSERT_TRUE(subgraph.out_degree(compact.vertex_at(4)) == 1);
+
+    for (auto edge : g.get_out_edges(compact.vertex_at(3))) {
+        ASSERT_TRUE(g.get_edge_id(edge) == compact.out_edge_ids(3).front());
+        ASSERT_TRUE(edge.second == compact.vertex_at(4));
+    }
+}
+
+
+/**
+ * @test masked_subgraph::sparse_mask
+ * Checks that the vertices of a subgraph whose mask spans several words, most of them empty, are found in order of their ids.
+ */
+TEST(masked_subgraph, sparse_mask) {
+    graphle::test::ve_list_graph list;
+    for (std::size_t i = 0; i < 300; ++i) list.vertices.push_back({ i });
+    for (std::size_t i = 0; i < 299; ++i) list.edges.push_back({ { i }, { i + 1 } });
+
+    auto storage = graphle::test::v_list_out_edge_graph::from_ve_list(list);
+    auto compact = graphle::make_compact_graph(storage.view_as_graph());
+
+    auto subgraph = graphle::make_induced_subgraph(compact.view_as_graph(), make_mask(300, { 3, 150, 151, 299 }));
+    auto g        = subgraph.view_as_graph();
+
+
+    std::vector<std::size_t> ids;
+    for (auto v : g.get_vertices()) ids.push_back(compact.index_of(v));
+
+    ASSERT_TRUE(std::ranges::size(g.get_vertices()) == 4);
+    ASSERT_TRUE(ids == (std::vector<std::size_t> { 3, 150, 151, 299 }));
+    ASSERT_TRUE(subgraph.out_degree(compact.vertex_at(150)) == 1);
+    ASSERT_TRUE(subgraph.out_degree(compact.vertex_at(151)) == 0);
+}
@@ -0,0 +1,88 @@
+#include <test_framework.hpp>
+#include <graphle.hpp>
+
+#include <array>
+
+
+using graphle::static_edge;
+
+
+// Same graph as make_cyclic_graph in test_data.hpp.
+constexpr inline auto cyclic_graph = graphle::make_static_graph<9>(std::array {
+    static_edge { 0, 2 },
+    static_edge { 1, 3 },
+    static_edge { 3, 4 }, static_edge { 4, 5 }, static_edge { 5, 6 }, static_edge { 6, 2 }, static_edge { 2, 3 },
+    static_edge { 6, 7 }, static_edge { 7, 8 }, static_edge { 8, 5 }
+});
+
+// Same graph as make_dag_graph in test_data.hpp.
+constexpr inline auto dag_graph = graphle::make_static_graph<9>(std::array {
+    static_edge { 0, 2 }, static_edge { 2, 6 }, static_edge { 6, 7 },
+    static_edge { 1, 3 }, static_edge { 3, 4 }, static_edge { 4, 5 }, static_edge { 5, 8 },
+    static_edge { 2, 3 },
+    static_edge { 5, 6 }
+});
+
+
+/** Returns true if every edge of the graph goes from an earlier to a later vertex in the given order. */
+template <std::size_t N, std::size_t E>
+constexpr bool is_topological_order(const graphle::static_graph<N, E>& graph, const std::array<std::size_t, N>& order) {
+    std::array<std::size_t, N> position {};
+    for (std::size_t i = 0; i < N; ++i) position[order[i]] = i;
+
+    for (std::size_t v = 0; v < N; ++v) {
+        for (auto w : graph.out_neighbors(v)) {
+            if (position[v] >= position[w]) return false;
+        }
+    }
+
+    return true;
+}
+
+
+/** A chain of N vertices where every vertex also has an edge back to the start of its block of BlockSize vertices. */
+template <std::size_t N, std::size_t BlockSize> constexpr auto make_block_cycle_graph(void) {
+    std::array<static_edge, 2 * N - 1> edges {};
+    std::size_t count = 0;
+
+    for (std::size_t v = 0; v + 1 < N; ++v) edges[count++] = { v, v + 1 };
+    for (std::size_t v = 0; v < N; ++v) edges[count++] = { v, v - v % BlockSize };
+
+    return graphle::make_static_graph<N>(edges);
+}
+
+
+static_assert(graphle::alg::strongly_connected_components(cyclic_graph).count_components(2) == 1);
+static_assert(graphle::alg::strongly_connected_components(cyclic_graph).same_component(2, 8));
+static_assert(!graphle::alg::strongly_connected_components(cyclic_graph).same_component(0, 2));
+static_assert(!graphle::alg::is_acyclic(cyclic_graph));
+
+static_assert(graphle::alg::strongly_connected_components(dag_graph).num_components == 9);
+static_assert(is_topological_order(dag_graph, *graphle::alg::topological_sort(dag_graph)));
+
+static_assert(graphle::alg::is_reachable(dag_graph, 1, 7));
+static_assert(!graphle::alg::is_reachable(dag_graph, 7, 1));
+
+// Self-loops are cycles too.
+static_assert(!graphle::alg::is_acyclic(graphle::make_static_graph<1>(std::array { static_edge { 0, 0 } })));
+static_assert(graphle::alg::is_acyclic(graphle::make_static_graph<0>()));
+
+
+/**
+ * @test static_graph::compile_time_scale
+ * Checks that algorithms on larger static graphs can be evaluated at compile time.
+ */
+TEST(static_graph, compile_time_scale) {
+    constexpr auto graph      = make_block_cycle_graph<512, 16>();
+    constexpr auto components = graphle::alg::strongly_connected_components(graph);
+
+    static_assert(components.num_components == 512 / 16);
+    static_assert(components.component_sizes[0] == 16);
+    static_assert(graphle::alg::is_reachable(graph, 0, 511));
+
+
+    // The same results should be produced at runtime.
+    auto runtime_graph = graph;
+    ASSERT_TRUE(graphle::alg::strongly_connected_components(runtime_graph).num_components == components.num_components);
+    ASSERT_FALSE(graphle::alg::topological_sort(runtime_graph).has_value());
+}
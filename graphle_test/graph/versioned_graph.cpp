@@ -0,0 +1,227 @@
+#include <test_framework.hpp>
+#include <graphle.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+
+using versioned_graph = graphle::versioned_graph<int, 4>;
+
+
+/** Returns the values of the out-neighbours of the given vertex in the given snapshot, in ascending order. */
+static std::vector<int> out_values(const versioned_graph::snapshot& s, const versioned_graph::vertex* v) {
+    std::vector<int> result;
+    for (auto edge : s.view_as_graph().get_out_edges(v)) result.push_back(edge.second->value);
+
+    std::ranges::sort(result);
+    return result;
+}
+
+
+/**
+ * @test versioned_graph::snapshot_isolation
+ * Checks that modifications made after a snapshot was pinned are not visible through that snapshot.
+ */
+TEST(versioned_graph, snapshot_isolation) {
+    versioned_graph g;
+
+    auto a = g.add_vertex(0);
+    auto b = g.add_vertex(1);
+    auto c = g.add_vertex(2);
+    g.add_edge(a, b);
+    g.publish();
+
+    auto first = g.pin();
+
+    g.add_edge(b, c);
+    g.remove_edge(a, b);
+    auto d = g.add_vertex(3);
+    g.add_edge(a, d);
+
+    // Unpublished changes should not be visible.
+    ASSERT_TRUE(g.pin().version() == first.version());
+
+    g.publish();
+    auto second = g.pin();
+
+
+    ASSERT_TRUE(first.num_vertices() == 3);
+    ASSERT_TRUE(out_values(first, a) == std::vector { 1 });
+    ASSERT_TRUE(out_values(first, b).empty());
+    ASSERT_FALSE(first.contains(d));
+
+    ASSERT_TRUE(second.num_vertices() == 4);
+    ASSERT_TRUE(out_values(second, a) == std::vector { 3 });
+    ASSERT_TRUE(out_values(second, b) == std::vector { 2 });
+    ASSERT_TRUE(second.in_neighbors(c).size() == 1 && second.in_neighbors(c).front() == b);
+}
+
+
+/**
+ * @test versioned_graph::remove_vertex
+ * Checks that removing a vertex removes all edges to and from it in the next snapshot only.
+ */
+TEST(versioned_graph, remove_vertex) {
+    versioned_graph g;
+
+    std::vector<versioned_graph::vertex*> vs;
+    for (int i = 0; i < 10; ++i) vs.push_back(g.add_vertex(i));
+    for (int i = 0; i < 9; ++i) g.add_edge(vs[i], vs[i + 1]);
+    g.publish();
+
+    auto before = g.pin();
+
+    g.remove_vertex(vs[5]);
+    g.publish();
+
+    auto after = g.pin();
+
+
+    ASSERT_TRUE(before.num_vertices() == 10);
+    ASSERT_TRUE(out_values(before, vs[4]) == std::vector { 5 });
+
+    ASSERT_TRUE(after.num_vertices() == 9);
+    ASSERT_TRUE(out_values(after, vs[4]).empty());
+    ASSERT_TRUE(after.in_neighbors(vs[6]).empty());
+    ASSERT_TRUE(std::ranges::distance(after.view_as_graph().get_vertices()) == 9);
+}
+
+
+/**
+ * @test versioned_graph::reclamation
+ * Checks that old snapshots are only reclaimed once they are no longer pinned.
+ */
+TEST(versioned_graph, reclamation) {
+    versioned_graph g;
+
+    auto a = g.add_vertex(0);
+    auto b = g.add_vertex(1);
+    g.publish();
+
+    {
+        auto pinned = g.pin();
+
+        g.add_edge(a, b);
+        g.publish();
+        g.remove_vertex(b);
+        g.publish();
+
+        ASSERT_TRUE(g.num_retired_snapshots() > 0);
+        ASSERT_TRUE(pinned.contains(b));
+        ASSERT_TRUE(out_values(pinned, a).empty());
+    }
+
+    g.collect();
+    ASSERT_TRUE(g.num_retired_snapshots() == 0);
+}
+
+
+/**
+ * @test versioned_graph::search_snapshot
+ * Runs a breadth first search on a snapshot while the graph is being modified.
+ */
+TEST(versioned_graph, search_snapshot) {
+    versioned_graph g;
+
+    std::vector<versioned_graph::vertex*> vs;
+    for (int i = 0; i < 6; ++i) vs.push_back(g.add_vertex(i));
+    for (int i = 0; i < 5; ++i) g.add_edge(vs[i], vs[i + 1]);
+    g.publish();
+
+    auto snapshot = g.pin();
+    auto view     = snapshot.view_as_graph();
+
+    g.remove_edge(vs[2], vs[3]);
+    g.publish();
+
+
+    std::vector<int> visited;
+
+    graphle::search::breadth_first_search(
+        view,
+        vs[0],
+        graphle::search::visitor_from_arguments {
+            .deduce_graph_type = graphle::meta::deduce_as<decltype(view)>,
+            .discover_vertex   = [&] (auto v, auto& g) { visited.push_back(v->value); }
+        }
+    );
+
+    ASSERT_TRUE(visited == (std::vector { 0, 1, 2, 3, 4, 5 }));
+}
+
+
+/**
+ * @test versioned_graph::concurrent_readers
+ * Pins snapshots on several reader threads while the writer keeps modifying and publishing the graph,
+ * and checks that every pinned snapshot matches the version it was published as for as long as it is pinned.
+ */
+TEST(versioned_graph, concurrent_readers) {
+    constexpr int num_rounds  = 2000;
+    constexpr int num_readers = 4;
+
+    versioned_graph g;
+
+    // Version 1 contains only the root. Round r publishes version r + 1, in which the root has a single edge to a vertex with value r.
+    // The vertex of the previous round is removed, so its slot is reused once no reader has the previous snapshot pinned anymore.
+    auto root = g.add_vertex(-1);
+    g.publish();
+
+
+    std::atomic<bool> done       = false;
+    std::atomic<bool> consistent = true;
+    std::atomic<int>  num_checks = 0;
+
+    auto check_snapshot = [&] (const versioned_graph::snapshot& s) {
+        const auto version = (int) s.version();
+
+        if (version == 1) return s.num_vertices() == 1 && s.out_neighbors(root).empty();
+        if (s.num_vertices() != 2 || out_values(s, root) != std::vector { version - 1 }) return false;
+
+        const auto* target = s.out_neighbors(root).front();
+        return s.contains(target) && s.in_neighbors(target).size() == 1 && s.in_neighbors(target).front() == root;
+    };
+
+
+    std::vector<std::thread> readers;
+
+    for (int i = 0; i < num_readers; ++i) {
+        readers.emplace_back([&] {
+            while (!done.load()) {
+                auto s = g.pin();
+
+                // Check the snapshot twice, giving the writer a chance to publish and collect in between.
+                bool ok = check_snapshot(s);
+                std::this_thread::yield();
+                ok = ok && check_snapshot(s);
+
+                if (!ok) consistent.store(false);
+                ++num_checks;
+            }
+        });
+    }
+
+
+    versioned_graph::vertex* previous = nullptr;
+
+    for (int r = 1; r <= num_rounds; ++r) {
+        auto next = g.add_vertex(r);
+        g.add_edge(root, next);
+        if (previous) g.remove_vertex(previous);
+
+        g.publish();
+        previous = next;
+    }
+
+    done.store(true);
+    for (auto& reader : readers) reader.join();
+
+
+    ASSERT_TRUE(consistent.load());
+    ASSERT_TRUE(num_checks.load() > 0);
+    ASSERT_TRUE(check_snapshot(g.pin()));
+
+    g.collect();
+    ASSERT_TRUE(g.num_retired_snapshots() == 0);
+}
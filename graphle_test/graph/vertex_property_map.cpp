@@ -0,0 +1,106 @@
+#include <test_framework.hpp>
+#include <test_datastructures.hpp>
+#include <graphle.hpp>
+
+#include <cstdint>
+#include <vector>
+
+
+/**
+ * @test vertex_property_map::dense_ids
+ * Checks that a property map for a graph with vertex ids stores the properties of each vertex at the index of its id.
+ */
+TEST(vertex_property_map, dense_ids) {
+    struct vertex { std::size_t vertex_id; };
+    std::vector<vertex> vertices { { 0 }, { 1 }, { 2 }, { 3 } };
+
+    graphle::graph g {
+        .deduce_vertex_type = graphle::meta::deduce_as<vertex>,
+        .get_vertices       = [&] { return graphle::views::all(vertices) | graphle::views::transform(graphle::util::addressof); },
+        .get_vertex_id      = [] (vertex* v) { return v->vertex_id; }
+    };
+
+    static_assert(graphle::vertex_id_graph<decltype(g)>);
+
+
+    auto map = graphle::make_vertex_property_map(g, 0.0f, std::uint8_t { 0 });
+    static_assert(decltype(map)::uses_vertex_id);
+
+    ASSERT_TRUE(map.num_slots() == 4);
+    ASSERT_TRUE(map.value(&vertices[2]) == 0.0f);
+
+    map.set(&vertices[2], 2.5f);
+    map.get<1>(&vertices[3]) = 1;
+
+    ASSERT_TRUE(map.column()[2] == 2.5f);
+    ASSERT_TRUE(map.column<1>()[3] == 1);
+    ASSERT_TRUE(map(&vertices[2]) == 2.5f);
+
+
+    // Bulk writes through the column are visible through per-vertex reads.
+    for (auto& value : map.column()) value += 1.0f;
+    ASSERT_TRUE(map.value(&vertices[0]) == 1.0f);
+    ASSERT_TRUE(map.value(&vertices[2]) == 3.5f);
+
+    map.reset();
+    ASSERT_TRUE(map.value(&vertices[2]) == 0.0f);
+    ASSERT_TRUE(map.value<1>(&vertices[3]) == 0);
+}
+
+
+/**
+ * @test vertex_property_map::hashed
+ * Checks that a property map for a graph without vertex ids assigns slots to vertices on first access.
+ */
+TEST(vertex_property_map, hashed) {
+    auto storage = graphle::test::v_list_out_edge_graph::from_ve_list(graphle::test::ve_list_graph {
+        .vertices = { { 0 }, { 1 }, { 2 } },
+        .edges    = { { { 0 }, { 1 } }, { { 1 }, { 2 } } }
+    });
+
+    auto g = storage.view_as_graph();
+    static_assert(!graphle::vertex_id_graph<decltype(g)>);
+
+    auto map = graphle::make_vertex_property_map(g, -1);
+    static_assert(!decltype(map)::uses_vertex_id);
+
+    auto* a = &storage.vertices[0];
+    auto* b = &storage.vertices[2];
+
+    ASSERT_FALSE(map.contains(a));
+    ASSERT_TRUE(map.value(a) == -1);
+
+    map.set(b, 7);
+    map.set(a, 3);
+
+    ASSERT_TRUE(map.num_slots() == 2);
+    ASSERT_TRUE(map.vertex_at(0) == b);
+    ASSERT_TRUE(map.column()[map.find_slot(a)] == 3);
+    ASSERT_TRUE(map(b) == 7);
+    ASSERT_FALSE(map.contains(&storage.vertices[1]));
+}
+
+
+/**
+ * @test vertex_property_map::capturing_id_getter
+ * Checks that a property map can be constructed for graphs whose vertex id getter is a capturing lambda, like the view of a compact graph.
+ */
+TEST(vertex_property_map, capturing_id_getter) {
+    auto storage = graphle::test::v_list_out_edge_graph::from_ve_list(graphle::test::ve_list_graph {
+        .vertices = { { 0 }, { 1 }, { 2 } },
+        .edges    = { { { 0 }, { 1 } }, { { 1 }, { 2 } } }
+    });
+
+    auto compact = graphle::make_compact_graph(storage.view_as_graph());
+    auto g       = compact.view_as_graph();
+
+    auto map = graphle::make_vertex_property_map(g, 0.0f);
+    static_assert(decltype(map)::uses_vertex_id);
+
+    ASSERT_TRUE(map.num_slots() == 3);
+
+    map.set(compact.vertex_at(1), 1.5f);
+    ASSERT_TRUE(map.column()[1] == 1.5f);
+    ASSERT_TRUE(map(compact.vertex_at(1)) == 1.5f);
+    ASSERT_TRUE(map(compact.vertex_at(2)) == 0.0f);
+}
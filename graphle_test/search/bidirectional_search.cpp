@@ -0,0 +1,82 @@
+#include <test_framework.hpp>
+#include <test_data.hpp>
+#include <graphle.hpp>
+
+#include <vector>
+
+
+/** Datastructures both with in edges, and without in edges, for which the in edges are gathered by the search. */
+using datastructures = graphle::meta::type_list<
+    graphle::test::v_list_out_edge_graph,
+    graphle::test::v_list_in_out_edge_graph
+>;
+
+
+/**
+ * @test bidirectional_search::shortest_paths
+ * Finds a path between every pair of vertices of every test graph, and checks that the path connects the vertices
+ * and has the same length as the distance found by a breadth first search.
+ */
+TEST(bidirectional_search, shortest_paths) {
+    datastructures::foreach([] <typename DS> {
+        for (const auto& src : graphle::test::make_graphs()) {
+            auto structure = DS::from_ve_list(src);
+            auto graph     = structure.view_as_graph();
+
+            std::vector<graphle::vertex_of<decltype(graph)>> vertices;
+            for (auto& vertex : structure.vertices) vertices.push_back(&vertex);
+
+            const auto distances = graphle::search::multi_source_distances(graph, vertices);
+
+
+            for (std::size_t i = 0; i < vertices.size(); ++i) {
+                for (auto* target : vertices) {
+                    const auto path     = graphle::search::bidirectional_shortest_path(graph, vertices[i], target);
+                    const auto distance = distances.distance(i, target);
+
+                    ASSERT_TRUE(path.has_value() == (distance != distances.unreached));
+                    if (!path) continue;
+
+                    ASSERT_TRUE(path->size() == distance);
+                    if (path->empty()) continue;
+
+                    ASSERT_TRUE(path->front().first == vertices[i]);
+                    ASSERT_TRUE(path->back().second == target);
+
+                    for (std::size_t j = 1; j < path->size(); ++j) ASSERT_TRUE((*path)[j - 1].second == (*path)[j].first);
+                }
+            }
+        }
+    });
+}
+
+
+/**
+ * @test bidirectional_search::budget
+ * Checks that the search is cancelled once its budget is exhausted, and finds the path when its budget is exhausted by the last layer.
+ */
+TEST(bidirectional_search, budget) {
+    graphle::test::ve_list_graph src;
+    for (std::size_t i = 0; i < 100; ++i) src.vertices.push_back({ i });
+    for (std::size_t i = 0; i + 1 < 100; ++i) src.edges.emplace_back(src.vertices[i], src.vertices[i + 1]);
+
+    auto structure = graphle::test::v_list_in_out_edge_graph::from_ve_list(src);
+    auto graph     = structure.view_as_graph();
+
+    auto* source = &structure.vertices[0];
+    auto* target = &structure.vertices[99];
+
+
+    auto [cancelled_status, cancelled_path] = graphle::search::bidirectional_shortest_path(graph, source, target, graphle::util::work_budget::of_work(1));
+    ASSERT_TRUE(cancelled_status == graphle::util::run_status::CANCELLED);
+    ASSERT_FALSE(cancelled_path.has_value());
+
+
+    graphle::util::work_budget measure;
+    ASSERT_TRUE(graphle::search::bidirectional_shortest_path(graph, source, target, measure).first == graphle::util::run_status::FINISHED);
+    const std::size_t total = graphle::util::work_budget {}.get_remaining_work() - measure.get_remaining_work();
+
+    auto [exact_status, exact_path] = graphle::search::bidirectional_shortest_path(graph, source, target, graphle::util::work_budget::of_work(total));
+    ASSERT_TRUE(exact_status == graphle::util::run_status::FINISHED);
+    ASSERT_TRUE(exact_path.has_value() && exact_path->size() == 99);
+}
@@ -233,4 +233,157 @@ TEST(bfs, visit_size_one) {
         expected_visit_order,
         [] (auto&&... args) { graphle::search::breadth_first_search(GRAPHLE_FWD(args)...); }
     );
-}
\ No newline at end of file
+}
+
+/**
+ * @test bfs::batched_layers
+ * Visits a tree-like graph using the batched BFS and asserts every layer is passed to the visitor in a single batch,
+ * together with the edges through which the next layer is reached.
+ */
+TEST(bfs, batched_layers) {
+    const auto tree = graphle::test::make_tree_graph();
+
+    auto expected_visit_order = graphle::test::vertex_order {
+        vertex_list { 0 },
+        vertex_list { 1 },
+        vertex_list { 2, 5 },
+        vertex_list { 3, 6 },
+        vertex_list { 4, 7, 8, 9, 10 },
+    };
+
+
+    SUBTEST_SCOPE("visit_order") {
+        graphle::test::test_visit_order<graphle::test::datastructure_list>(
+            tree,
+            0,
+            expected_visit_order,
+            [] (auto&&... args) { graphle::search::batched_breadth_first_search(GRAPHLE_FWD(args)...); }
+        );
+    }
+
+
+    SUBTEST_SCOPE("batches") {
+        auto structure = graphle::test::v_list_out_edge_graph::from_ve_list(tree);
+        auto graph     = structure.view_as_graph();
+        using graph_t  = decltype(graph);
+
+        struct layer_visitor : graphle::search::search_visitor<layer_visitor, graph_t> {
+            graphle::test::vertex_order layers;
+            std::vector<std::size_t> new_edges_per_layer;
+            std::size_t current_depth = 0;
+
+            void begin_layer(std::size_t depth, graph_t& g) {
+                current_depth = depth;
+                layers.emplace_back();
+            }
+
+            void discover_vertices(std::span<const graphle::vertex_of<graph_t>> vertices, graph_t& g) {
+                for (auto* v : vertices) layers.back().push_back(v->vertex_id);
+            }
+
+            void discover_edges_to_new_vertices(std::span<const graphle::edge_of<graph_t>> edges, graph_t& g) {
+                new_edges_per_layer.push_back(edges.size());
+            }
+
+            void finish_layer(std::size_t depth, graph_t& g) {
+                ASSERT_TRUE(depth == current_depth);
+            }
+        };
+
+
+        layer_visitor visitor;
+        ASSERT_TRUE(graphle::search::batched_breadth_first_search(graph, &structure.vertices[0], visitor));
+
+        ASSERT_TRUE(visitor.layers.size() == expected_visit_order.size());
+
+        for (std::size_t i = 0; i < visitor.layers.size(); ++i) {
+            std::ranges::sort(visitor.layers[i]);
+            ASSERT_TRUE(visitor.layers[i] == expected_visit_order[i]);
+
+            const std::size_t next_size = i + 1 < expected_visit_order.size() ? expected_visit_order[i + 1].size() : 0;
+            ASSERT_TRUE(visitor.new_edges_per_layer[i] == next_size);
+        }
+
+
+        // The layer and edge storage can be provided, in which case the same batches are produced.
+        layer_visitor provided;
+
+        ASSERT_TRUE(graphle::search::batched_breadth_first_search(
+            graph,
+            &structure.vertices[0],
+            provided,
+            graphle::store::get_default_storage_provider<graphle::store::storage_type::UNORDERED_SET, graphle::vertex_of<graph_t>, graphle::vertex_hash_of<graph_t>, graphle::vertex_compare_of<graph_t>>(),
+            graphle::store::get_default_storage_provider<graphle::store::storage_type::VECTOR, graphle::vertex_of<graph_t>>(),
+            graphle::store::get_default_storage_provider<graphle::store::storage_type::VECTOR, graphle::edge_of<graph_t>>()
+        ));
+
+        for (auto& layer : provided.layers) std::ranges::sort(layer);
+        ASSERT_TRUE(provided.layers == visitor.layers);
+        ASSERT_TRUE(provided.new_edges_per_layer == visitor.new_edges_per_layer);
+    }
+}
+
+
+/**
+ * @test bfs::batched_edges
+ * Checks that the regular BFS passes the edges to new vertices of every visited vertex to the visitor in a single batch.
+ */
+TEST(bfs, batched_edges) {
+    auto structure = graphle::test::v_list_out_edge_graph::from_ve_list(graphle::test::make_tree_graph());
+    auto graph     = structure.view_as_graph();
+    using graph_t  = decltype(graph);
+
+    struct edge_batch_visitor : graphle::search::search_visitor<edge_batch_visitor, graph_t> {
+        std::size_t num_batches = 0, num_edges = 0;
+
+        void discover_edges_to_new_vertices(std::span<const graphle::edge_of<graph_t>> edges, graph_t& g) {
+            for (const auto& edge : edges) ASSERT_TRUE(edge.first == edges.front().first);
+
+            ++num_batches;
+            num_edges += edges.size();
+        }
+    };
+
+
+    edge_batch_visitor visitor;
+    graphle::search::breadth_first_search(graph, &structure.vertices[0], visitor);
+
+    // Every vertex except the root is reached through one edge, and every vertex with children passes them in one batch.
+    ASSERT_TRUE(visitor.num_edges == structure.vertices.size() - 1);
+    ASSERT_TRUE(visitor.num_batches == std::ranges::count_if(structure.vertices, [] (const auto& v) { return !v.out.empty(); }));
+}
+
+
+/**
+ * @test bfs::batched_budget
+ * Checks that the batched BFS is cancelled once its budget is exhausted, and finishes when its budget is exhausted by the last layer.
+ */
+TEST(bfs, batched_budget) {
+    graphle::test::ve_list_graph src;
+    for (std::size_t i = 0; i < 100; ++i) src.vertices.push_back({ i });
+    for (std::size_t i = 0; i + 1 < 100; ++i) src.edges.emplace_back(src.vertices[i], src.vertices[i + 1]);
+
+    auto structure = graphle::test::v_list_out_edge_graph::from_ve_list(src);
+    auto graph     = structure.view_as_graph();
+    using graph_t  = decltype(graph);
+
+    struct layer_counter : graphle::search::search_visitor<layer_counter, graph_t> {
+        std::size_t layers = 0;
+        void begin_layer(std::size_t depth, graph_t& g) { ++layers; }
+    };
+
+
+    layer_counter cancelled;
+    ASSERT_TRUE(graphle::search::batched_breadth_first_search(graph, &structure.vertices[0], cancelled, graphle::util::work_budget::of_work(1)) == graphle::util::run_status::CANCELLED);
+    ASSERT_TRUE(cancelled.layers < 100);
+
+
+    layer_counter measured, exact;
+    graphle::util::work_budget measure;
+
+    ASSERT_TRUE(graphle::search::batched_breadth_first_search(graph, &structure.vertices[0], measured, measure) == graphle::util::run_status::FINISHED);
+    const std::size_t total = graphle::util::work_budget {}.get_remaining_work() - measure.get_remaining_work();
+
+    ASSERT_TRUE(graphle::search::batched_breadth_first_search(graph, &structure.vertices[0], exact, graphle::util::work_budget::of_work(total)) == graphle::util::run_status::FINISHED);
+    ASSERT_TRUE(measured.layers == 100 && exact.layers == 100);
+}
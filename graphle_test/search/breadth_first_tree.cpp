@@ -0,0 +1,143 @@
+#include <test_framework.hpp>
+#include <test_data.hpp>
+#include <graphle.hpp>
+
+#include <limits>
+#include <vector>
+
+
+/**
+ * @test bfs_tree::distances_and_paths
+ * Computes the BFS tree from every vertex of every test graph, and checks the distances against a multi-source BFS
+ * and that the path to every reached vertex is a path in the graph of the same length.
+ */
+TEST(bfs_tree, distances_and_paths) {
+    graphle::test::vertex_list_out_edges_datastructure_list::foreach([] <typename DS> {
+        for (const auto& src : graphle::test::make_graphs()) {
+            auto structure = DS::from_ve_list(src);
+            auto graph     = structure.view_as_graph();
+
+            std::vector<graphle::vertex_of<decltype(graph)>> vertices;
+            for (auto vertex : graph.get_vertices()) vertices.push_back(vertex);
+
+            if (vertices.empty()) continue;
+
+            const graphle::vertex_compare_of<decltype(graph)> equal {};
+
+
+            const auto expected = graphle::search::multi_source_distances(graph, vertices);
+            auto tree = graphle::search::breadth_first_tree(graph, vertices.front());
+
+            for (std::size_t i = 0; i < vertices.size(); ++i) {
+                // Reuse the tree for every root after the first.
+                if (i > 0) graphle::search::breadth_first_tree(graph, vertices[i], tree);
+
+                for (auto target : vertices) {
+                    ASSERT_TRUE(tree.distance_to(target) == expected.distance(i, target));
+                    ASSERT_TRUE(tree.reached(target) == (expected.distance(i, target) != expected.unreached));
+
+                    const auto path = tree.path_to(target);
+                    if (!tree.reached(target)) {
+                        ASSERT_TRUE(path.empty());
+                        continue;
+                    }
+
+                    ASSERT_TRUE(path.size() == tree.distance_to(target) + 1);
+                    ASSERT_TRUE(equal(path.front(), vertices[i]));
+                    ASSERT_TRUE(equal(path.back(), target));
+
+                    for (std::size_t j = 1; j < path.size(); ++j) {
+                        ASSERT_TRUE(equal(tree.parent_of(path[j]), path[j - 1]));
+                        ASSERT_TRUE(std::ranges::any_of(graphle::util::out_neighbors(graph, path[j - 1]), [&] (auto v) { return equal(v, path[j]); }));
+                    }
+                }
+            }
+        }
+    });
+}
+
+
+/**
+ * @test bfs_tree::property_map
+ * Checks that a BFS tree stored in a vertex property map has the same distances and parents as a @ref graphle::search::bfs_tree,
+ * both for graphs with vertex ids and for graphs without.
+ */
+TEST(bfs_tree, property_map) {
+    graphle::test::vertex_list_out_edges_datastructure_list::foreach([] <typename DS> {
+        for (const auto& src : graphle::test::make_graphs()) {
+            auto structure = DS::from_ve_list(src);
+            auto graph     = structure.view_as_graph();
+            auto compact   = graphle::make_compact_graph(graph);
+
+            using vertex = graphle::vertex_of<decltype(graph)>;
+            constexpr std::size_t unreached = std::numeric_limits<std::size_t>::max();
+
+
+            auto check = [&] (auto&& g) {
+                const graphle::vertex_compare_of<decltype(g)> equal {};
+
+                auto tree = graphle::make_vertex_property_map(g, unreached, vertex { nullptr });
+                auto distances = graphle::make_vertex_property_map(g, unreached);
+
+                for (auto root : g.get_vertices()) {
+                    const auto expected = graphle::search::breadth_first_tree(g, root);
+
+                    graphle::search::breadth_first_tree(g, root, tree);
+                    graphle::search::breadth_first_tree(g, root, distances);
+
+                    for (auto target : g.get_vertices()) {
+                        ASSERT_TRUE(tree.value(target) == expected.distance_to(target));
+                        ASSERT_TRUE(distances(target) == expected.distance_to(target));
+
+                        if (expected.reached(target) && !equal(target, root)) {
+                            ASSERT_TRUE(equal(tree.template value<1>(target), expected.parent_of(target)));
+                        }
+                    }
+                }
+            };
+
+            check(graph);
+            check(compact.view_as_graph());
+        }
+    });
+}
+
+
+/**
+ * @test bfs_tree::budget
+ * Checks that the search is cancelled once its budget is exhausted, and finishes when its budget is exhausted by the last vertex,
+ * both when storing its result in a @ref bfs_tree and in a vertex property map.
+ */
+TEST(bfs_tree, budget) {
+    graphle::test::ve_list_graph src;
+    for (std::size_t i = 0; i < 100; ++i) src.vertices.push_back({ i });
+    for (std::size_t i = 0; i + 1 < 100; ++i) src.edges.emplace_back(src.vertices[i], src.vertices[i + 1]);
+
+    auto structure = graphle::test::v_list_out_edge_graph::from_ve_list(src);
+    auto graph     = structure.view_as_graph();
+
+    auto* root = &structure.vertices[0];
+    auto* last = &structure.vertices[99];
+
+
+    auto [cancelled_status, cancelled] = graphle::search::breadth_first_tree(graph, root, graphle::util::work_budget::of_work(1));
+    ASSERT_TRUE(cancelled_status == graphle::util::run_status::CANCELLED);
+    ASSERT_FALSE(cancelled.reached(last));
+
+    graphle::util::work_budget measure;
+    ASSERT_TRUE(graphle::search::breadth_first_tree(graph, root, measure).first == graphle::util::run_status::FINISHED);
+    const std::size_t total = graphle::util::work_budget {}.get_remaining_work() - measure.get_remaining_work();
+
+    auto [exact_status, exact] = graphle::search::breadth_first_tree(graph, root, graphle::util::work_budget::of_work(total));
+    ASSERT_TRUE(exact_status == graphle::util::run_status::FINISHED);
+    ASSERT_TRUE(exact.distance_to(last) == 99);
+
+
+    auto distances = graphle::make_vertex_property_map(graph, std::numeric_limits<std::size_t>::max());
+
+    ASSERT_TRUE(graphle::search::breadth_first_tree(graph, root, distances, graphle::util::work_budget::of_work(1)) == graphle::util::run_status::CANCELLED);
+    ASSERT_TRUE(distances(last) == std::numeric_limits<std::size_t>::max());
+
+    ASSERT_TRUE(graphle::search::breadth_first_tree(graph, root, distances, graphle::util::work_budget::of_work(total)) == graphle::util::run_status::FINISHED);
+    ASSERT_TRUE(distances(last) == 99);
+}
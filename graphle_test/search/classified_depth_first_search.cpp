@@ -0,0 +1,171 @@
+#include <test_framework.hpp>
+#include <test_data.hpp>
+#include <graphle.hpp>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+
+enum class edge_kind { TREE, BACK, FORWARD, CROSS };
+
+
+/** Visitor which records every visited edge together with its classification. */
+template <typename G> struct classifying_visitor : graphle::search::search_visitor<classifying_visitor<G>, G> {
+    using edge = graphle::edge_of<G>;
+
+    std::vector<std::pair<edge, edge_kind>> edges;
+    std::size_t known_edges = 0;
+
+    void discover_edge_to_new_vertex(edge e, G& g)   { edges.emplace_back(e, edge_kind::TREE);    }
+    void discover_edge_to_known_vertex(edge e, G& g) { ++known_edges;                             }
+    void discover_back_edge(edge e, G& g)            { edges.emplace_back(e, edge_kind::BACK);    }
+    void discover_forward_edge(edge e, G& g)         { edges.emplace_back(e, edge_kind::FORWARD); }
+    void discover_cross_edge(edge e, G& g)           { edges.emplace_back(e, edge_kind::CROSS);   }
+};
+
+
+/** Visitor which checks that vertices are finished in post-order, and records the finishing order and the number of back edges. */
+template <typename G> struct order_visitor : graphle::search::search_visitor<order_visitor<G>, G> {
+    using vertex = graphle::vertex_of<G>;
+
+    std::vector<vertex> path, finished;
+    std::size_t back_edges = 0;
+
+    void discover_vertex(vertex v, G& g) { path.push_back(v); }
+    void discover_back_edge(graphle::edge_of<G> e, G& g) { ++back_edges; }
+
+    void finish_vertex(vertex v, G& g) {
+        // Every vertex is finished while it is the last vertex on the current path.
+        ASSERT_TRUE(!path.empty() && path.back() == v);
+
+        path.pop_back();
+        finished.push_back(v);
+    }
+};
+
+
+/**
+ * @test classified_dfs::edge_classification
+ * Checks that the classified DFS forest traversal visits every edge of every test graph exactly once,
+ * that every edge is classified consistently with the discovery and finishing times of its vertices,
+ * and that an edge is a back edge exactly if its source does not finish after its target.
+ */
+TEST(classified_dfs, edge_classification) {
+    graphle::test::vertex_list_out_edges_datastructure_list::foreach([] <typename DS> {
+        for (const auto& src : graphle::test::make_graphs()) {
+            auto structure = DS::from_ve_list(src);
+            auto graph     = structure.view_as_graph();
+            auto tree      = graphle::search::make_dfs_tree(graph);
+
+            const graphle::vertex_compare_of<decltype(graph)> equal {};
+
+
+            classifying_visitor<decltype(graph)> visitor;
+            ASSERT_TRUE(graphle::search::classified_depth_first_search_forest(graph, visitor, tree));
+
+            const auto& edges = visitor.edges;
+            ASSERT_TRUE(edges.size() == src.edges.size());
+            ASSERT_TRUE(visitor.known_edges == std::ranges::count_if(edges, [] (const auto& e) { return e.second != edge_kind::TREE; }));
+
+            for (auto vertex : graph.get_vertices()) {
+                ASSERT_TRUE(tree.discovered(vertex) && tree.finished(vertex));
+                ASSERT_TRUE(tree.discover_time_of(vertex) < tree.finish_time_of(vertex));
+            }
+
+            for (const auto& [edge, kind] : edges) {
+                const auto [source, target] = edge;
+
+                switch (kind) {
+                    case edge_kind::TREE:
+                        ASSERT_TRUE(tree.has_parent(target) && equal(tree.parent_of(target), source));
+                        break;
+                    case edge_kind::BACK:
+                        ASSERT_TRUE(tree.is_descendant_of(source, target));
+                        break;
+                    case edge_kind::FORWARD:
+                        ASSERT_TRUE(tree.is_descendant_of(target, source) && !equal(source, target));
+                        break;
+                    case edge_kind::CROSS:
+                        ASSERT_FALSE(tree.is_descendant_of(target, source) || tree.is_descendant_of(source, target));
+                        ASSERT_TRUE(tree.discover_time_of(target) < tree.discover_time_of(source));
+                        break;
+                }
+
+                ASSERT_TRUE((kind == edge_kind::BACK) == (tree.finish_time_of(source) <= tree.finish_time_of(target)));
+            }
+        }
+    });
+}
+
+
+/**
+ * @test classified_dfs::pre_and_post_order
+ * Checks that finish_vertex is invoked in post-order, and that the reverse finishing order of a DAG is a topological order,
+ * while a search of a cyclic graph discovers back edges.
+ */
+TEST(classified_dfs, pre_and_post_order) {
+    auto dag_structure    = graphle::test::v_list_out_edge_graph::from_ve_list(graphle::test::make_dag_graph());
+    auto cyclic_structure = graphle::test::v_list_out_edge_graph::from_ve_list(graphle::test::make_cyclic_graph());
+
+    auto dag    = dag_structure.view_as_graph();
+    auto cyclic = cyclic_structure.view_as_graph();
+
+    using G = decltype(dag);
+
+
+    auto dag_tree = graphle::search::make_dfs_tree(dag);
+    order_visitor<G> dag_visitor;
+
+    ASSERT_TRUE(graphle::search::classified_depth_first_search_forest(dag, dag_visitor, dag_tree));
+    ASSERT_TRUE(dag_visitor.back_edges == 0);
+    ASSERT_TRUE(dag_visitor.finished.size() == dag_structure.vertices.size());
+
+    for (auto& v : dag_structure.vertices) {
+        for (auto target : v.out) ASSERT_TRUE(dag_tree.finish_time_of(&v) > dag_tree.finish_time_of(target));
+    }
+
+
+    auto cyclic_tree = graphle::search::make_dfs_tree(cyclic);
+    order_visitor<G> cyclic_visitor;
+
+    ASSERT_TRUE(graphle::search::classified_depth_first_search(cyclic, &cyclic_structure.vertices[0], cyclic_visitor, cyclic_tree));
+    ASSERT_TRUE(cyclic_visitor.back_edges > 0);
+    ASSERT_TRUE(cyclic_visitor.path.empty());
+}
+
+
+/**
+ * @test classified_dfs::budget
+ * Checks that the classified DFS is cancelled once its budget is exhausted, leaving the vertices on the current path unfinished,
+ * and that the forest traversal finishes, rather than being cancelled, when its budget is exhausted by the last edge.
+ */
+TEST(classified_dfs, budget) {
+    auto structure = graphle::test::v_list_out_edge_graph::from_ve_list(graphle::test::make_cyclic_graph());
+    auto graph     = structure.view_as_graph();
+
+    using G = decltype(graph);
+
+
+    auto tree = graphle::search::make_dfs_tree(graph);
+    order_visitor<G> cancelled;
+
+    ASSERT_TRUE(graphle::search::classified_depth_first_search(graph, &structure.vertices[0], cancelled, tree, graphle::util::work_budget::of_work(1)) == graphle::util::run_status::CANCELLED);
+    ASSERT_TRUE(!cancelled.path.empty());
+    for (const auto v : cancelled.path) ASSERT_TRUE(tree.discovered(v) && !tree.finished(v));
+
+
+    auto wide_tree = graphle::search::make_dfs_tree<std::uint64_t>(graph);
+    order_visitor<G> measured;
+    graphle::util::work_budget measure;
+
+    ASSERT_TRUE(graphle::search::classified_depth_first_search_forest(graph, measured, wide_tree, measure) == graphle::util::run_status::FINISHED);
+    const std::size_t total = graphle::util::work_budget {}.get_remaining_work() - measure.get_remaining_work();
+
+
+    order_visitor<G> exact;
+    ASSERT_TRUE(graphle::search::classified_depth_first_search_forest(graph, exact, tree, graphle::util::work_budget::of_work(total)) == graphle::util::run_status::FINISHED);
+    ASSERT_TRUE(exact.finished == measured.finished);
+
+    for (auto& v : structure.vertices) ASSERT_TRUE(tree.finish_time_of(&v) == wide_tree.finish_time_of(&v));
+}
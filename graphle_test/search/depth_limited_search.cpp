@@ -0,0 +1,198 @@
+#include <test_framework.hpp>
+#include <test_data.hpp>
+#include <graphle.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <typeinfo>
+#include <vector>
+
+
+/** Returns a visitor which records the IDs of the discovered vertices and counts the started trees. */
+template <typename G> static auto make_recording_visitor(std::vector<std::size_t>& ids, std::size_t& trees) {
+    return graphle::search::visitor_from_arguments {
+        .deduce_graph_type = graphle::meta::deduce_as<G>,
+        .discover_vertex   = [&ids] (auto v, auto& g) { ids.push_back(v->vertex_id); },
+        .begin_tree        = [&trees] (auto v, auto& g) { ++trees; }
+    };
+}
+
+
+/**
+ * @test depth_limited_search::depth_limit
+ * Checks that the depth-limited search only visits vertices up to the given depth, and that iterative deepening
+ * searches every depth limit until no vertex at the limit has out edges, for every datastructure.
+ */
+TEST(depth_limited_search, depth_limit) {
+    graphle::test::vertex_list_datastructure_list::foreach([] <typename DS> {
+        SUBTEST_SCOPE(typeid(DS).name()) {
+            auto structure = DS::from_ve_list(graphle::test::make_tree_graph());
+            auto graph     = structure.view_as_graph();
+            auto root      = graphle::util::find_vertex(graph, [] (auto v) { return v->vertex_id == 0; });
+
+            using G = decltype(graph);
+
+
+            std::vector<std::size_t> ids;
+            std::size_t trees = 0;
+
+            ASSERT_TRUE(graphle::search::depth_limited_search(graph, root, make_recording_visitor<G>(ids, trees), 2));
+            std::ranges::sort(ids);
+
+            ASSERT_TRUE(ids == (std::vector<std::size_t> { 0, 1, 2, 5 }));
+            ASSERT_TRUE(trees == 1);
+
+
+            ids.clear();
+            trees = 0;
+
+            ASSERT_TRUE(graphle::search::iterative_deepening_search(graph, root, make_recording_visitor<G>(ids, trees)));
+            ASSERT_TRUE(trees == 5);
+            ASSERT_TRUE(ids.size() == 1 + 2 + 4 + 6 + 11);
+        }
+    });
+}
+
+
+/**
+ * @test depth_limited_search::stop_at_target
+ * Checks that iterative deepening finds a vertex in the iteration with a depth limit equal to its depth, and stops there.
+ */
+TEST(depth_limited_search, stop_at_target) {
+    auto structure = graphle::test::v_list_out_edge_graph::from_ve_list(graphle::test::make_tree_graph());
+    auto graph     = structure.view_as_graph();
+
+    using G = decltype(graph);
+
+
+    std::size_t trees = 0;
+
+    const bool finished = graphle::search::iterative_deepening_search(graph, &structure.vertices[0], graphle::search::visitor_from_arguments {
+        .deduce_graph_type = graphle::meta::deduce_as<G>,
+        .discover_vertex   = [&] (auto v, auto& g) { return v->vertex_id == 6 ? graphle::search::visitor_result::STOP_SEARCH : graphle::search::visitor_result::CONTINUE; },
+        .begin_tree        = [&] (auto v, auto& g) { ++trees; }
+    });
+
+    ASSERT_FALSE(finished);
+    ASSERT_TRUE(trees == 4);
+}
+
+
+/**
+ * @test depth_limited_search::cycles
+ * Checks that the search terminates on cyclic graphs without a depth limit when checking cycles along the path,
+ * and that cycles are followed up to the depth limit without checking.
+ */
+TEST(depth_limited_search, cycles) {
+    graphle::test::vertex_list_datastructure_list::foreach([] <typename DS> {
+        SUBTEST_SCOPE(typeid(DS).name()) {
+            auto structure = DS::from_ve_list(graphle::test::make_cyclic_graph());
+            auto graph     = structure.view_as_graph();
+
+            using G = decltype(graph);
+
+
+            for (auto root : graph.get_vertices()) {
+                std::vector<std::size_t> checked, unchecked;
+                std::size_t trees = 0;
+
+                constexpr std::size_t unlimited = std::numeric_limits<std::size_t>::max();
+                ASSERT_TRUE(graphle::search::depth_limited_search(graph, root, make_recording_visitor<G>(checked, trees), unlimited));
+                ASSERT_TRUE(graphle::search::depth_limited_search(graph, root, make_recording_visitor<G>(unchecked, trees), 12, graphle::search::cycle_check::NONE));
+
+                // Every vertex reachable with cycle checking is also reachable without it.
+                for (auto id : checked) ASSERT_TRUE(std::ranges::find(unchecked, id) != unchecked.end());
+            }
+        }
+    });
+}
+
+
+/**
+ * @test depth_limited_search::path_cutoff
+ * Checks that with cycle checking, iterative deepening stops after the iteration in which the only remaining edges lead back onto the path,
+ * and that without cycle checking it continues until the given maximum depth.
+ */
+TEST(depth_limited_search, path_cutoff) {
+    // A cycle 0 -> 1 -> 2 -> 3 -> 0, where 3 also has an edge to itself.
+    graphle::test::ve_list_graph src;
+    for (std::size_t i = 0; i < 4; ++i) src.vertices.push_back({ i });
+    for (std::size_t i = 0; i < 4; ++i) src.edges.emplace_back(src.vertices[i], src.vertices[(i + 1) % 4]);
+    src.edges.emplace_back(src.vertices[3], src.vertices[3]);
+
+    auto structure = graphle::test::v_list_out_edge_graph::from_ve_list(src);
+    auto graph     = structure.view_as_graph();
+
+    using G = decltype(graph);
+
+
+    std::vector<std::size_t> ids;
+    std::size_t trees = 0;
+
+    ASSERT_TRUE(graphle::search::iterative_deepening_search(graph, &structure.vertices[0], make_recording_visitor<G>(ids, trees)));
+    ASSERT_TRUE(trees == 4);
+
+
+    trees = 0;
+
+    ASSERT_TRUE(graphle::search::iterative_deepening_search(graph, &structure.vertices[0], make_recording_visitor<G>(ids, trees), 6, graphle::search::cycle_check::NONE));
+    ASSERT_TRUE(trees == 7);
+}
+
+
+/**
+ * @test depth_limited_search::budget
+ * Checks that iterative deepening is cancelled once its budget is exhausted, and finishes if its budget is exhausted by the last edge.
+ */
+TEST(depth_limited_search, budget) {
+    auto structure = graphle::test::v_list_out_edge_graph::from_ve_list(graphle::test::make_tree_graph());
+    auto graph     = structure.view_as_graph();
+
+    using G = decltype(graph);
+
+
+    std::vector<std::size_t> ids;
+    std::size_t trees = 0;
+
+    ASSERT_TRUE(graphle::search::iterative_deepening_search(graph, &structure.vertices[0], make_recording_visitor<G>(ids, trees), graphle::util::work_budget::of_work(1)) == graphle::util::run_status::CANCELLED);
+    ASSERT_TRUE(trees == 2);
+
+
+    graphle::util::work_budget measure;
+    ASSERT_TRUE(graphle::search::iterative_deepening_search(graph, &structure.vertices[0], make_recording_visitor<G>(ids, trees), measure) == graphle::util::run_status::FINISHED);
+
+    const std::size_t total = graphle::util::work_budget {}.get_remaining_work() - measure.get_remaining_work();
+    ASSERT_TRUE(graphle::search::iterative_deepening_search(graph, &structure.vertices[0], make_recording_visitor<G>(ids, trees), graphle::util::work_budget::of_work(total)) == graphle::util::run_status::FINISHED);
+}
+
+
+/**
+ * @test depth_limited_search::single_pass_budget
+ * Checks that a single depth-limited search is cancelled once its budget is exhausted, and finishes if its budget is exhausted by the last edge.
+ */
+TEST(depth_limited_search, single_pass_budget) {
+    auto structure = graphle::test::v_list_out_edge_graph::from_ve_list(graphle::test::make_tree_graph());
+    auto graph     = structure.view_as_graph();
+
+    using G = decltype(graph);
+
+
+    std::vector<std::size_t> ids;
+    std::size_t trees = 0;
+
+    ASSERT_TRUE(graphle::search::depth_limited_search(graph, &structure.vertices[0], make_recording_visitor<G>(ids, trees), graphle::util::work_budget::of_work(1), 3) == graphle::util::run_status::CANCELLED);
+    ASSERT_TRUE(ids.size() == 2);
+
+
+    ids.clear();
+    graphle::util::work_budget measure;
+
+    ASSERT_TRUE(graphle::search::depth_limited_search(graph, &structure.vertices[0], make_recording_visitor<G>(ids, trees), measure, 3) == graphle::util::run_status::FINISHED);
+    const auto expected = ids;
+    const std::size_t total = graphle::util::work_budget {}.get_remaining_work() - measure.get_remaining_work();
+
+
+    ids.clear();
+    ASSERT_TRUE(graphle::search::depth_limited_search(graph, &structure.vertices[0], make_recording_visitor<G>(ids, trees), graphle::util::work_budget::of_work(total), 3) == graphle::util::run_status::FINISHED);
+    ASSERT_TRUE(ids == expected);
+}
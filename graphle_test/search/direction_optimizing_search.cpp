@@ -0,0 +1,159 @@
+#include <test_framework.hpp>
+#include <test_data.hpp>
+#include <search/test_visit_order.hpp>
+
+#include <limits>
+
+
+using graphle::test::vertex_list;
+
+
+/** Parameters which make the search expand every layer bottom-up. */
+constexpr inline graphle::search::direction_optimizing_parameters always_bottom_up {
+    .alpha = std::numeric_limits<std::size_t>::max(),
+    .beta  = std::numeric_limits<std::size_t>::max()
+};
+
+
+/** Visits the given graph from the given root both with the default parameters and bottom-up only, and checks the layers vertices are visited in. */
+static void test_layers(const graphle::test::ve_list_graph& src, std::size_t root, const graphle::test::vertex_order& expected) {
+    SUBTEST_SCOPE("default") {
+        graphle::test::test_visit_order<graphle::test::vertex_list_datastructure_list>(
+            src,
+            root,
+            expected,
+            [] (auto&&... args) { graphle::search::direction_optimizing_breadth_first_search(GRAPHLE_FWD(args)...); }
+        );
+    }
+
+    SUBTEST_SCOPE("bottom_up") {
+        graphle::test::test_visit_order<graphle::test::vertex_list_datastructure_list>(
+            src,
+            root,
+            expected,
+            [] (auto&&... args) { graphle::search::direction_optimizing_breadth_first_search(GRAPHLE_FWD(args)..., always_bottom_up); }
+        );
+    }
+}
+
+
+/**
+ * @test direction_optimizing_bfs::visit_tree
+ * Visits a tree-like graph and asserts vertices are visited in the same layers as with BFS, both top-down and bottom-up.
+ */
+TEST(direction_optimizing_bfs, visit_tree) {
+    test_layers(graphle::test::make_tree_graph(), 0, graphle::test::vertex_order {
+        vertex_list { 0 },
+        vertex_list { 1 },
+        vertex_list { 2, 5 },
+        vertex_list { 3, 6 },
+        vertex_list { 4, 7, 8, 9, 10 },
+    });
+}
+
+
+/**
+ * @test direction_optimizing_bfs::visit_cyclic
+ * Visits a cyclic graph and asserts vertices are visited in the same layers as with BFS, both top-down and bottom-up.
+ */
+TEST(direction_optimizing_bfs, visit_cyclic) {
+    test_layers(graphle::test::make_cyclic_graph(), 1, graphle::test::vertex_order {
+        vertex_list { 1 },
+        vertex_list { 3 },
+        vertex_list { 4 },
+        vertex_list { 5 },
+        vertex_list { 6 },
+        vertex_list { 7, 2 },
+        vertex_list { 8 }
+    });
+}
+
+
+/**
+ * @test direction_optimizing_bfs::visit_bidirectional_edge
+ * Visits a graph with bidirectional edges and asserts vertices are visited in the same layers as with BFS, both top-down and bottom-up.
+ */
+TEST(direction_optimizing_bfs, visit_bidirectional_edge) {
+    test_layers(graphle::test::make_bidirectional_edge_graph(), 4, graphle::test::vertex_order {
+        vertex_list { 4 },
+        vertex_list { 2 },
+        vertex_list { 1, 3 },
+        vertex_list { 5 }
+    });
+}
+
+
+/**
+ * @test direction_optimizing_bfs::bottom_up_skips_edges
+ * Checks that bottom-up expansion stops looking for a parent of a vertex once one is found,
+ * so a large layer is expanded while examining far fewer edges than with BFS.
+ */
+TEST(direction_optimizing_bfs, bottom_up_skips_edges) {
+    // Vertex 0 has an edge to vertices [1, 8], each of which has an edge to every vertex in [9, 24].
+    graphle::test::ve_list_graph src;
+    for (std::size_t i = 0; i < 25; ++i) src.vertices.push_back({ i });
+
+    for (std::size_t i = 1; i < 9; ++i) {
+        src.edges.emplace_back(src.vertices[0], src.vertices[i]);
+        for (std::size_t j = 9; j < 25; ++j) src.edges.emplace_back(src.vertices[i], src.vertices[j]);
+    }
+
+
+    auto structure = graphle::test::v_list_in_out_edge_graph::from_ve_list(src);
+    auto graph     = structure.view_as_graph();
+    using graph_t  = decltype(graph);
+
+    struct edge_counter : graphle::search::search_visitor<edge_counter, graph_t> {
+        std::size_t new_edges = 0, known_edges = 0;
+
+        void discover_edge_to_new_vertex(graphle::edge_of<graph_t> e, graph_t& g) { ++new_edges; }
+        void discover_edge_to_known_vertex(graphle::edge_of<graph_t> e, graph_t& g) { ++known_edges; }
+    };
+
+
+    edge_counter bfs_counter, dobfs_counter;
+    graphle::search::breadth_first_search(graph, &structure.vertices[0], bfs_counter);
+    graphle::search::direction_optimizing_breadth_first_search(graph, &structure.vertices[0], dobfs_counter);
+
+    ASSERT_TRUE(bfs_counter.new_edges == 24);
+    ASSERT_TRUE(bfs_counter.new_edges + bfs_counter.known_edges == src.edges.size());
+
+    // The second layer is expanded bottom-up, finding a parent for every vertex through its first in edge.
+    ASSERT_TRUE(dobfs_counter.new_edges == 24);
+    ASSERT_TRUE(dobfs_counter.known_edges == 0);
+}
+
+
+/**
+ * @test direction_optimizing_bfs::budget
+ * Checks that the search is cancelled once its budget is exhausted, and finishes when its budget is exhausted by the last layer.
+ */
+TEST(direction_optimizing_bfs, budget) {
+    graphle::test::ve_list_graph src;
+    for (std::size_t i = 0; i < 100; ++i) src.vertices.push_back({ i });
+    for (std::size_t i = 0; i + 1 < 100; ++i) src.edges.emplace_back(src.vertices[i], src.vertices[i + 1]);
+
+    auto structure = graphle::test::v_list_in_out_edge_graph::from_ve_list(src);
+    auto graph     = structure.view_as_graph();
+    using graph_t  = decltype(graph);
+
+    struct vertex_counter : graphle::search::search_visitor<vertex_counter, graph_t> {
+        std::size_t vertices = 0;
+        void discover_vertex(graphle::vertex_of<graph_t> v, graph_t& g) { ++vertices; }
+    };
+
+
+    vertex_counter cancelled;
+    ASSERT_TRUE(graphle::search::direction_optimizing_breadth_first_search(graph, &structure.vertices[0], cancelled, graphle::util::work_budget::of_work(1)) == graphle::util::run_status::CANCELLED);
+    ASSERT_TRUE(cancelled.vertices < 100);
+
+
+    vertex_counter measured, exact;
+    graphle::util::work_budget measure;
+
+    ASSERT_TRUE(graphle::search::direction_optimizing_breadth_first_search(graph, &structure.vertices[0], measured, measure) == graphle::util::run_status::FINISHED);
+    const std::size_t total = graphle::util::work_budget {}.get_remaining_work() - measure.get_remaining_work();
+
+    ASSERT_TRUE(graphle::search::direction_optimizing_breadth_first_search(graph, &structure.vertices[0], exact, graphle::util::work_budget::of_work(total)) == graphle::util::run_status::FINISHED);
+    ASSERT_TRUE(measured.vertices == 100 && exact.vertices == 100);
+}
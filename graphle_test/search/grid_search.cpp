@@ -0,0 +1,122 @@
+#include <test_framework.hpp>
+#include <graphle.hpp>
+
+#include <cmath>
+#include <vector>
+
+
+using graphle::grid_connectivity;
+
+
+/**
+ * @test grid_search::breadth_first_search
+ * Checks BFS distances on 2D and 3D grids with different connectivities.
+ */
+TEST(grid_search, breadth_first_search) {
+    SUBTEST_SCOPE("four_connected_wall") {
+        // A wall along x = 2 with a gap at y = 4.
+        graphle::grid_graph<grid_connectivity::FOUR> grid { { 5, 5 } };
+        for (std::size_t y = 0; y < 4; ++y) grid.set_passable(grid.index_of({ 2, y }), false);
+
+        graphle::search::grid_search_state<std::size_t> state;
+
+        ASSERT_TRUE(graphle::search::grid_breadth_first_search(grid, grid.index_of({ 0, 0 }), state));
+        ASSERT_TRUE(state.distance[grid.index_of({ 4, 0 })] == 12);
+        ASSERT_FALSE(state.reached(grid.index_of({ 2, 0 })));
+        ASSERT_TRUE(state.path_to(grid.index_of({ 4, 0 })).size() == 13);
+    }
+
+
+    SUBTEST_SCOPE("eight_connected") {
+        graphle::grid_graph<grid_connectivity::EIGHT> grid { { 5, 5 } };
+        graphle::search::grid_search_state<std::size_t> state;
+
+        ASSERT_TRUE(graphle::search::grid_breadth_first_search(grid, grid.index_of({ 0, 0 }), state, grid.index_of({ 4, 3 })));
+        ASSERT_TRUE(state.distance[grid.index_of({ 4, 3 })] == 4);
+    }
+
+
+    SUBTEST_SCOPE("three_dimensional") {
+        graphle::grid_graph<grid_connectivity::SIX> six { { 3, 3, 3 } };
+        graphle::grid_graph<grid_connectivity::TWENTY_SIX> twenty_six { { 3, 3, 3 } };
+        graphle::search::grid_search_state<std::size_t> state;
+
+        graphle::search::grid_breadth_first_search(six, 0, state);
+        ASSERT_TRUE(state.distance[six.index_of({ 2, 2, 2 })] == 6);
+
+        graphle::search::grid_breadth_first_search(twenty_six, 0, state);
+        ASSERT_TRUE(state.distance[twenty_six.index_of({ 2, 2, 2 })] == 2);
+    }
+}
+
+
+/**
+ * @test grid_search::shortest_path
+ * Checks that A* finds the lowest-cost path, taking into account cell costs and diagonal step lengths.
+ */
+TEST(grid_search, shortest_path) {
+    SUBTEST_SCOPE("diagonal") {
+        graphle::grid_graph<grid_connectivity::EIGHT> grid { { 8, 8 } };
+        graphle::search::grid_search_state<float> state;
+
+        ASSERT_TRUE(graphle::search::grid_shortest_path(grid, grid.index_of({ 0, 0 }), grid.index_of({ 3, 5 }), state));
+        ASSERT_TRUE(std::abs(state.distance[grid.index_of({ 3, 5 })] - (3.0f * std::sqrt(2.0f) + 2.0f)) < 1e-4f);
+    }
+
+
+    SUBTEST_SCOPE("costs") {
+        // Going straight through the middle row is expensive, so the path should go around it.
+        graphle::grid_graph<grid_connectivity::FOUR> grid { { 5, 3 } };
+        for (std::size_t x = 1; x < 4; ++x) grid.set_cost(grid.index_of({ x, 1 }), 10.0f);
+
+        graphle::search::grid_search_state<float> state;
+
+        ASSERT_TRUE(graphle::search::grid_shortest_path(grid, grid.index_of({ 0, 1 }), grid.index_of({ 4, 1 }), state));
+        ASSERT_TRUE(state.distance[grid.index_of({ 4, 1 })] == 6.0f);
+
+        const auto path = state.path_to(grid.index_of({ 4, 1 }));
+        ASSERT_TRUE(path.size() == 7);
+        for (auto cell : path) ASSERT_TRUE(grid.coordinates_of(cell)[1] != 1 || cell == path.front() || cell == path.back());
+    }
+
+
+    SUBTEST_SCOPE("unreachable") {
+        graphle::grid_graph<grid_connectivity::FOUR> grid { { 3, 3 } };
+        for (std::size_t y = 0; y < 3; ++y) grid.set_passable(grid.index_of({ 1, y }), false);
+
+        graphle::search::grid_search_state<float> state;
+
+        ASSERT_FALSE(graphle::search::grid_shortest_path(grid, grid.index_of({ 0, 0 }), grid.index_of({ 2, 2 }), state));
+        ASSERT_TRUE(state.path_to(grid.index_of({ 2, 2 })).empty());
+    }
+}
+
+
+/**
+ * @test grid_search::budget
+ * Checks that grid searches are cancelled once their budget is exhausted, and find the target when their budget suffices.
+ */
+TEST(grid_search, budget) {
+    graphle::grid_graph<grid_connectivity::FOUR> grid { { 8, 8 } };
+    graphle::search::grid_search_state<float> state;
+
+    const std::size_t source = grid.index_of({ 0, 0 });
+    const std::size_t target = grid.index_of({ 7, 7 });
+
+    using graphle::util::run_status;
+    using graphle::util::work_budget;
+
+
+    ASSERT_TRUE(graphle::search::grid_breadth_first_search(grid, source, state, work_budget::of_work(1), target) == run_status::CANCELLED);
+    ASSERT_FALSE(state.reached(target));
+
+    ASSERT_TRUE(graphle::search::grid_breadth_first_search(grid, source, state, graphle::util::unlimited_budget {}, target) == run_status::FINISHED);
+    ASSERT_TRUE(state.reached(target));
+
+
+    ASSERT_TRUE(graphle::search::grid_shortest_path(grid, source, target, state, work_budget::of_work(1)) == run_status::CANCELLED);
+    ASSERT_FALSE(state.reached(target));
+
+    ASSERT_TRUE(graphle::search::grid_shortest_path(grid, source, target, state, graphle::util::unlimited_budget {}) == run_status::FINISHED);
+    ASSERT_TRUE(state.path_to(target).size() == 15);
+}
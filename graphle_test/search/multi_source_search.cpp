@@ -0,0 +1,124 @@
+#include <test_framework.hpp>
+#include <test_data.hpp>
+#include <graphle.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+
+/** Returns the distance from the given root to every vertex of the given graph using a plain BFS, indexed by vertex id. */
+template <typename G, typename Structure> static std::vector<std::size_t> reference_distances(G& graph, Structure& structure, std::size_t root) {
+    using graph_t = std::remove_cvref_t<G>;
+
+    struct distance_visitor : graphle::search::search_visitor<distance_visitor, graph_t> {
+        std::vector<std::size_t>* distances;
+
+        void discover_edge_to_new_vertex(graphle::edge_of<graph_t> e, graph_t& g) {
+            (*distances)[e.second->vertex_id] = (*distances)[e.first->vertex_id] + 1;
+        }
+    };
+
+
+    std::vector<std::size_t> distances(structure.vertices.size(), std::numeric_limits<std::size_t>::max());
+    distances[root] = 0;
+
+    distance_visitor visitor;
+    visitor.distances = &distances;
+
+    graphle::search::breadth_first_search(graph, &structure.vertices[root], visitor);
+    return distances;
+}
+
+
+/**
+ * @test multi_source_bfs::distances
+ * Computes the distances from every vertex of every test graph at once and compares them to the results of a BFS from every vertex.
+ */
+TEST(multi_source_bfs, distances) {
+    for (const auto& src : graphle::test::make_graphs()) {
+        auto structure = graphle::test::v_list_out_edge_graph::from_ve_list(src);
+        auto graph     = structure.view_as_graph();
+
+        std::vector<graphle::vertex_of<decltype(graph)>> roots;
+        for (auto& vertex : structure.vertices) roots.push_back(&vertex);
+
+
+        auto table = graphle::search::multi_source_distances(graph, roots);
+        ASSERT_TRUE(table.num_sources() == roots.size());
+
+        for (std::size_t i = 0; i < roots.size(); ++i) {
+            const auto expected = reference_distances(graph, structure, i);
+
+            for (auto& vertex : structure.vertices) {
+                ASSERT_TRUE(table.distance(i, &vertex) == expected[vertex.vertex_id]);
+            }
+        }
+    }
+}
+
+
+/**
+ * @test multi_source_bfs::batches
+ * Searches from more roots than fit in a single batch, including duplicate roots, and checks every root reaches every vertex at the correct depth exactly once.
+ */
+TEST(multi_source_bfs, batches) {
+    // A cycle of 100 vertices, where every vertex has an edge to the next one.
+    constexpr std::size_t num_vertices = 100;
+
+    graphle::test::ve_list_graph src;
+    for (std::size_t i = 0; i < num_vertices; ++i) src.vertices.push_back({ i });
+    for (std::size_t i = 0; i < num_vertices; ++i) src.edges.emplace_back(src.vertices[i], src.vertices[(i + 1) % num_vertices]);
+
+    auto structure = graphle::test::v_list_out_edge_graph::from_ve_list(src);
+    auto graph     = structure.view_as_graph();
+
+
+    // Every vertex as a root twice, for 200 roots in total.
+    std::vector<graphle::vertex_of<decltype(graph)>> roots;
+    for (std::size_t i = 0; i < 2 * num_vertices; ++i) roots.push_back(&structure.vertices[i % num_vertices]);
+
+    std::vector<std::size_t> visits(roots.size(), 0);
+    bool correct_depths = true;
+
+    graphle::search::multi_source_breadth_first_search<1>(graph, roots, [&] (auto* vertex, std::size_t depth, auto sources) {
+        for (std::size_t source : sources) {
+            ++visits[source];
+            correct_depths &= (vertex->vertex_id + num_vertices - roots[source]->vertex_id) % num_vertices == depth;
+        }
+    });
+
+    ASSERT_TRUE(correct_depths);
+    ASSERT_TRUE(std::ranges::all_of(visits, [] (std::size_t n) { return n == num_vertices; }));
+}
+
+
+/**
+ * @test multi_source_bfs::budget
+ * Checks that the search is cancelled once its budget is exhausted, and that the distances are complete when the budget is exhausted by the last layer.
+ */
+TEST(multi_source_bfs, budget) {
+    graphle::test::ve_list_graph src;
+    for (std::size_t i = 0; i < 100; ++i) src.vertices.push_back({ i });
+    for (std::size_t i = 0; i + 1 < 100; ++i) src.edges.emplace_back(src.vertices[i], src.vertices[i + 1]);
+
+    auto structure = graphle::test::v_list_out_edge_graph::from_ve_list(src);
+    auto graph     = structure.view_as_graph();
+
+    std::vector<graphle::vertex_of<decltype(graph)>> roots { &structure.vertices[0], &structure.vertices[50] };
+
+
+    auto [cancelled_status, cancelled] = graphle::search::multi_source_distances(graph, roots, graphle::util::work_budget::of_work(1));
+    ASSERT_TRUE(cancelled_status == graphle::util::run_status::CANCELLED);
+    ASSERT_TRUE(cancelled.distance(0, &structure.vertices[99]) == cancelled.unreached);
+
+
+    graphle::util::work_budget measure;
+    ASSERT_TRUE(graphle::search::multi_source_distances(graph, roots, measure).first == graphle::util::run_status::FINISHED);
+    const std::size_t total = graphle::util::work_budget {}.get_remaining_work() - measure.get_remaining_work();
+
+    auto [exact_status, exact] = graphle::search::multi_source_distances(graph, roots, graphle::util::work_budget::of_work(total));
+    ASSERT_TRUE(exact_status == graphle::util::run_status::FINISHED);
+    ASSERT_TRUE(exact.distance(0, &structure.vertices[99]) == 99);
+    ASSERT_TRUE(exact.distance(1, &structure.vertices[99]) == 49);
+}
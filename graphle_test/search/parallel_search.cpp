@@ -0,0 +1,134 @@
+#include <test_framework.hpp>
+#include <test_datastructures.hpp>
+#include <graphle.hpp>
+
+#include <atomic>
+#include <limits>
+#include <vector>
+
+
+/** Returns a graph in which every vertex i has edges to the vertices 2i + 1, 2i + 2, i / 3 and (7i + 3) mod num_vertices. */
+static graphle::test::v_list_out_edge_graph make_test_graph(std::size_t num_vertices) {
+    graphle::test::ve_list_graph src;
+    for (std::size_t i = 0; i < num_vertices; ++i) src.vertices.push_back({ i });
+
+    for (std::size_t i = 0; i < num_vertices; ++i) {
+        for (std::size_t j : { 2 * i + 1, 2 * i + 2, i / 3, (7 * i + 3) % num_vertices }) {
+            if (j < num_vertices) src.edges.emplace_back(src.vertices[i], src.vertices[j]);
+        }
+    }
+
+    return graphle::test::v_list_out_edge_graph::from_ve_list(src);
+}
+
+
+/** Visitor which records the depth of every vertex. Thread-safe when used with parallel_breadth_first_search. */
+template <typename G> struct depth_visitor : graphle::search::search_visitor<depth_visitor<G>, G> {
+    std::vector<std::size_t>* depths;
+    std::atomic<std::size_t>* num_visited;
+
+    void discover_vertex(graphle::vertex_of<G> v, G& g) {
+        num_visited->fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void discover_edge_to_new_vertex(graphle::edge_of<G> e, G& g) {
+        (*depths)[e.second->vertex_id] = (*depths)[e.first->vertex_id] + 1;
+    }
+};
+
+
+/**
+ * @test parallel_bfs::depths
+ * Checks that a parallel BFS reaches every vertex exactly once, at the same depth as a sequential BFS.
+ */
+TEST(parallel_bfs, depths) {
+    constexpr std::size_t num_vertices = 5000;
+    constexpr std::size_t unreached    = std::numeric_limits<std::size_t>::max();
+
+    auto structure = make_test_graph(num_vertices);
+    auto graph     = structure.view_as_graph();
+    using graph_t  = decltype(graph);
+
+
+    auto run = [&] (auto&& algorithm) {
+        std::vector<std::size_t> depths(num_vertices, unreached);
+        std::atomic<std::size_t> num_visited = 0;
+
+        depths[0] = 0;
+        algorithm(depth_visitor<graph_t> { .depths = &depths, .num_visited = &num_visited });
+
+        ASSERT_TRUE(num_visited == num_vertices);
+        return depths;
+    };
+
+
+    const auto expected = run([&] (auto visitor) {
+        graphle::search::breadth_first_search(graph, &structure.vertices[0], visitor);
+    });
+
+    for (std::size_t num_workers : { 1, 4 }) {
+        graphle::util::thread_pool pool { num_workers };
+
+        const auto result = run([&] (auto visitor) {
+            ASSERT_TRUE(graphle::search::parallel_breadth_first_search(graph, &structure.vertices[0], visitor, pool));
+        });
+
+        ASSERT_TRUE(result == expected);
+    }
+}
+
+
+/**
+ * @test parallel_bfs::stop_search
+ * Checks that a parallel BFS returns early if the visitor stops the search.
+ */
+TEST(parallel_bfs, stop_search) {
+    auto structure = make_test_graph(1000);
+    auto graph     = structure.view_as_graph();
+
+    graphle::util::thread_pool pool { 4 };
+    std::atomic<bool> finished = false;
+
+    const bool result = graphle::search::parallel_breadth_first_search(graph, &structure.vertices[0], graphle::search::visitor_from_arguments {
+        .deduce_graph_type = graphle::meta::deduce_as<decltype(graph)>,
+        .discover_vertex   = [] (auto v, auto& g) { return v->vertex_id == 500 ? graphle::search::visitor_result::STOP_SEARCH : graphle::search::visitor_result::CONTINUE; },
+        .finish_search     = [&] (auto& g) { finished = true; }
+    }, pool);
+
+    ASSERT_FALSE(result);
+    ASSERT_FALSE(finished);
+}
+
+
+/**
+ * @test parallel_bfs::budget
+ * Checks that a parallel BFS is cancelled once its budget is exhausted, and finishes if its budget is exhausted by the last layer.
+ */
+TEST(parallel_bfs, budget) {
+    auto structure = make_test_graph(1000);
+    auto graph     = structure.view_as_graph();
+
+    graphle::util::thread_pool pool { 4 };
+
+
+    auto run = [&] (auto&& budget, bool& finished) {
+        return graphle::search::parallel_breadth_first_search(graph, &structure.vertices[0], graphle::search::visitor_from_arguments {
+            .deduce_graph_type = graphle::meta::deduce_as<decltype(graph)>,
+            .finish_search     = [&] (auto& g) { finished = true; }
+        }, pool, budget);
+    };
+
+
+    bool finished = false;
+    ASSERT_TRUE(run(graphle::util::work_budget::of_work(1), finished) == graphle::util::run_status::CANCELLED);
+    ASSERT_FALSE(finished);
+
+    graphle::util::work_budget measure;
+    ASSERT_TRUE(run(measure, finished) == graphle::util::run_status::FINISHED);
+    ASSERT_TRUE(finished);
+
+    finished = false;
+    const std::size_t total = graphle::util::work_budget {}.get_remaining_work() - measure.get_remaining_work();
+    ASSERT_TRUE(run(graphle::util::work_budget::of_work(total), finished) == graphle::util::run_status::FINISHED);
+    ASSERT_TRUE(finished);
+}
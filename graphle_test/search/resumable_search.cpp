@@ -0,0 +1,137 @@
+#include <test_framework.hpp>
+#include <test_data.hpp>
+#include <graphle.hpp>
+
+#include <stop_token>
+#include <vector>
+
+
+/** Returns a visitor which records the order in which vertices are discovered into the given vector. */
+template <typename G> static auto make_recording_visitor(std::vector<graphle::vertex_of<G>>& order) {
+    return graphle::search::visitor_from_arguments {
+        .deduce_graph_type = graphle::meta::deduce_as<G>,
+        .discover_vertex   = [&order] (auto v, auto& g) { order.push_back(v); }
+    };
+}
+
+
+/**
+ * @test resumable_search::same_order_as_search
+ * Checks that resumable searches run with a budget of a single unit of work visit the vertices of every test graph
+ * in the same order as the corresponding search algorithms, and suspend after every vertex until they finish.
+ */
+TEST(resumable_search, same_order_as_search) {
+    graphle::test::vertex_list_datastructure_list::foreach([] <typename DS> {
+        for (const auto& src : graphle::test::make_graphs()) {
+            auto structure = DS::from_ve_list(src);
+            auto graph     = structure.view_as_graph();
+
+            using G = decltype(graph);
+
+
+            for (auto root : graph.get_vertices()) {
+                std::vector<graphle::vertex_of<G>> expected_bfs, expected_dfs, bfs_order, dfs_order;
+                graphle::search::breadth_first_search(graph, root, make_recording_visitor<G>(expected_bfs));
+                graphle::search::depth_first_search(graph, root, make_recording_visitor<G>(expected_dfs));
+
+                auto bfs = graphle::search::resumable_breadth_first_search(graph, root, make_recording_visitor<G>(bfs_order));
+                auto dfs = graphle::search::resumable_depth_first_search(graph, root, make_recording_visitor<G>(dfs_order));
+
+
+                std::size_t runs = 0;
+                while (bfs.run(graphle::util::work_budget::of_work(1)) == graphle::util::run_status::SUSPENDED) {
+                    ++runs;
+                    ASSERT_TRUE(bfs_order.size() == runs);
+                }
+
+                while (dfs.run(graphle::util::work_budget::of_work(1)) == graphle::util::run_status::SUSPENDED);
+
+
+                ASSERT_TRUE(bfs.get_status() == graphle::util::run_status::FINISHED);
+                ASSERT_TRUE(dfs.get_status() == graphle::util::run_status::FINISHED);
+                ASSERT_TRUE(bfs_order == expected_bfs);
+                ASSERT_TRUE(dfs_order == expected_dfs);
+            }
+        }
+    });
+}
+
+
+/**
+ * @test resumable_search::shared_budget
+ * Checks that a budget passed as an lvalue is consumed by the search, and that a stopped search stays stopped.
+ */
+TEST(resumable_search, shared_budget) {
+    graphle::test::ve_list_graph src;
+    for (std::size_t i = 0; i < 100; ++i) src.vertices.push_back({ i });
+    for (std::size_t i = 0; i + 1 < 100; ++i) src.edges.emplace_back(src.vertices[i], src.vertices[i + 1]);
+
+    auto structure = graphle::test::v_list_out_edge_graph::from_ve_list(src);
+    auto graph     = structure.view_as_graph();
+
+    using G = decltype(graph);
+
+
+    std::size_t visited = 0;
+
+    auto bfs = graphle::search::resumable_breadth_first_search(graph, &structure.vertices[0], graphle::search::visitor_from_arguments {
+        .deduce_graph_type = graphle::meta::deduce_as<G>,
+        .discover_vertex   = [&] (auto v, auto& g) { return ++visited == 20 ? graphle::search::visitor_result::STOP_SEARCH : graphle::search::visitor_result::CONTINUE; }
+    });
+
+
+    auto budget = graphle::util::work_budget::of_work(10);
+    ASSERT_TRUE(bfs.run(budget) == graphle::util::run_status::SUSPENDED);
+    ASSERT_TRUE(budget.exhausted());
+    ASSERT_TRUE(visited > 0 && visited < 20);
+
+    ASSERT_TRUE(bfs.run(graphle::util::work_budget {}) == graphle::util::run_status::STOPPED);
+    ASSERT_TRUE(visited == 20);
+
+    ASSERT_TRUE(bfs.run(graphle::util::work_budget {}) == graphle::util::run_status::STOPPED);
+    ASSERT_TRUE(visited == 20);
+}
+
+
+/**
+ * @test resumable_search::cancellation
+ * Checks that a search is cancelled shortly after a stop is requested through the stop token of its budget, and that a cancelled search stays cancelled.
+ */
+TEST(resumable_search, cancellation) {
+    graphle::test::ve_list_graph src;
+    for (std::size_t i = 0; i < 1000; ++i) src.vertices.push_back({ i });
+    for (std::size_t i = 0; i + 1 < 1000; ++i) src.edges.emplace_back(src.vertices[i], src.vertices[i + 1]);
+
+    auto structure = graphle::test::v_list_out_edge_graph::from_ve_list(src);
+    auto graph     = structure.view_as_graph();
+
+    using G = decltype(graph);
+
+
+    std::stop_source source;
+    std::size_t visited = 0;
+
+    auto visitor = graphle::search::visitor_from_arguments {
+        .deduce_graph_type = graphle::meta::deduce_as<G>,
+        .discover_vertex   = [&] (auto v, auto& g) { if (++visited == 100) source.request_stop(); }
+    };
+
+
+    auto budget = graphle::util::work_budget {}.with_stop_token(source.get_token());
+    ASSERT_TRUE(graphle::search::depth_first_search(graph, &structure.vertices[0], visitor, budget) == graphle::util::run_status::CANCELLED);
+    ASSERT_TRUE(budget.cancelled());
+    ASSERT_TRUE(visited >= 100 && visited <= 100 + graphle::util::work_budget::check_interval);
+
+
+    visited = 0;
+    auto dfs = graphle::search::resumable_depth_first_search(graph, &structure.vertices[0], visitor);
+
+    ASSERT_TRUE(dfs.run(graphle::util::work_budget {}.with_stop_token(source.get_token())) == graphle::util::run_status::CANCELLED);
+    ASSERT_TRUE(dfs.run(graphle::util::work_budget {}) == graphle::util::run_status::CANCELLED);
+    ASSERT_TRUE(visited <= graphle::util::work_budget::check_interval);
+
+
+    visited = 0;
+    ASSERT_TRUE(graphle::search::breadth_first_search(graph, &structure.vertices[0], visitor, graphle::util::work_budget::of_work(10)) == graphle::util::run_status::CANCELLED);
+    ASSERT_TRUE(graphle::search::breadth_first_search(graph, &structure.vertices[0], visitor, graphle::util::work_budget {}) == graphle::util::run_status::FINISHED);
+}
@@ -0,0 +1,133 @@
+#include <test_framework.hpp>
+#include <test_data.hpp>
+#include <graphle.hpp>
+
+#include <optional>
+#include <vector>
+
+
+/**
+ * @test search_forest::visits_every_vertex_once
+ * Checks that the forest traversals visit every vertex of every test graph exactly once, that every tree is started from a vertex
+ * that was not visited by an earlier tree, and that begin_tree and finish_tree are invoked in pairs.
+ */
+TEST(search_forest, visits_every_vertex_once) {
+    graphle::test::vertex_list_datastructure_list::foreach([] <typename DS> {
+        for (const auto& src : graphle::test::make_graphs()) {
+            auto structure = DS::from_ve_list(src);
+            auto graph     = structure.view_as_graph();
+
+            using G      = decltype(graph);
+            using vertex = graphle::vertex_of<G>;
+
+
+            auto check = [&] (auto&& algorithm) {
+                std::vector<vertex> visited;
+                std::optional<vertex> current_tree;
+                std::size_t trees = 0, searches = 0;
+
+                const bool result = algorithm(graph, graphle::search::visitor_from_arguments {
+                    .deduce_graph_type = graphle::meta::deduce_as<G>,
+                    .discover_vertex   = [&] (auto v, auto& g) {
+                        ASSERT_TRUE(current_tree.has_value());
+                        ASSERT_TRUE(std::ranges::find(visited, v) == visited.end());
+                        visited.push_back(v);
+                    },
+                    .begin_search      = [&] (auto& g) { ++searches; },
+                    .begin_tree        = [&] (auto v, auto& g) {
+                        ASSERT_FALSE(current_tree.has_value());
+                        ASSERT_TRUE(std::ranges::find(visited, v) == visited.end());
+
+                        current_tree = v;
+                        ++trees;
+                    },
+                    .finish_tree       = [&] (auto v, auto& g) {
+                        ASSERT_TRUE(current_tree.has_value() && graphle::vertex_compare_of<G>{}(*current_tree, v));
+                        current_tree.reset();
+                    }
+                });
+
+                ASSERT_TRUE(result);
+                ASSERT_TRUE(searches == 1);
+                ASSERT_FALSE(current_tree.has_value());
+                ASSERT_TRUE(visited.size() == std::ranges::distance(graph.get_vertices()));
+                ASSERT_TRUE(trees <= visited.size());
+                ASSERT_TRUE((trees == 0) == visited.empty());
+            };
+
+
+            check([] (auto&&... args) { return graphle::search::breadth_first_search_forest(GRAPHLE_FWD(args)...); });
+            check([] (auto&&... args) { return graphle::search::depth_first_search_forest(GRAPHLE_FWD(args)...); });
+        }
+    });
+}
+
+
+/**
+ * @test search_forest::single_root_tree
+ * Checks that a search from a single root invokes begin_tree and finish_tree once, for the root.
+ */
+TEST(search_forest, single_root_tree) {
+    auto structure = graphle::test::v_list_out_edge_graph::from_ve_list(graphle::test::make_tree_graph());
+    auto graph     = structure.view_as_graph();
+
+    using G = decltype(graph);
+
+
+    std::vector<graphle::vertex_of<G>> begun, finished;
+
+    graphle::search::depth_first_search(graph, &structure.vertices[0], graphle::search::visitor_from_arguments {
+        .deduce_graph_type = graphle::meta::deduce_as<G>,
+        .begin_tree        = [&] (auto v, auto& g) { begun.push_back(v); },
+        .finish_tree       = [&] (auto v, auto& g) { finished.push_back(v); }
+    });
+
+    ASSERT_TRUE(begun == std::vector<graphle::vertex_of<G>> { &structure.vertices[0] });
+    ASSERT_TRUE(finished == begun);
+}
+
+
+/**
+ * @test search_forest::budget
+ * Checks that the forest traversals are cancelled once their budget is exhausted, and visit every vertex when their budget is exhausted by the last vertex.
+ */
+TEST(search_forest, budget) {
+    graphle::test::vertex_list_datastructure_list::foreach([] <typename DS> {
+        for (const auto& src : graphle::test::make_graphs()) {
+            auto structure = DS::from_ve_list(src);
+            auto graph     = structure.view_as_graph();
+
+            using G = decltype(graph);
+            const std::size_t num_vertices = std::ranges::distance(graph.get_vertices());
+
+
+            auto check = [&] (auto&& algorithm) {
+                auto visit = [&] (std::size_t& count) {
+                    return graphle::search::visitor_from_arguments {
+                        .deduce_graph_type = graphle::meta::deduce_as<G>,
+                        .discover_vertex   = [&] (auto v, auto& g) { ++count; }
+                    };
+                };
+
+
+                std::size_t measured = 0, exact = 0, cancelled = 0;
+                graphle::util::work_budget measure;
+
+                ASSERT_TRUE(algorithm(graph, visit(measured), measure) == graphle::util::run_status::FINISHED);
+                const std::size_t total = graphle::util::work_budget {}.get_remaining_work() - measure.get_remaining_work();
+
+                ASSERT_TRUE(algorithm(graph, visit(exact), graphle::util::work_budget::of_work(total)) == graphle::util::run_status::FINISHED);
+                ASSERT_TRUE(measured == num_vertices && exact == num_vertices);
+
+                if (num_vertices > 1) {
+                    ASSERT_TRUE(algorithm(graph, visit(cancelled), graphle::util::work_budget::of_work(1)) == graphle::util::run_status::CANCELLED);
+                    ASSERT_TRUE(cancelled < num_vertices);
+                }
+            };
+
+
+            check([] (auto&&... args) { return graphle::search::breadth_first_search_forest(GRAPHLE_FWD(args)...); });
+            check([] (auto&&... args) { return graphle::search::depth_first_search_forest(GRAPHLE_FWD(args)...); });
+        }
+    });
+}
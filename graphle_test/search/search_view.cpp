@@ -0,0 +1,102 @@
+#include <test_framework.hpp>
+#include <test_data.hpp>
+#include <graphle.hpp>
+
+#include <algorithm>
+#include <vector>
+
+
+/** Returns the vertices in the order in which the given search algorithm visits them. */
+template <typename G, typename Algorithm> static auto visit_order(G& graph, graphle::vertex_of<G> root, Algorithm&& algorithm) {
+    std::vector<graphle::vertex_of<G>> order;
+
+    algorithm(graph, root, graphle::search::visitor_from_arguments {
+        .deduce_graph_type = graphle::meta::deduce_as<G>,
+        .discover_vertex   = [&] (auto v, auto& g) { order.push_back(v); }
+    });
+
+    return order;
+}
+
+
+/**
+ * @test search_view::same_order_as_search
+ * Checks that views::bfs and views::dfs yield the vertices of every test graph in the same order as the corresponding search algorithms visit them.
+ */
+TEST(search_view, same_order_as_search) {
+    graphle::test::vertex_list_datastructure_list::foreach([] <typename DS> {
+        for (const auto& src : graphle::test::make_graphs()) {
+            auto structure = DS::from_ve_list(src);
+            auto graph     = structure.view_as_graph();
+
+            for (auto root : graph.get_vertices()) {
+                auto bfs_order = visit_order(graph, root, [] (auto&&... args) { graphle::search::breadth_first_search(GRAPHLE_FWD(args)...); });
+                auto dfs_order = visit_order(graph, root, [] (auto&&... args) { graphle::search::depth_first_search(GRAPHLE_FWD(args)...); });
+
+                ASSERT_TRUE(std::ranges::equal(graphle::views::bfs(graph, root), bfs_order));
+                ASSERT_TRUE(std::ranges::equal(graphle::views::dfs(graph, root), dfs_order));
+            }
+        }
+    });
+}
+
+
+/**
+ * @test search_view::bfs_step_depths
+ * Checks that the steps yielded by views::bfs_steps have the same depths as the distances of a BFS tree,
+ * and that the parent of every step is a vertex one step closer to the root.
+ */
+TEST(search_view, bfs_step_depths) {
+    graphle::test::vertex_list_out_edges_datastructure_list::foreach([] <typename DS> {
+        for (const auto& src : graphle::test::make_graphs()) {
+            auto structure = DS::from_ve_list(src);
+            auto graph     = structure.view_as_graph();
+
+            for (auto root : graph.get_vertices()) {
+                const auto tree = graphle::search::breadth_first_tree(graph, root);
+                std::size_t num_steps = 0;
+
+                for (const auto& step : graphle::views::bfs_steps(graph, root)) {
+                    ASSERT_TRUE(step.depth == tree.distance_to(step.vertex));
+                    ASSERT_TRUE(step.parent.has_value() == (step.depth > 0));
+                    if (step.parent) ASSERT_TRUE(tree.distance_to(*step.parent) + 1 == step.depth);
+
+                    ++num_steps;
+                }
+
+                ASSERT_TRUE(num_steps == tree.distance.size() - std::size_t(std::ranges::count(tree.distance, tree.unreached)));
+            }
+        }
+    });
+}
+
+
+/**
+ * @test search_view::lazy
+ * Checks that the views only visit the out edges of the vertices that are consumed.
+ */
+TEST(search_view, lazy) {
+    graphle::test::ve_list_graph src;
+    for (std::size_t i = 0; i < 1000; ++i) src.vertices.push_back({ i });
+    for (std::size_t i = 0; i + 1 < 1000; ++i) src.edges.emplace_back(src.vertices[i], src.vertices[i + 1]);
+
+    auto structure = graphle::test::v_list_out_edge_graph::from_ve_list(src);
+    using vertex   = graphle::test::v_list_out_edge_graph::vertex;
+
+    std::size_t expanded = 0;
+
+    auto graph = graphle::graph {
+        .deduce_vertex_type = graphle::meta::deduce_as<vertex>,
+        .get_out_edges      = [&] (vertex* v) { ++expanded; return graphle::views::all(v->out) | graphle::views::edge_from(v); }
+    };
+
+
+    std::vector<std::size_t> ids;
+    for (const auto& step : graphle::views::dfs_steps(graph, &structure.vertices[0]) | std::views::take(5)) {
+        ASSERT_TRUE(step.depth == step.vertex->vertex_id);
+        ids.push_back(step.vertex->vertex_id);
+    }
+
+    ASSERT_TRUE(ids == std::vector<std::size_t> { 0, 1, 2, 3, 4 });
+    ASSERT_TRUE(expanded <= 5);
+}
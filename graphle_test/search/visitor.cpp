@@ -1,5 +1,7 @@
 #include <test_framework.hpp>
 #include <test_datastructures.hpp>
+#include <test_data.hpp>
+#include <graphle.hpp>
 
 
 struct vertex {};
@@ -61,4 +63,35 @@ TEST(search_visitor, from_arguments_all) {
     };
 
     ASSERT_TRUE(graphle::search::search_visitor_type<decltype(v), decltype(g)>);
-}
\ No newline at end of file
+}
+
+/**
+ * @test search_visitor::implemented_hooks
+ * Checks that only the methods provided to a visitor are reported as implemented, and that the edge methods of visitor_from_arguments are invoked by a search.
+ */
+TEST(search_visitor, implemented_hooks) {
+    using enum graphle::search::visitor_hook;
+
+    auto src       = graphle::test::make_tree_graph();
+    auto structure = graphle::test::v_list_out_edge_graph::from_ve_list(src);
+    auto g         = structure.view_as_graph();
+
+    std::size_t new_edges = 0, seen_edges = 0;
+
+    auto v = graphle::search::visitor_from_arguments {
+        .deduce_graph_type  = graphle::meta::deduce_as<decltype(g)>,
+        .discover_vertex    = [] (auto v, auto& g) {},
+        .discover_new_edge  = [&] (auto e, auto& g) { ++new_edges; },
+        .discover_seen_edge = [&] (auto e, auto& g) { ++seen_edges; }
+    };
+
+    ASSERT_TRUE(v.implemented_hooks() == (DISCOVER_VERTEX | DISCOVER_EDGE_TO_NEW_VERTEX | DISCOVER_EDGE_TO_KNOWN_VERTEX));
+    ASSERT_FALSE(v.implements(DISCOVER_BRANCH));
+    ASSERT_FALSE(v.implements(BEGIN_SEARCH));
+
+
+    graphle::search::breadth_first_search(g, &structure.vertices[0], v);
+
+    ASSERT_TRUE(new_edges == structure.vertices.size() - 1);
+    ASSERT_TRUE(new_edges + seen_edges == src.edges.size());
+}
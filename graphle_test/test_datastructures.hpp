@@ -304,7 +304,7 @@ namespace graphle::test {
                 .deduce_compare_as  = graphle::meta::deduce_as<graphle::compare_by_value<vertex>>,
                 .get_vertices       = [this] { return views::all(vertices) | views::transform(util::addressof); },
                 .get_out_edges      = [] (vertex* v) { return views::all(v->out) | views::edge_from(v); },
-                .get_in_edges       = [] (vertex* v) { return views::all(v->out) | views::edge_to(v); }
+                .get_in_edges       = [] (vertex* v) { return views::all(v->in) | views::edge_to(v); }
             };
         }
     };
@@ -322,4 +322,27 @@ namespace graphle::test {
         in_out_edge_graph,
         v_list_in_out_edge_graph
     >;
+
+
+    /**
+     * @ingroup TestGraphs
+     * List of test datastructure types which provide a list of vertices.
+     */
+    using vertex_list_datastructure_list = meta::type_list<
+        ve_list_graph,
+        ve_map_graph,
+        v_list_out_edge_graph,
+        v_list_in_out_edge_graph
+    >;
+
+
+    /**
+     * @ingroup TestGraphs
+     * List of test datastructure types which provide a list of vertices and the out edges of every vertex.
+     */
+    using vertex_list_out_edges_datastructure_list = meta::type_list<
+        ve_map_graph,
+        v_list_out_edge_graph,
+        v_list_in_out_edge_graph
+    >;
 }